@@ -0,0 +1,187 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Affine2.h                                                     //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    2D affine transform (2x2 linear part plus translation).                 //
+//                                                                            //
+//      | a  c  tx |   Columns are the transformed x / y axes,                //
+//      | b  d  ty |   so TransformPoint(p) = (a*x + c*y + tx, b*x + d*y + ty).//
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cmath>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Constants.h"
+#include "DeterministicMath.h"
+#include "Rect.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+struct Affine2
+{
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline static Affine2
+    Identity() noexcept
+    {
+        return Affine2(1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Scale, then rotation, then translation - With the rotation
+    ///   already as its cos / sin, so batches can skip the trigonometry.
+    ACOW_CONSTEXPR_STRICT inline static Affine2
+    FromTRS(const Vec2 &translation, float cos, float sin, const Vec2 &scale) noexcept
+    {
+        return Affine2(
+            cos * scale.x, sin * scale.x,
+           -sin * scale.y, cos * scale.y,
+            translation.x, translation.y
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief degrees as in Vec2::Rotate.
+    inline static Affine2
+    FromTRS(const Vec2 &translation, float degrees, const Vec2 &scale) noexcept
+    {
+        auto s = 0.0f;
+        auto c = 0.0f;
+        SinCos(ToRadians(degrees), &s, &c);
+
+        return FromTRS(translation, c, s, scale);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT
+    Affine2() noexcept
+        : a(1.0f), b(0.0f), c(0.0f), d(1.0f), tx(0.0f), ty(0.0f)
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT
+    Affine2(float a, float b, float c, float d, float tx, float ty) noexcept
+        : a(a), b(b), c(c), d(d), tx(tx), ty(ty)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline Vec2
+    TransformPoint(const Vec2 &p) const noexcept
+    {
+        return Vec2(a * p.x + c * p.y + tx, b * p.x + d * p.y + ty);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Without the translation - For directions and sizes.
+    ACOW_CONSTEXPR_STRICT inline Vec2
+    TransformVector(const Vec2 &v) const noexcept
+    {
+        return Vec2(a * v.x + c * v.y, b * v.x + d * v.y);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Axis aligned bounds of the transformed rect - The transformed
+    ///   center plus the extents the axes project to.
+    inline Rect
+    TransformRect(const Rect &r) const noexcept
+    {
+        auto hw = r.w * 0.5f;
+        auto hh = r.h * 0.5f;
+        auto cx = r.x + hw;
+        auto cy = r.y + hh;
+
+        auto center_x = a * cx + c * cy + tx;
+        auto center_y = b * cx + d * cy + ty;
+        auto extent_x = std::fabs(a) * hw + std::fabs(c) * hh;
+        auto extent_y = std::fabs(b) * hw + std::fabs(d) * hh;
+
+        return Rect(center_x - extent_x, center_y - extent_y, extent_x * 2.0f, extent_y * 2.0f);
+    }
+
+    ACOW_CONSTEXPR_STRICT inline Vec2 GetTranslation() const noexcept { return Vec2(tx, ty); }
+
+    ACOW_CONSTEXPR_STRICT inline float
+    GetDeterminant() const noexcept
+    {
+        return a * d - b * c;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Singular transforms (determinant 0) give infs / NaNs.
+    inline Affine2
+    GetInverse() const noexcept
+    {
+        auto inv = 1.0f / GetDeterminant();
+        auto ia  =  d * inv;
+        auto ib  = -b * inv;
+        auto ic  = -c * inv;
+        auto id  =  a * inv;
+        return Affine2(ia, ib, ic, id, -(ia * tx + ic * ty), -(ib * tx + id * ty));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief lhs after rhs - (parent * local) takes local to parent space.
+    ACOW_CONSTEXPR_STRICT friend inline Affine2
+    operator *(const Affine2 &lhs, const Affine2 &rhs) noexcept
+    {
+        return Affine2(
+            lhs.a * rhs.a  + lhs.c * rhs.b,
+            lhs.b * rhs.a  + lhs.d * rhs.b,
+            lhs.a * rhs.c  + lhs.c * rhs.d,
+            lhs.b * rhs.c  + lhs.d * rhs.d,
+            lhs.a * rhs.tx + lhs.c * rhs.ty + lhs.tx,
+            lhs.b * rhs.tx + lhs.d * rhs.ty + lhs.ty
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    float a, b;
+    float c, d;
+    float tx, ty;
+
+}; // struct Affine2
+
+} // namespace math
+} // namespace acow
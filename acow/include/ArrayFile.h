@@ -0,0 +1,745 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ArrayFile.h                                                   //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Versioned binary file of Vec2 / Rect / Coord / float arrays, with a     //
+//    writer and a memory mapped reader that hands out the arrays straight    //
+//    from the mapped pages - Loading is an mmap plus a header check,         //
+//    not a parse-and-allocate pass.                                          //
+//                                                                            //
+//    Layout (all offsets are 64 bytes aligned):                              //
+//      Header | Section table | Section data...                              //
+//    Sections are AoS (the raw structs) or SoA (one lane for each field,     //
+//    e.g. x / y / w / h for Rects, ready for the batch kernels).             //
+//                                                                            //
+//    The data is stored in the writer's byte order - A reader with the       //
+//    other byte order refuses the file (it can't be zero-copy anyway).       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+// POSIX / Windows
+#if defined(_WIN32)
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif // WIN32_LEAN_AND_MEAN
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif // NOMINMAX
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif // defined(_WIN32)
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Coord.h"
+#include "Overlap.h"
+#include "Rect.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+//----------------------------------------------------------------------------//
+// Format                                                                     //
+//----------------------------------------------------------------------------//
+enum class ArrayType : u32
+{
+    Float = 1,
+    Vec2  = 2,
+    Rect  = 3,
+    Coord = 4,
+}; // enum class ArrayType
+
+enum class ArrayLayout : u32
+{
+    AoS = 0,
+    SoA = 1,
+}; // enum class ArrayLayout
+
+enum class ArrayFileError
+{
+    None,
+    CantOpen,
+    Misaligned,
+    TooSmall,
+    BadMagic,
+    BadVersion,
+    BadEndianness,
+    BadSize,
+    BadSection,
+    BadChecksum,
+}; // enum class ArrayFileError
+
+struct ArrayFileHeader
+{
+    constexpr static u32    kVersion      = 1;
+    constexpr static u32    kEndianMarker = 0x01020304u;
+    constexpr static size_t kAlignment    = 64;
+
+    char magic[8];      // "ACOWMATH"
+    u32  version;
+    u32  endianMarker;  // kEndianMarker in the writer's byte order.
+    u32  sectionsCount;
+    u32  headerSize;    // sizeof(ArrayFileHeader)
+    u64  fileSize;
+    u64  checksum;      // Of everything after the header.
+    u8   reserved[24];
+}; // struct ArrayFileHeader
+
+struct ArrayFileSection
+{
+    constexpr static size_t kMaxNameLength = 31;
+
+    char name[kMaxNameLength + 1];  // Nul terminated.
+    u32  type;                      // ArrayType
+    u32  layout;                    // ArrayLayout
+    u64  count;
+    u64  offset;                    // From the start of the file.
+    u64  laneStride;                // Bytes between the SoA lanes.
+}; // struct ArrayFileSection
+
+static_assert(sizeof(ArrayFileHeader)  == ArrayFileHeader::kAlignment, "Header must keep the data aligned");
+static_assert(sizeof(ArrayFileSection) == ArrayFileHeader::kAlignment, "Sections must keep the data aligned");
+
+// The arrays are handed out straight from the file bytes.
+static_assert(sizeof(Vec2)  == sizeof(float) * 2, "Vec2 must be 2 packed floats");
+static_assert(sizeof(Rect)  == sizeof(float) * 4, "Rect must be 4 packed floats");
+static_assert(sizeof(Coord) == sizeof(i32)   * 2, "Coord must be 2 packed i32");
+static_assert(std::is_trivially_copyable<Vec2 >::value, "Vec2 must be trivially copyable");
+static_assert(std::is_trivially_copyable<Rect >::value, "Rect must be trivially copyable");
+static_assert(std::is_trivially_copyable<Coord>::value, "Coord must be trivially copyable");
+
+
+///-----------------------------------------------------------------------------
+/// @brief Read only view over an array - Valid while its file is open.
+template <typename T>
+struct ArraySpan
+{
+    const T *pData;
+    size_t   count;
+
+    inline const T* begin() const noexcept { return pData;         }
+    inline const T* end  () const noexcept { return pData + count; }
+
+    inline size_t size () const noexcept { return count;      }
+    inline bool   empty() const noexcept { return count == 0; }
+
+    inline const T& operator[](size_t i) const noexcept { return pData[i]; }
+}; // struct ArraySpan
+
+
+namespace detail {
+
+template <typename T> struct ArrayTraits;
+
+template <> struct ArrayTraits<float> { typedef float Lane; constexpr static ArrayType kType = ArrayType::Float; constexpr static u32 kLanes = 1; };
+template <> struct ArrayTraits<Vec2 > { typedef float Lane; constexpr static ArrayType kType = ArrayType::Vec2;  constexpr static u32 kLanes = 2; };
+template <> struct ArrayTraits<Rect > { typedef float Lane; constexpr static ArrayType kType = ArrayType::Rect;  constexpr static u32 kLanes = 4; };
+template <> struct ArrayTraits<Coord> { typedef i32   Lane; constexpr static ArrayType kType = ArrayType::Coord; constexpr static u32 kLanes = 2; };
+
+ACOW_CONSTEXPR_STRICT inline u64
+AlignArrayOffset(u64 offset) noexcept
+{
+    return (offset + (ArrayFileHeader::kAlignment - 1)) & ~u64(ArrayFileHeader::kAlignment - 1);
+}
+
+ACOW_CONSTEXPR_STRICT inline u32
+GetArrayLanesCount(u32 type) noexcept
+{
+    return (type == u32(ArrayType::Float)) ? 1
+         : (type == u32(ArrayType::Vec2 )) ? 2
+         : (type == u32(ArrayType::Rect )) ? 4
+         : (type == u32(ArrayType::Coord)) ? 2
+         : 0;
+}
+
+ACOW_CONSTEXPR_STRICT inline u64
+RotateLeft64(u64 x, u32 bits) noexcept
+{
+    return (x << bits) | (x >> (64 - bits));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief 64 bits hash with xxHash64 style rounds over 4 independent lanes,
+///   so verifying the file runs at memory speed - Not xxHash64 compatible.
+inline u64
+ArrayFileChecksum(const void *pData, size_t size) noexcept
+{
+    constexpr u64 kPrime1 = 0x9E3779B185EBCA87ull;
+    constexpr u64 kPrime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr u64 kPrime3 = 0x165667B19E3779F9ull;
+
+    auto p_bytes = static_cast<const u8*>(pData);
+
+    u64 acc[4] = { kPrime1 + kPrime2, kPrime2, 0, 0 - kPrime1 };
+    size_t i = 0;
+    for(; i + 32 <= size; i += 32) {
+        u64 words[4];
+        std::memcpy(words, p_bytes + i, sizeof(words));
+        for(int lane = 0; lane < 4; ++lane) {
+            acc[lane] = RotateLeft64(acc[lane] + words[lane] * kPrime2, 31) * kPrime1;
+        }
+    }
+
+    auto hash = RotateLeft64(acc[0],  1) + RotateLeft64(acc[1],  7)
+              + RotateLeft64(acc[2], 12) + RotateLeft64(acc[3], 18)
+              + u64(size);
+
+    for(; i < size; ++i) {
+        hash = RotateLeft64(hash ^ (p_bytes[i] * kPrime3), 11) * kPrime1;
+    }
+
+    hash ^= hash >> 33; hash *= kPrime2;
+    hash ^= hash >> 29; hash *= kPrime3;
+    hash ^= hash >> 32;
+    return hash;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// ArrayFileWriter                                                            //
+//----------------------------------------------------------------------------//
+class ArrayFileWriter
+{
+    //------------------------------------------------------------------------//
+    // Sections                                                               //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Copies the array into the file - Names longer than
+    ///   ArrayFileSection::kMaxNameLength are cut.
+    inline void
+    AddFloats(const char *name, const float *pValues, size_t count)
+    {
+        Add(name, pValues, count, ArrayLayout::AoS);
+    }
+
+    inline void
+    AddVec2s(const char *name, const Vec2 *pVec2s, size_t count, ArrayLayout layout = ArrayLayout::AoS)
+    {
+        Add(name, pVec2s, count, layout);
+    }
+
+    inline void
+    AddRects(const char *name, const Rect *pRects, size_t count, ArrayLayout layout = ArrayLayout::AoS)
+    {
+        Add(name, pRects, count, layout);
+    }
+
+    inline void
+    AddCoords(const char *name, const Coord *pCoords, size_t count, ArrayLayout layout = ArrayLayout::AoS)
+    {
+        Add(name, pCoords, count, layout);
+    }
+
+    inline void
+    Clear() noexcept
+    {
+        m_sections.clear();
+        m_data    .clear();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Output                                                                 //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The whole file - Can be read back with ArrayFileReader::OpenMemory.
+    inline std::vector<u8>
+    Build() const
+    {
+        auto table_size = sizeof(ArrayFileSection) * m_sections.size();
+        auto data_start = sizeof(ArrayFileHeader) + table_size;
+
+        std::vector<u8> file(data_start + m_data.size());
+
+        auto sections = m_sections;
+        for(auto &section : sections) {
+            section.offset += data_start;
+        }
+        if(!sections.empty()) {
+            std::memcpy(file.data() + sizeof(ArrayFileHeader), sections.data(), table_size);
+        }
+        if(!m_data.empty()) {
+            std::memcpy(file.data() + data_start, m_data.data(), m_data.size());
+        }
+
+        ArrayFileHeader header = {};
+        std::memcpy(header.magic, "ACOWMATH", sizeof(header.magic));
+        header.version       = ArrayFileHeader::kVersion;
+        header.endianMarker  = ArrayFileHeader::kEndianMarker;
+        header.sectionsCount = u32(m_sections.size());
+        header.headerSize    = u32(sizeof(ArrayFileHeader));
+        header.fileSize      = u64(file.size());
+        header.checksum      = detail::ArrayFileChecksum(
+            file.data() + sizeof(ArrayFileHeader),
+            file.size() - sizeof(ArrayFileHeader)
+        );
+        std::memcpy(file.data(), &header, sizeof(header));
+
+        return file;
+    }
+
+    inline bool
+    WriteToFile(const char *path) const
+    {
+        auto file   = Build();
+        auto p_file = std::fopen(path, "wb");
+        if(!p_file) {
+            return false;
+        }
+
+        auto written = std::fwrite(file.data(), 1, file.size(), p_file);
+        auto closed  = std::fclose(p_file) == 0;
+        return written == file.size() && closed;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    template <typename T>
+    inline void
+    Add(const char *name, const T *pItems, size_t count, ArrayLayout layout)
+    {
+        typedef detail::ArrayTraits<T>       Traits;
+        typedef typename Traits::Lane        Lane;
+
+        ArrayFileSection section = {};
+        std::strncpy(section.name, name, ArrayFileSection::kMaxNameLength);
+        section.type   = u32(Traits::kType);
+        section.layout = u32(layout);
+        section.count  = u64(count);
+        section.offset = u64(m_data.size()); // Rebased on Build.
+
+        if(layout == ArrayLayout::AoS || Traits::kLanes == 1) {
+            section.layout     = u32(ArrayLayout::AoS);
+            section.laneStride = 0;
+
+            m_data.resize(detail::AlignArrayOffset(m_data.size() + sizeof(T) * count));
+            if(count != 0) {
+                std::memcpy(m_data.data() + section.offset, pItems, sizeof(T) * count);
+            }
+        } else {
+            section.laneStride = detail::AlignArrayOffset(sizeof(Lane) * count);
+            m_data.resize(m_data.size() + section.laneStride * Traits::kLanes);
+
+            // The structs are their lanes packed, so scatter field by field.
+            auto p_items = reinterpret_cast<const Lane*>(pItems);
+            for(u32 lane = 0; lane < Traits::kLanes; ++lane) {
+                auto p_lane = reinterpret_cast<Lane*>(
+                    m_data.data() + section.offset + section.laneStride * lane
+                );
+                for(size_t i = 0; i < count; ++i) {
+                    p_lane[i] = p_items[i * Traits::kLanes + lane];
+                }
+            }
+        }
+
+        m_sections.push_back(section);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<ArrayFileSection> m_sections;
+    std::vector<u8>               m_data;
+
+}; // class ArrayFileWriter
+
+
+//----------------------------------------------------------------------------//
+// ArrayFileReader                                                            //
+//----------------------------------------------------------------------------//
+class ArrayFileReader
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ArrayFileReader() noexcept
+        : m_pData    (nullptr)
+        , m_size     (0)
+        , m_isMapped (false)
+        #if defined(_WIN32)
+        , m_mapping  (nullptr)
+        #endif // defined(_WIN32)
+    {
+        // Empty...
+    }
+
+    ~ArrayFileReader() noexcept
+    {
+        Close();
+    }
+
+    ArrayFileReader(const ArrayFileReader &) = delete;
+    ArrayFileReader& operator=(const ArrayFileReader &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Open / Close                                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Maps the file read only - The pages are only touched when the
+    ///   arrays are read, unless verifyChecksum is set (it reads them all).
+    inline ArrayFileError
+    Open(const char *path, bool verifyChecksum = true) noexcept
+    {
+        Close();
+
+        #if defined(_WIN32)
+            auto file = CreateFileA(
+                path, GENERIC_READ, FILE_SHARE_READ, nullptr,
+                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr
+            );
+            if(file == INVALID_HANDLE_VALUE) {
+                return ArrayFileError::CantOpen;
+            }
+
+            LARGE_INTEGER size = {};
+            if(!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+                CloseHandle(file);
+                return (size.QuadPart == 0) ? ArrayFileError::TooSmall : ArrayFileError::CantOpen;
+            }
+
+            m_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            CloseHandle(file);
+            if(!m_mapping) {
+                return ArrayFileError::CantOpen;
+            }
+
+            auto p_data = MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0);
+            if(!p_data) {
+                CloseHandle(m_mapping);
+                m_mapping = nullptr;
+                return ArrayFileError::CantOpen;
+            }
+            auto file_size = size_t(size.QuadPart);
+        #else
+            auto fd = ::open(path, O_RDONLY);
+            if(fd < 0) {
+                return ArrayFileError::CantOpen;
+            }
+
+            struct stat info;
+            if(::fstat(fd, &info) != 0) {
+                ::close(fd);
+                return ArrayFileError::CantOpen;
+            }
+            if(info.st_size == 0) {
+                ::close(fd);
+                return ArrayFileError::TooSmall;
+            }
+
+            auto file_size = size_t(info.st_size);
+            auto p_data    = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd); // The mapping keeps the file alive.
+            if(p_data == MAP_FAILED) {
+                return ArrayFileError::CantOpen;
+            }
+        #endif // defined(_WIN32)
+
+        m_pData    = static_cast<const u8*>(p_data);
+        m_size     = file_size;
+        m_isMapped = true;
+
+        auto error = Validate(verifyChecksum);
+        if(error != ArrayFileError::None) {
+            Close();
+        }
+        return error;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads a file already in memory (e.g. ArrayFileWriter::Build) -
+    ///   Nothing is copied, so pData must outlive the reader.
+    inline ArrayFileError
+    OpenMemory(const void *pData, size_t size, bool verifyChecksum = true) noexcept
+    {
+        Close();
+
+        // Enough for the lanes, the file itself keeps them 64 bytes aligned.
+        if(reinterpret_cast<uintptr_t>(pData) % alignof(u64) != 0) {
+            return ArrayFileError::Misaligned;
+        }
+
+        m_pData    = static_cast<const u8*>(pData);
+        m_size     = size;
+        m_isMapped = false;
+
+        auto error = Validate(verifyChecksum);
+        if(error != ArrayFileError::None) {
+            Close();
+        }
+        return error;
+    }
+
+    inline void
+    Close() noexcept
+    {
+        if(m_isMapped) {
+            #if defined(_WIN32)
+                UnmapViewOfFile(m_pData);
+                CloseHandle(m_mapping);
+                m_mapping = nullptr;
+            #else
+                ::munmap(const_cast<u8*>(m_pData), m_size);
+            #endif // defined(_WIN32)
+        }
+
+        m_pData    = nullptr;
+        m_size     = 0;
+        m_isMapped = false;
+    }
+
+    inline bool IsOpen() const noexcept { return m_pData != nullptr; }
+
+
+    //------------------------------------------------------------------------//
+    // Sections                                                               //
+    //------------------------------------------------------------------------//
+public:
+    inline size_t
+    GetSectionsCount() const noexcept
+    {
+        return IsOpen() ? size_t(GetHeader().sectionsCount) : 0;
+    }
+
+    inline const ArrayFileSection&
+    GetSection(size_t index) const noexcept
+    {
+        return GetSections()[index];
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief nullptr if there's no section with that name.
+    inline const ArrayFileSection*
+    FindSection(const char *name) const noexcept
+    {
+        auto p_sections = GetSections();
+        for(size_t i = 0, count = GetSectionsCount(); i < count; ++i) {
+            if(std::strncmp(p_sections[i].name, name, sizeof(p_sections[i].name)) == 0) {
+                return p_sections + i;
+            }
+        }
+        return nullptr;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Arrays                                                                 //
+    //   Empty spans when the section is missing, has other type or isn't     //
+    //   stored in the asked layout.                                          //
+    //------------------------------------------------------------------------//
+public:
+    inline ArraySpan<float> GetFloats(const char *name) const noexcept { return GetArray<float>(name); }
+    inline ArraySpan<Vec2 > GetVec2s (const char *name) const noexcept { return GetArray<Vec2 >(name); }
+    inline ArraySpan<Rect > GetRects (const char *name) const noexcept { return GetArray<Rect >(name); }
+    inline ArraySpan<Coord> GetCoords(const char *name) const noexcept { return GetArray<Coord>(name); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief One field of a SoA section - Lanes are in the struct order
+    ///   (x, y for Vec2 / x, y, w, h for Rect / y, x for Coord).
+    template <typename T>
+    inline ArraySpan<typename detail::ArrayTraits<T>::Lane>
+    GetLane(const char *name, u32 lane) const noexcept
+    {
+        typedef detail::ArrayTraits<T>       Traits;
+        typedef typename Traits::Lane        Lane;
+
+        auto p_section = FindSection(name, Traits::kType, ArrayLayout::SoA);
+        if(!p_section || lane >= Traits::kLanes) {
+            return ArraySpan<Lane>{ nullptr, 0 };
+        }
+
+        auto offset = p_section->offset + p_section->laneStride * lane;
+        return ArraySpan<Lane>{
+            reinterpret_cast<const Lane*>(m_pData + offset),
+            size_t(p_section->count)
+        };
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief A SoA Rect section ready for the batch Overlaps.
+    inline bool
+    GetRectSoA(const char *name, RectSoA *pOut_SoA) const noexcept
+    {
+        auto x = GetLane<Rect>(name, 0);
+        if(!x.pData) {
+            return false;
+        }
+
+        pOut_SoA->pX    = x.pData;
+        pOut_SoA->pY    = GetLane<Rect>(name, 1).pData;
+        pOut_SoA->pW    = GetLane<Rect>(name, 2).pData;
+        pOut_SoA->pH    = GetLane<Rect>(name, 3).pData;
+        pOut_SoA->count = x.count;
+        return true;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline const ArrayFileHeader&
+    GetHeader() const noexcept
+    {
+        return *reinterpret_cast<const ArrayFileHeader*>(m_pData);
+    }
+
+    inline const ArrayFileSection*
+    GetSections() const noexcept
+    {
+        return reinterpret_cast<const ArrayFileSection*>(m_pData + sizeof(ArrayFileHeader));
+    }
+
+    inline const ArrayFileSection*
+    FindSection(const char *name, ArrayType type, ArrayLayout layout) const noexcept
+    {
+        auto p_section = FindSection(name);
+        if(!p_section || p_section->type != u32(type) || p_section->layout != u32(layout)) {
+            return nullptr;
+        }
+        return p_section;
+    }
+
+    template <typename T>
+    inline ArraySpan<T>
+    GetArray(const char *name) const noexcept
+    {
+        auto p_section = FindSection(name, detail::ArrayTraits<T>::kType, ArrayLayout::AoS);
+        if(!p_section) {
+            return ArraySpan<T>{ nullptr, 0 };
+        }
+
+        return ArraySpan<T>{
+            reinterpret_cast<const T*>(m_pData + p_section->offset),
+            size_t(p_section->count)
+        };
+    }
+
+    inline ArrayFileError
+    Validate(bool verifyChecksum) const noexcept
+    {
+        if(m_size < sizeof(ArrayFileHeader)) {
+            return ArrayFileError::TooSmall;
+        }
+
+        const auto &header = GetHeader();
+        if(std::memcmp(header.magic, "ACOWMATH", sizeof(header.magic)) != 0) {
+            return ArrayFileError::BadMagic;
+        }
+        // Checked before the version, a swapped file has garbage there too.
+        if(header.endianMarker != ArrayFileHeader::kEndianMarker) {
+            return ArrayFileError::BadEndianness;
+        }
+        if(header.version != ArrayFileHeader::kVersion) {
+            return ArrayFileError::BadVersion;
+        }
+        if(header.headerSize != sizeof(ArrayFileHeader) || header.fileSize != u64(m_size)) {
+            return ArrayFileError::BadSize;
+        }
+
+        auto table_size = u64(header.sectionsCount) * sizeof(ArrayFileSection);
+        if(table_size > m_size - sizeof(ArrayFileHeader)) {
+            return ArrayFileError::BadSize;
+        }
+
+        auto p_sections = GetSections();
+        for(u32 i = 0; i < header.sectionsCount; ++i) {
+            if(!IsValidSection(p_sections[i])) {
+                return ArrayFileError::BadSection;
+            }
+        }
+
+        if(verifyChecksum) {
+            auto checksum = detail::ArrayFileChecksum(
+                m_pData + sizeof(ArrayFileHeader),
+                m_size  - sizeof(ArrayFileHeader)
+            );
+            if(checksum != header.checksum) {
+                return ArrayFileError::BadChecksum;
+            }
+        }
+
+        return ArrayFileError::None;
+    }
+
+    inline bool
+    IsValidSection(const ArrayFileSection &section) const noexcept
+    {
+        if(std::memchr(section.name, 0, sizeof(section.name)) == nullptr) {
+            return false;
+        }
+
+        auto lanes = detail::GetArrayLanesCount(section.type);
+        if(lanes == 0 || section.offset % ArrayFileHeader::kAlignment != 0) {
+            return false;
+        }
+
+        // Every type is made of 4 bytes fields - Divisions keep it overflow free.
+        auto available = u64(m_size) - ((section.offset < m_size) ? section.offset : m_size);
+        auto lane_size = u64(4);
+        if(section.layout == u32(ArrayLayout::AoS)) {
+            return section.laneStride == 0
+                && section.count <= available / (lane_size * lanes);
+        }
+        if(section.layout == u32(ArrayLayout::SoA)) {
+            return section.laneStride % ArrayFileHeader::kAlignment == 0
+                && section.count <= section.laneStride / lane_size
+                && section.laneStride <= available / lanes;
+        }
+        return false;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    const u8 *m_pData;
+    size_t    m_size;
+    bool      m_isMapped;
+
+    #if defined(_WIN32)
+    HANDLE m_mapping;
+    #endif // defined(_WIN32)
+
+}; // class ArrayFileReader
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,396 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BatchOperations.h                                             //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Clamp / Lerp / InverseLerp / Normalize / Remap over arrays. Same        //
+//    results as the scalar versions (Operations.h, Vec2.h) element by        //
+//    element.                                                                //
+//    The output can alias the input.                                         //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Instrumentation.h"
+#include "Operations.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+static_assert(sizeof(Vec2) == sizeof(float) * 2, "Vec2 must be tightly packed.");
+static_assert(sizeof(Rect) == sizeof(float) * 4, "Rect must be tightly packed.");
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace detail {
+
+inline void
+ScaleValues(const float *pValues, size_t count, float factor, float *pOut_Values) noexcept
+{
+    auto v_factor = simd::Set1(factor);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        simd::Store(pOut_Values + i, simd::Mul(simd::Load(pValues + i), v_factor));
+    }
+    for(; i < count; ++i) {
+        pOut_Values[i] = pValues[i] * factor;
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @brief v - period * floor((v + half) / period) - WrapRadians and
+///   WrapDegrees, term by term.
+inline void
+WrapValues(
+    const float *pValues,
+    size_t       count,
+    float        half,
+    float        period,
+    float       *pOut_Values) noexcept
+{
+    auto v_half    = simd::Set1(half);
+    auto v_period  = simd::Set1(period);
+    auto v_inverse = simd::Set1(1.0f / period);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        auto v = simd::Load(pValues + i);
+        auto k = simd::Floor(simd::Mul(simd::Add(v, v_half), v_inverse));
+        simd::Store(pOut_Values + i, simd::Sub(v, simd::Mul(v_period, k)));
+    }
+    for(; i < count; ++i) {
+        auto v = pValues[i];
+        pOut_Values[i] = v - period * std::floor((v + half) * (1.0f / period));
+    }
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Clamp                                                                      //
+//----------------------------------------------------------------------------//
+inline void
+Clamp(
+    const float *pValues,
+    size_t       count,
+    float        min,
+    float        max,
+    float       *pOut_Values) noexcept
+{
+    ACOW_MATH_TIME(BatchClamp, count);
+
+    auto v_min = simd::Set1(min);
+    auto v_max = simd::Set1(max);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        // Operand order keeps NaNs like the scalar version.
+        auto v = simd::Load(pValues + i);
+        simd::Store(pOut_Values + i, simd::Min(v_max, simd::Max(v_min, v)));
+    }
+    for(; i < count; ++i) {
+        pOut_Values[i] = Clamp(pValues[i], min, max);
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Clamps every point to be inside of the bounds.
+inline void
+Clamp(
+    const Vec2 *pPoints,
+    size_t      count,
+    const Rect &bounds,
+    Vec2       *pOut_Points) noexcept
+{
+    ACOW_MATH_TIME(BatchClamp, count);
+
+    const float mins[2] = { bounds.GetLeft (), bounds.GetTop   () };
+    const float maxs[2] = { bounds.GetRight(), bounds.GetBottom() };
+
+    auto p_in  = reinterpret_cast<const float*>(pPoints);
+    auto p_out = reinterpret_cast<float*>(pOut_Points);
+    auto n     = count * 2;
+
+    size_t i = 0;
+    if(simd::kWidth % 2 == 0) {
+        auto v_min = simd::LoadPattern(mins, 2);
+        auto v_max = simd::LoadPattern(maxs, 2);
+
+        for(; i + simd::kWidth <= n; i += simd::kWidth) {
+            auto v = simd::Load(p_in + i);
+            simd::Store(p_out + i, simd::Min(v_max, simd::Max(v_min, v)));
+        }
+    }
+    for(; i < n; ++i) {
+        p_out[i] = Clamp(p_in[i], mins[i & 1], maxs[i & 1]);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Lerp                                                                       //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Lerps each pair of values with its own t.
+inline void
+Lerp(
+    const float *pStart,
+    const float *pEnd,
+    const float *pT,
+    size_t       count,
+    float       *pOut_Values) noexcept
+{
+    ACOW_MATH_TIME(BatchLerp, count);
+
+    auto v_one = simd::Set1(1.0f);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        auto s = simd::Load(pStart + i);
+        auto e = simd::Load(pEnd   + i);
+        auto t = simd::Load(pT     + i);
+
+        auto r = simd::Add(simd::Mul(simd::Sub(v_one, t), s), simd::Mul(t, e));
+        simd::Store(pOut_Values + i, r);
+    }
+    for(; i < count; ++i) {
+        pOut_Values[i] = Lerp(pStart[i], pEnd[i], pT[i]);
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Lerps each pair of values with the same t.
+inline void
+Lerp(
+    const float *pStart,
+    const float *pEnd,
+    size_t       count,
+    float        t,
+    float       *pOut_Values) noexcept
+{
+    ACOW_MATH_TIME(BatchLerp, count);
+
+    auto v_t  = simd::Set1(t);
+    auto v_1t = simd::Set1(1.0f - t);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        auto s = simd::Load(pStart + i);
+        auto e = simd::Load(pEnd   + i);
+
+        simd::Store(pOut_Values + i, simd::Add(simd::Mul(v_1t, s), simd::Mul(v_t, e)));
+    }
+    for(; i < count; ++i) {
+        pOut_Values[i] = Lerp(pStart[i], pEnd[i], t);
+    }
+}
+
+inline void
+Lerp(
+    const Vec2 *pStart,
+    const Vec2 *pEnd,
+    size_t      count,
+    float       t,
+    Vec2       *pOut_Values) noexcept
+{
+    Lerp(
+        reinterpret_cast<const float*>(pStart),
+        reinterpret_cast<const float*>(pEnd),
+        count * 2,
+        t,
+        reinterpret_cast<float*>(pOut_Values)
+    );
+}
+
+inline void
+Lerp(
+    const Rect *pStart,
+    const Rect *pEnd,
+    size_t      count,
+    float       t,
+    Rect       *pOut_Values) noexcept
+{
+    Lerp(
+        reinterpret_cast<const float*>(pStart),
+        reinterpret_cast<const float*>(pEnd),
+        count * 4,
+        t,
+        reinterpret_cast<float*>(pOut_Values)
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// InverseLerp                                                                //
+//----------------------------------------------------------------------------//
+inline void
+InverseLerp(
+    const float *pValues,
+    size_t       count,
+    float        s,
+    float        e,
+    float       *pOut_Values) noexcept
+{
+    ACOW_MATH_TIME(BatchInverseLerp, count);
+
+    if(e == s) {
+        for(size_t i = 0; i < count; ++i) {
+            pOut_Values[i] = 0.0f;
+        }
+        return;
+    }
+
+    auto v_s   = simd::Set1(s);
+    auto v_len = simd::Set1(e - s);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        auto v = simd::Load(pValues + i);
+        simd::Store(pOut_Values + i, simd::Div(simd::Sub(v, v_s), v_len));
+    }
+    for(; i < count; ++i) {
+        pOut_Values[i] = InverseLerp(s, e, pValues[i]);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Normalize                                                                  //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Same as Vec2::Normalize on each vector - Zero vectors give NaNs.
+inline void
+Normalize(
+    const Vec2 *pVectors,
+    size_t      count,
+    Vec2       *pOut_Vectors) noexcept
+{
+    ACOW_MATH_TIME(BatchNormalize, count);
+
+    auto p_in  = reinterpret_cast<const float*>(pVectors);
+    auto p_out = reinterpret_cast<float*>(pOut_Vectors);
+    auto n     = count * 2;
+
+    size_t i = 0;
+    if(simd::kWidth % 2 == 0) {
+        for(; i + simd::kWidth <= n; i += simd::kWidth) {
+            // x*x + y*y on both lanes of each vector.
+            auto v  = simd::Load(p_in + i);
+            auto sq = simd::Mul(v, v);
+            auto m  = simd::Sqrt(simd::Add(sq, simd::SwapPairs(sq)));
+            simd::Store(p_out + i, simd::Div(v, m));
+        }
+    }
+    for(i /= 2; i < count; ++i) {
+        auto v = pVectors[i];
+        v.Normalize();
+        pOut_Vectors[i] = v;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Remap                                                                      //
+//----------------------------------------------------------------------------//
+inline void
+Remap(
+    const float *pValues,
+    size_t       count,
+    float        inS,
+    float        inE,
+    float        outS,
+    float        outE,
+    float       *pOut_Values) noexcept
+{
+    ACOW_MATH_TIME(BatchRemap, count);
+
+    if(inE == inS) {
+        for(size_t i = 0; i < count; ++i) {
+            pOut_Values[i] = outS;
+        }
+        return;
+    }
+
+    auto v_in_s  = simd::Set1(inS);
+    auto v_in_l  = simd::Set1(inE - inS);
+    auto v_out_s = simd::Set1(outS);
+    auto v_out_e = simd::Set1(outE);
+    auto v_one   = simd::Set1(1.0f);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        auto v = simd::Load(pValues + i);
+        auto t = simd::Div(simd::Sub(v, v_in_s), v_in_l);
+        auto r = simd::Add(
+            simd::Mul(simd::Sub(v_one, t), v_out_s),
+            simd::Mul(t, v_out_e)
+        );
+        simd::Store(pOut_Values + i, r);
+    }
+    for(; i < count; ++i) {
+        pOut_Values[i] = Remap(pValues[i], inS, inE, outS, outE);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Angles                                                                     //
+//   The SSE2 floor only holds for |angle / period| < 2^31 - Far past where   //
+//   a float angle has any precision left. Infinities and NaNs aren't kept.   //
+//----------------------------------------------------------------------------//
+inline void
+ToRadians(const float *pDegrees, size_t count, float *pOut_Radians) noexcept
+{
+    ACOW_MATH_TIME(BatchAngles, count);
+    detail::ScaleValues(pDegrees, count, detail::Deg2Rad<float>(), pOut_Radians);
+}
+
+inline void
+ToDegrees(const float *pRadians, size_t count, float *pOut_Degrees) noexcept
+{
+    ACOW_MATH_TIME(BatchAngles, count);
+    detail::ScaleValues(pRadians, count, detail::Rad2Deg<float>(), pOut_Degrees);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Same as WrapRadians on each angle - To [-pi, pi).
+inline void
+WrapRadians(const float *pRadians, size_t count, float *pOut_Radians) noexcept
+{
+    ACOW_MATH_TIME(BatchAngles, count);
+    detail::WrapValues(pRadians, count, detail::Pi<float>(), detail::Tau<float>(), pOut_Radians);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Same as WrapDegrees on each angle - To [-180, 180).
+inline void
+WrapDegrees(const float *pDegrees, size_t count, float *pOut_Degrees) noexcept
+{
+    ACOW_MATH_TIME(BatchAngles, count);
+    detail::WrapValues(pDegrees, count, 180.0f, 360.0f, pOut_Degrees);
+}
+
+} // namespace math
+} // namespace acow
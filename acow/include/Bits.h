@@ -0,0 +1,278 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Bits.h                                                        //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Bit utilities for 8 to 64 bit integers.                                 //
+//    Uses the compiler builtins when available (they're constexpr in GCC and //
+//    Clang and become lzcnt / tzcnt / popcnt when the target has them) and   //
+//    portable single expression versions otherwise, so everything stays      //
+//    usable in constant expressions.                                         //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <limits>
+#include <type_traits>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+
+
+//----------------------------------------------------------------------------//
+// Builtins                                                                   //
+//----------------------------------------------------------------------------//
+#if !defined(ACOW_MATH_DISABLE_BUILTINS) && (defined(__GNUC__) || defined(__clang__))
+    #define ACOW_MATH_HAS_BIT_BUILTINS 1
+#else
+    #define ACOW_MATH_HAS_BIT_BUILTINS 0
+#endif // !defined(ACOW_MATH_DISABLE_BUILTINS) ...
+
+
+namespace acow { namespace math {
+
+namespace detail {
+
+//----------------------------------------------------------------------------//
+// Portable Implementation                                                    //
+//   Thanks to seander:                                                       //
+//     https://graphics.stanford.edu/~seander/bithacks.html                   //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Pop Count
+ACOW_CONSTEXPR_STRICT inline u32 PopStep1(u32 x) noexcept { return x - ((x >> 1) & 0x55555555u); }
+ACOW_CONSTEXPR_STRICT inline u32 PopStep2(u32 x) noexcept { return (x & 0x33333333u) + ((x >> 2) & 0x33333333u); }
+ACOW_CONSTEXPR_STRICT inline u32 PopStep3(u32 x) noexcept { return (((x + (x >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24; }
+
+ACOW_CONSTEXPR_STRICT inline u64 PopStep1(u64 x) noexcept { return x - ((x >> 1) & 0x5555555555555555ull); }
+ACOW_CONSTEXPR_STRICT inline u64 PopStep2(u64 x) noexcept { return (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull); }
+ACOW_CONSTEXPR_STRICT inline u64 PopStep3(u64 x) noexcept { return (((x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full) * 0x0101010101010101ull) >> 56; }
+
+ACOW_CONSTEXPR_STRICT inline i32 SoftPopCount32(u32 x) noexcept { return i32(PopStep3(PopStep2(PopStep1(x)))); }
+ACOW_CONSTEXPR_STRICT inline i32 SoftPopCount64(u64 x) noexcept { return i32(PopStep3(PopStep2(PopStep1(x)))); }
+
+//------------------------------------------------------------------------------
+// Smear - Sets every bit below the highest set bit.
+ACOW_CONSTEXPR_STRICT inline u32 SmearStep(u32 x, u32 s) noexcept { return x | (x >> s); }
+ACOW_CONSTEXPR_STRICT inline u64 SmearStep(u64 x, u32 s) noexcept { return x | (x >> s); }
+
+ACOW_CONSTEXPR_STRICT inline u32
+Smear32(u32 x) noexcept
+{
+    return SmearStep(SmearStep(SmearStep(SmearStep(SmearStep(x, 1), 2), 4), 8), 16);
+}
+
+ACOW_CONSTEXPR_STRICT inline u64
+Smear64(u64 x) noexcept
+{
+    return SmearStep(SmearStep(SmearStep(SmearStep(SmearStep(SmearStep(x, 1), 2), 4), 8), 16), 32);
+}
+
+//------------------------------------------------------------------------------
+// Leading / Trailing Zeros
+ACOW_CONSTEXPR_STRICT inline i32 SoftClz32(u32 x) noexcept { return 32 - SoftPopCount32(Smear32(x)); }
+ACOW_CONSTEXPR_STRICT inline i32 SoftClz64(u64 x) noexcept { return 64 - SoftPopCount64(Smear64(x)); }
+
+// (x & -x) isolates the lowest set bit - Zero gives all ones, so 32 / 64.
+ACOW_CONSTEXPR_STRICT inline i32 SoftCtz32(u32 x) noexcept { return SoftPopCount32((x & (0u - x)) - 1u); }
+ACOW_CONSTEXPR_STRICT inline i32 SoftCtz64(u64 x) noexcept { return SoftPopCount64((x & (0ull - x)) - 1ull); }
+
+
+//----------------------------------------------------------------------------//
+// Dispatch                                                                   //
+//----------------------------------------------------------------------------//
+#if (ACOW_MATH_HAS_BIT_BUILTINS)
+ACOW_CONSTEXPR_STRICT inline i32 PopCount32(u32 x) noexcept { return __builtin_popcount  (x); }
+ACOW_CONSTEXPR_STRICT inline i32 PopCount64(u64 x) noexcept { return __builtin_popcountll(x); }
+ACOW_CONSTEXPR_STRICT inline i32 Clz32(u32 x)      noexcept { return x ? __builtin_clz  (x) : 32; }
+ACOW_CONSTEXPR_STRICT inline i32 Clz64(u64 x)      noexcept { return x ? __builtin_clzll(x) : 64; }
+ACOW_CONSTEXPR_STRICT inline i32 Ctz32(u32 x)      noexcept { return x ? __builtin_ctz  (x) : 32; }
+ACOW_CONSTEXPR_STRICT inline i32 Ctz64(u64 x)      noexcept { return x ? __builtin_ctzll(x) : 64; }
+#else
+ACOW_CONSTEXPR_STRICT inline i32 PopCount32(u32 x) noexcept { return SoftPopCount32(x); }
+ACOW_CONSTEXPR_STRICT inline i32 PopCount64(u64 x) noexcept { return SoftPopCount64(x); }
+ACOW_CONSTEXPR_STRICT inline i32 Clz32(u32 x)      noexcept { return SoftClz32(x);      }
+ACOW_CONSTEXPR_STRICT inline i32 Clz64(u64 x)      noexcept { return SoftClz64(x);      }
+ACOW_CONSTEXPR_STRICT inline i32 Ctz32(u32 x)      noexcept { return SoftCtz32(x);      }
+ACOW_CONSTEXPR_STRICT inline i32 Ctz64(u64 x)      noexcept { return SoftCtz64(x);      }
+#endif // (ACOW_MATH_HAS_BIT_BUILTINS)
+
+//------------------------------------------------------------------------------
+// Any integer goes through its unsigned type of the same width.
+template <typename T>
+struct BitsOf
+{
+    static_assert(std::is_integral<T>::value, "Bit utilities need an integer type.");
+
+    typedef typename std::make_unsigned<T>::type Unsigned;
+    constexpr static i32 kBits = std::numeric_limits<Unsigned>::digits;
+};
+
+// 2^log2, or 0 when it doesn't fit in U.
+template <typename U>
+ACOW_CONSTEXPR_STRICT inline U
+PowerOfTwoOrZero(i32 log2) noexcept
+{
+    return (log2 >= BitsOf<U>::kBits) ? U(0) : U(U(1) << log2);
+}
+
+// The unsigned bits of a value above the max of T - The negative values
+// of a signed T, and the powers of two that only fit in its unsigned.
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline bool
+IsAboveMax(typename BitsOf<T>::Unsigned value) noexcept
+{
+    return value > typename BitsOf<T>::Unsigned(std::numeric_limits<T>::max());
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Counting                                                                   //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Number of set bits.
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline i32
+PopCount(T value) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (detail::BitsOf<T>::kBits <= 32)
+        ? detail::PopCount32(u32(U(value)))
+        : detail::PopCount64(u64(U(value)));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Number of zero bits above the highest set bit.
+/// @returns The bit width of T for 0.
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline i32
+CountLeadingZeros(T value) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (detail::BitsOf<T>::kBits <= 32)
+        ? detail::Clz32(u32(U(value))) - (32 - detail::BitsOf<T>::kBits)
+        : detail::Clz64(u64(U(value)));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Number of zero bits below the lowest set bit.
+/// @returns The bit width of T for 0.
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline i32
+CountTrailingZeros(T value) noexcept
+{
+    // Narrow types get a sentinel bit so 0 gives their width.
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (detail::BitsOf<T>::kBits < 32)
+        ? detail::Ctz32(u32(U(value)) | (1u << (detail::BitsOf<T>::kBits % 32)))
+        : (detail::BitsOf<T>::kBits == 32)
+            ? detail::Ctz32(u32(U(value)))
+            : detail::Ctz64(u64(U(value)));
+}
+
+
+//----------------------------------------------------------------------------//
+// Log2                                                                       //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief floor(log2(value)) - Index of the highest set bit.
+/// @returns -1 for 0.
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline i32
+Log2Floor(T value) noexcept
+{
+    return (detail::BitsOf<T>::kBits - 1) - CountLeadingZeros(value);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief ceil(log2(value)).
+/// @returns -1 for 0.
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline i32
+Log2Ceil(T value) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (U(value) <= 1)
+        ? Log2Floor(value)
+        : detail::BitsOf<T>::kBits - CountLeadingZeros(U(U(value) - 1));
+}
+
+
+//----------------------------------------------------------------------------//
+// Power of Two                                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Smallest power of two that is >= value.
+/// @returns 1 for 0, and 0 for negative values and when the result
+///   doesn't fit in T (so NextPOT(i32(0x7FFFFFFF)) is 0, not INT_MIN).
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline T
+NextPOT(T value) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (U(value) <= 1)
+        ? T(1)
+        : detail::IsAboveMax<T>(detail::PowerOfTwoOrZero<U>(Log2Ceil(value)))
+            ? T(0)
+            : T(detail::PowerOfTwoOrZero<U>(Log2Ceil(value)));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Largest power of two that is <= value.
+/// @returns 0 for 0 and for negative values.
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline T
+PrevPOT(T value) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (U(value) == 0 || detail::IsAboveMax<T>(U(value)))
+        ? T(0)
+        : T(U(1) << Log2Floor(value));
+}
+
+
+//----------------------------------------------------------------------------//
+// Alignment                                                                  //
+//   alignment must be a power of two.                                        //
+//----------------------------------------------------------------------------//
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline T
+AlignUp(T value, T alignment) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return T((U(value) + (U(alignment) - 1)) & ~(U(alignment) - 1));
+}
+
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline T
+AlignDown(T value, T alignment) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return T(U(value) & ~(U(alignment) - 1));
+}
+
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline bool
+IsAligned(T value, T alignment) noexcept
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (U(value) & (U(alignment) - 1)) == 0;
+}
+
+} // namespace math
+} // namespace acow
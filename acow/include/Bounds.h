@@ -0,0 +1,383 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Bounds.h                                                      //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Bounding shapes of point sets - The tightest Rect (SIMD min / max),     //
+//    the convex hull (Andrew's monotone chain) and the minimum bounding      //
+//    circle (Welzl).                                                         //
+//                                                                            //
+//    ComputeConvexHullParallel hulls slices of the points on a ThreadPool    //
+//    and merges them with a last hull over the slice hulls.                  //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Circle.h"
+#include "Instrumentation.h"
+#include "Random.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "ThreadPool.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+static_assert(sizeof(Vec2) == sizeof(float) * 2, "Vec2 must be tightly packed.");
+
+namespace detail {
+
+//----------------------------------------------------------------------------//
+// Hull Helpers                                                               //
+//----------------------------------------------------------------------------//
+inline bool
+HullLess(const Vec2 &a, const Vec2 &b) noexcept
+{
+    return (a.x < b.x) || (a.x == b.x && a.y < b.y);
+}
+
+inline bool
+HullEqual(const Vec2 &a, const Vec2 &b) noexcept
+{
+    return a.x == b.x && a.y == b.y;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Akl-Toussaint - Drops the points strictly inside the polygon of
+///   the extreme points on 8 directions, they can't be on the hull.
+///   Usually most of them.
+inline void
+GatherHullCandidates(const Vec2 *pPoints, size_t count, std::vector<Vec2> *pOut_Candidates)
+{
+    // Directions in the order of the hull: -y, x - y, x, x + y, y, y - x, -x, -x - y.
+    size_t extremes[8] = {};
+    float  best    [8];
+    for(size_t i = 0; i < count; ++i) {
+        const auto &p = pPoints[i];
+        const float values[8] = { -p.y, p.x - p.y, p.x, p.x + p.y, p.y, p.y - p.x, -p.x, -p.x - p.y };
+        for(size_t d = 0; d < 8; ++d) {
+            if(i == 0 || values[d] > best[d]) {
+                best    [d] = values[d];
+                extremes[d] = i;
+            }
+        }
+    }
+
+    // The same point can be extreme on many directions.
+    Vec2   polygon[8];
+    size_t vertices = 0;
+    for(size_t d = 0; d < 8; ++d) {
+        const auto &p = pPoints[extremes[d]];
+        if(vertices == 0 || !HullEqual(p, polygon[vertices - 1])) {
+            polygon[vertices++] = p;
+        }
+    }
+    if(vertices > 1 && HullEqual(polygon[0], polygon[vertices - 1])) {
+        --vertices;
+    }
+
+    pOut_Candidates->clear();
+    if(vertices < 3) {
+        pOut_Candidates->assign(pPoints, pPoints + count);
+        return;
+    }
+
+    // Same turning as the hull, so inside is Cross(b - a, p - a) > 0 on
+    // every edge - Written as Dot(p, normal) > offset. Always 8 edges, the
+    // missing ones wrap around to the real edges again (a point collapsed
+    // to a zero normal would be inside of nothing and keep every point).
+    float normal_x[8], normal_y[8], offset[8];
+    for(size_t e = 0; e < 8; ++e) {
+        const auto &a = polygon[ e      % vertices];
+        const auto &b = polygon[(e + 1) % vertices];
+
+        normal_x[e] = a.y - b.y;
+        normal_y[e] = b.x - a.x;
+        offset  [e] = normal_x[e] * a.x + normal_y[e] * a.y;
+    }
+
+    for(size_t i = 0; i < count; ++i) {
+        const auto &p = pPoints[i];
+
+        auto inside = true;
+        for(size_t e = 0; e < 8; ++e) {
+            inside &= (normal_x[e] * p.x + normal_y[e] * p.y) > offset[e];
+        }
+        if(!inside) {
+            pOut_Candidates->push_back(p);
+        }
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Monotone chain over the already sorted and unique points.
+inline void
+MonotoneChain(const std::vector<Vec2> &sorted, std::vector<Vec2> *pOut_Hull)
+{
+    auto n = sorted.size();
+
+    auto &hull = *pOut_Hull;
+    hull.resize(n * 2);
+
+    size_t k = 0;
+    // Lower chain.
+    for(size_t i = 0; i < n; ++i) {
+        while(k >= 2 && Cross(hull[k - 1] - hull[k - 2], sorted[i] - hull[k - 2]) <= 0.0f) {
+            --k;
+        }
+        hull[k++] = sorted[i];
+    }
+    // Upper chain - The last point is the first one again.
+    for(size_t i = n - 1, lower = k + 1; i > 0; --i) {
+        while(k >= lower && Cross(hull[k - 1] - hull[k - 2], sorted[i - 1] - hull[k - 2]) <= 0.0f) {
+            --k;
+        }
+        hull[k++] = sorted[i - 1];
+    }
+
+    hull.resize(k - 1);
+}
+
+//----------------------------------------------------------------------------//
+// Circle Helpers                                                             //
+//----------------------------------------------------------------------------//
+inline bool
+CircleHolds(const Circle &c, const Vec2 &p) noexcept
+{
+    // A bit of slack, otherwise the rounding of the circle built from the
+    // point itself can leave it outside.
+    return c.center.DistanceSqr(p) <= c.radius * c.radius * (1.0f + 1e-5f) + 1e-12f;
+}
+
+inline Circle
+CircleFrom2(const Vec2 &a, const Vec2 &b) noexcept
+{
+    auto center = (a + b) * 0.5f;
+    return Circle(center, Sqrt(center.DistanceSqr(a)));
+}
+
+inline Circle
+CircleFrom3(const Vec2 &a, const Vec2 &b, const Vec2 &c) noexcept
+{
+    // Relative to a - Keeps the precision when the points are far from 0.
+    auto ab = b - a;
+    auto ac = c - a;
+    auto d  = 2.0f * Cross(ab, ac);
+    if(d == 0.0f) {
+        // Collinear - The farthest pair covers the other point.
+        auto c0 = CircleFrom2(a, b);
+        auto c1 = CircleFrom2(a, c);
+        auto c2 = CircleFrom2(b, c);
+        return (c0.radius > c1.radius)
+            ? ((c0.radius > c2.radius) ? c0 : c2)
+            : ((c1.radius > c2.radius) ? c1 : c2);
+    }
+
+    auto ab2 = Dot(ab, ab);
+    auto ac2 = Dot(ac, ac);
+    auto o   = Vec2(
+        (ac.y * ab2 - ab.y * ac2) / d,
+        (ab.x * ac2 - ac.x * ab2) / d
+    );
+    return Circle(a + o, Sqrt(Dot(o, o)));
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Rect                                                                       //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Tightest Rect with all the points - The ones on the right and
+///   bottom edges sit on them, so Rect::Contains (half open) says false.
+/// @returns An empty Rect at 0, 0 when there's no points.
+inline Rect
+ComputeBounds(const Vec2 *pPoints, size_t count) noexcept
+{
+    ACOW_MATH_TIME(ComputeBounds, count);
+
+    if(count == 0) {
+        return Rect();
+    }
+
+    auto min_x = pPoints[0].x; auto max_x = min_x;
+    auto min_y = pPoints[0].y; auto max_y = min_y;
+
+    auto p_values = reinterpret_cast<const float*>(pPoints);
+    auto n        = count * 2;
+    size_t i      = 0;
+
+    // Interleaved x, y - Even lanes are x, odd lanes are y.
+    if(simd::kWidth % 2 == 0 && n >= simd::kWidth * 2) {
+        // Two of each, min / max latency is longer than their throughput.
+        auto v_min0 = simd::Load(p_values);
+        auto v_max0 = v_min0;
+        auto v_min1 = v_min0;
+        auto v_max1 = v_min0;
+
+        for(; i + simd::kWidth * 2 <= n; i += simd::kWidth * 2) {
+            auto a = simd::Load(p_values + i);
+            auto b = simd::Load(p_values + i + simd::kWidth);
+            v_min0 = simd::Min(v_min0, a); v_max0 = simd::Max(v_max0, a);
+            v_min1 = simd::Min(v_min1, b); v_max1 = simd::Max(v_max1, b);
+        }
+
+        float mins[simd::kWidth];
+        float maxs[simd::kWidth];
+        simd::Store(mins, simd::Min(v_min0, v_min1));
+        simd::Store(maxs, simd::Max(v_max0, v_max1));
+        for(size_t j = 0; j < simd::kWidth; j += 2) {
+            min_x = std::min(min_x, mins[j    ]); max_x = std::max(max_x, maxs[j    ]);
+            min_y = std::min(min_y, mins[j + 1]); max_y = std::max(max_y, maxs[j + 1]);
+        }
+    }
+    for(i /= 2; i < count; ++i) {
+        const auto &p = pPoints[i];
+        min_x = std::min(min_x, p.x); max_x = std::max(max_x, p.x);
+        min_y = std::min(min_y, p.y); max_y = std::max(max_y, p.y);
+    }
+
+    return Rect(min_x, min_y, max_x - min_x, max_y - min_y);
+}
+
+
+//----------------------------------------------------------------------------//
+// Convex Hull                                                                //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Vertices of the convex hull, without collinear and repeated ones.
+///   Cross(b - a, c - b) > 0 for every three in a row - Counter clockwise
+///   with y up, clockwise on the screen.
+///   Less than 3 points when all the points are on a line (or the same).
+inline void
+ComputeConvexHull(const Vec2 *pPoints, size_t count, std::vector<Vec2> *pOut_Hull)
+{
+    ACOW_MATH_TIME(ComputeConvexHull, count);
+
+    pOut_Hull->clear();
+    if(count == 0) {
+        return;
+    }
+
+    std::vector<Vec2> sorted;
+    detail::GatherHullCandidates(pPoints, count, &sorted);
+
+    std::sort(sorted.begin(), sorted.end(), detail::HullLess);
+    sorted.erase(std::unique(sorted.begin(), sorted.end(), detail::HullEqual), sorted.end());
+
+    if(sorted.size() < 3) {
+        *pOut_Hull = sorted;
+        return;
+    }
+
+    detail::MonotoneChain(sorted, pOut_Hull);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Same hull as ComputeConvexHull - Slices of grainSize points are
+///   hulled on the pool, and then the slice hulls are hulled.
+inline void
+ComputeConvexHullParallel(
+    const Vec2        *pPoints,
+    size_t             count,
+    std::vector<Vec2> *pOut_Hull,
+    size_t             grainSize = 64 * 1024,
+    ThreadPool        &pool      = ThreadPool::GetDefault())
+{
+    grainSize = std::max(grainSize, size_t(1));
+    auto slices = (count + grainSize - 1) / grainSize;
+    if(slices <= 1) {
+        ComputeConvexHull(pPoints, count, pOut_Hull);
+        return;
+    }
+
+    std::vector<std::vector<Vec2>> hulls(slices);
+    ParallelFor(0, slices, 1, [&](size_t first, size_t last) {
+        for(auto i = first; i < last; ++i) {
+            auto begin = i * grainSize;
+            auto end   = std::min(begin + grainSize, count);
+            ComputeConvexHull(pPoints + begin, end - begin, &hulls[i]);
+        }
+    }, pool);
+
+    std::vector<Vec2> merged;
+    for(const auto &hull : hulls) {
+        merged.insert(merged.end(), hull.begin(), hull.end());
+    }
+    ComputeConvexHull(merged.data(), merged.size(), pOut_Hull);
+}
+
+
+//----------------------------------------------------------------------------//
+// Circle                                                                     //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Smallest circle with all the points - Welzl, in the iterative
+///   move to front form, so it's expected O(n) without the recursion.
+///   The shuffle has a fixed seed, same points give the same circle.
+/// @returns A 0 radius circle at 0, 0 when there's no points.
+inline Circle
+ComputeBoundingCircle(const Vec2 *pPoints, size_t count)
+{
+    ACOW_MATH_TIME(ComputeBoundingCircle, count);
+
+    if(count == 0) {
+        return Circle();
+    }
+
+    // The expected O(n) needs the points in random order.
+    std::vector<Vec2> points(pPoints, pPoints + count);
+    auto rng = Pcg32(count);
+    for(size_t i = count - 1; i > 0; --i) {
+        std::swap(points[i], points[rng.NextInRange(u32(i + 1))]);
+    }
+
+    auto circle = Circle(points[0], 0.0f);
+    for(size_t i = 1; i < count; ++i) {
+        if(detail::CircleHolds(circle, points[i])) {
+            continue;
+        }
+
+        // points[i] is on the boundary.
+        circle = Circle(points[i], 0.0f);
+        for(size_t j = 0; j < i; ++j) {
+            if(detail::CircleHolds(circle, points[j])) {
+                continue;
+            }
+
+            // points[i] and points[j] are on the boundary.
+            circle = detail::CircleFrom2(points[i], points[j]);
+            for(size_t k = 0; k < j; ++k) {
+                if(!detail::CircleHolds(circle, points[k])) {
+                    circle = detail::CircleFrom3(points[i], points[j], points[k]);
+                }
+            }
+        }
+    }
+
+    return circle;
+}
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,124 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Camera2D.h                                                    //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    2D camera - A world area the size of the screen, zoomed around its      //
+//    center.                                                                 //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Rect.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+class Camera2D
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief view is the world area shown at zoom 1 - Its size is the
+    ///   screen size, in pixels. zoom > 1 shows less of the world, bigger.
+    explicit
+    Camera2D(const Rect &view, float zoom = 1.0f) noexcept
+        : m_view(view)
+        , m_zoom(zoom)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters / Setters                                                      //
+    //------------------------------------------------------------------------//
+public:
+    inline const Rect& GetView() const noexcept { return m_view; }
+    inline void        SetView(const Rect &view) noexcept { m_view = view; }
+
+    inline float GetZoom() const noexcept { return m_zoom; }
+    inline void  SetZoom(float zoom) noexcept { m_zoom = zoom; }
+
+    inline Vec2 GetCenter() const noexcept { return m_view.GetCenter(); }
+    inline void
+    SetCenter(const Vec2 &center) noexcept
+    {
+        m_view.x = center.x - m_view.w * 0.5f;
+        m_view.y = center.y - m_view.h * 0.5f;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The world area on the screen with the zoom applied.
+    inline Rect
+    GetVisibleRect() const noexcept
+    {
+        auto w = m_view.w / m_zoom;
+        auto h = m_view.h / m_zoom;
+        return Rect(
+            m_view.x + (m_view.w - w) * 0.5f,
+            m_view.y + (m_view.h - h) * 0.5f,
+            w, h
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Conversion                                                             //
+    //------------------------------------------------------------------------//
+public:
+    inline Vec2
+    WorldToScreen(const Vec2 &world) const noexcept
+    {
+        auto visible = GetVisibleRect();
+        return Vec2((world.x - visible.x) * m_zoom, (world.y - visible.y) * m_zoom);
+    }
+
+    inline Rect
+    WorldToScreen(const Rect &world) const noexcept
+    {
+        auto visible = GetVisibleRect();
+        return Rect(
+            (world.x - visible.x) * m_zoom, (world.y - visible.y) * m_zoom,
+            world.w * m_zoom,               world.h * m_zoom
+        );
+    }
+
+    inline Vec2
+    ScreenToWorld(const Vec2 &screen) const noexcept
+    {
+        auto visible = GetVisibleRect();
+        return Vec2(screen.x / m_zoom + visible.x, screen.y / m_zoom + visible.y);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Rect  m_view;
+    float m_zoom;
+
+}; // class Camera2D
+
+} // namespace math
+} // namespace acow
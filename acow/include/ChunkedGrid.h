@@ -0,0 +1,505 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ChunkedGrid.h                                                 //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Sparse, unbounded grid addressed by Coord. Cells are grouped in         //
+//    square chunks that are only allocated when first written.               //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Coord.h"
+#include "Operations.h"
+
+
+namespace acow { namespace math {
+
+template <
+    typename T,
+    i32      ChunkSize = 32,
+    i32      CacheSize = 16
+>
+class ChunkedGrid
+{
+    static_assert(IsPOT(ChunkSize), "ChunkSize must be a power of two.");
+    static_assert(IsPOT(CacheSize), "CacheSize must be a power of two.");
+
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static i32 kChunkSize      = ChunkSize;
+    constexpr static i32 kChunkArea      = (ChunkSize * ChunkSize);
+    constexpr static i32 kCacheSize      = CacheSize;
+    constexpr static i32 kChunksPerBlock = 16;
+
+    ///-------------------------------------------------------------------------
+    /// @brief A square block of cells.
+    ///   origin is the chunk coordinate (not the cell coordinate), so the
+    ///   first cell of the chunk is at (origin.y * kChunkSize,
+    ///   origin.x * kChunkSize). Cells are stored row major.
+    struct Chunk
+    {
+        Coord  origin;
+        size_t activeIndex;
+        T      cells[kChunkArea];
+
+        inline T&       At(i32 y, i32 x)       noexcept { return cells[y * kChunkSize + x]; }
+        inline const T& At(i32 y, i32 x) const noexcept { return cells[y * kChunkSize + x]; }
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief Called with a freshly allocated chunk before it's used.
+    ///   Return true if the chunk was filled (e.g. loaded from disk),
+    ///   false to have it filled with the grid's default value.
+    typedef std::function<bool(const Coord &chunkCoord, Chunk &chunk)> LoadCallback;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Called with a chunk right before it's returned to the pool.
+    ///   Gives the chance to serialize its contents.
+    typedef std::function<void(const Coord &chunkCoord, const Chunk &chunk)> EvictCallback;
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the coord of the chunk that holds the given cell.
+    /// @note Rounds towards negative infinity, so (-1, -1) is in chunk (-1, -1).
+    ACOW_CONSTEXPR_STRICT inline static Coord
+    ChunkCoordOf(const Coord &cell) noexcept
+    {
+        return Coord(FloorDiv(cell.y), FloorDiv(cell.x));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the coord of the cell relative to its chunk.
+    ACOW_CONSTEXPR_STRICT inline static Coord
+    LocalCoordOf(const Coord &cell) noexcept
+    {
+        return Coord(cell.y & (kChunkSize - 1), cell.x & (kChunkSize - 1));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs an empty grid.
+    /// @param defaultValue Value of cells that were never written.
+    explicit
+    ChunkedGrid(const T &defaultValue = T()) noexcept
+        : m_defaultValue(defaultValue)
+    {
+        ResetCache();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Evicts every chunk - So the evict callback is called for them.
+    ~ChunkedGrid()
+    {
+        Clear();
+    }
+
+    ChunkedGrid(const ChunkedGrid &)            = delete;
+    ChunkedGrid& operator=(const ChunkedGrid &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Hooks                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    inline void SetLoadCallback (const LoadCallback  &callback) { m_loadCallback  = callback; }
+    inline void SetEvictCallback(const EvictCallback &callback) { m_evictCallback = callback; }
+
+
+    //------------------------------------------------------------------------//
+    // Cell Access                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the value of the cell without allocating.
+    /// @returns The default value if the cell's chunk isn't populated.
+    inline const T&
+    Get(const Coord &cell) const noexcept
+    {
+        auto p_cell = TryGet(cell);
+        return (p_cell) ? *p_cell : m_defaultValue;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the value of the cell, allocating its chunk if needed.
+    inline void
+    Set(const Coord &cell, const T &value)
+    {
+        (*this)[cell] = value;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets a pointer to the cell without allocating.
+    /// @returns nullptr if the cell's chunk isn't populated.
+    inline T*
+    TryGet(const Coord &cell) noexcept
+    {
+        auto p_chunk = FindChunk(ChunkCoordOf(cell));
+        if(!p_chunk) {
+            return nullptr;
+        }
+
+        auto local = LocalCoordOf(cell);
+        return &p_chunk->At(local.y, local.x);
+    }
+
+    inline const T*
+    TryGet(const Coord &cell) const noexcept
+    {
+        auto p_chunk = FindChunk(ChunkCoordOf(cell));
+        if(!p_chunk) {
+            return nullptr;
+        }
+
+        auto local = LocalCoordOf(cell);
+        return &p_chunk->At(local.y, local.x);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets a reference to the cell, allocating its chunk if needed.
+    inline T&
+    operator[](const Coord &cell)
+    {
+        auto p_chunk = GetOrCreateChunk(ChunkCoordOf(cell));
+        auto local   = LocalCoordOf(cell);
+
+        return p_chunk->At(local.y, local.x);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Chunk Access                                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the chunk at the chunk coordinate without allocating.
+    /// @returns nullptr if the chunk isn't populated.
+    ///   The non-const lookups also put the chunk in the cache. The const
+    ///   ones only read it, so many threads can look up a const grid at
+    ///   the same time (as long as nothing writes to it).
+    inline Chunk*
+    FindChunk(const Coord &chunkCoord) noexcept
+    {
+        auto key  = MakeKey(chunkCoord);
+        auto &slot = m_cache[CacheSlotOf(key)];
+        if(slot.pChunk && slot.key == key) {
+            return slot.pChunk;
+        }
+
+        auto p_chunk = FindChunkInMap(key);
+        if(p_chunk) {
+            slot.key    = key;
+            slot.pChunk = p_chunk;
+        }
+
+        return p_chunk;
+    }
+
+    inline const Chunk*
+    FindChunk(const Coord &chunkCoord) const noexcept
+    {
+        auto key  = MakeKey(chunkCoord);
+        auto &slot = m_cache[CacheSlotOf(key)];
+        if(slot.pChunk && slot.key == key) {
+            return slot.pChunk;
+        }
+
+        return FindChunkInMap(key);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the chunk at the chunk coordinate, allocating it if needed.
+    inline Chunk*
+    GetOrCreateChunk(const Coord &chunkCoord)
+    {
+        auto p_chunk = FindChunk(chunkCoord);
+        if(p_chunk) {
+            return p_chunk;
+        }
+
+        p_chunk = AcquireChunk();
+        p_chunk->origin      = chunkCoord;
+        p_chunk->activeIndex = m_active.size();
+
+        if(!m_loadCallback || !m_loadCallback(chunkCoord, *p_chunk)) {
+            for(auto &cell : p_chunk->cells) {
+                cell = m_defaultValue;
+            }
+        }
+
+        auto key = MakeKey(chunkCoord);
+        m_chunks[key] = p_chunk;
+        m_active.push_back(p_chunk);
+
+        auto &slot = m_cache[CacheSlotOf(key)];
+        slot.key    = key;
+        slot.pChunk = p_chunk;
+
+        return p_chunk;
+    }
+
+    inline bool
+    HasChunk(const Coord &chunkCoord) const noexcept
+    {
+        return FindChunk(chunkCoord) != nullptr;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Number of populated chunks.
+    inline size_t GetChunkCount() const noexcept { return m_active.size(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Number of chunks allocated, populated or sitting in the pool.
+    inline size_t GetCapacity() const noexcept { return m_blocks.size() * kChunksPerBlock; }
+
+
+    //------------------------------------------------------------------------//
+    // Eviction                                                               //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Returns the chunk to the pool, calling the evict callback.
+    /// @returns false if the chunk wasn't populated.
+    inline bool
+    EvictChunk(const Coord &chunkCoord)
+    {
+        auto key = MakeKey(chunkCoord);
+        auto it  = m_chunks.find(key);
+        if(it == m_chunks.end()) {
+            return false;
+        }
+
+        auto p_chunk = it->second;
+        if(m_evictCallback) {
+            m_evictCallback(chunkCoord, *p_chunk);
+        }
+
+        // Swap and pop the active list.
+        auto p_last = m_active.back();
+        m_active[p_chunk->activeIndex] = p_last;
+        p_last->activeIndex = p_chunk->activeIndex;
+        m_active.pop_back();
+
+        auto &slot = m_cache[CacheSlotOf(key)];
+        if(slot.pChunk == p_chunk) {
+            slot.pChunk = nullptr;
+        }
+
+        m_chunks.erase(it);
+        m_freeList.push_back(p_chunk);
+
+        return true;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Evicts every chunk that the predicate returns true for.
+    /// @param pred bool(const Chunk&).
+    template <typename Pred>
+    inline size_t
+    EvictIf(Pred pred)
+    {
+        // Collect first - Eviction reorders the active list.
+        std::vector<Coord> to_evict;
+        for(auto p_chunk : m_active) {
+            if(pred(*p_chunk)) {
+                to_evict.push_back(p_chunk->origin);
+            }
+        }
+
+        for(const auto &chunk_coord : to_evict) {
+            EvictChunk(chunk_coord);
+        }
+
+        return to_evict.size();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Evicts all chunks, keeping the memory in the pool.
+    inline void
+    Clear()
+    {
+        while(!m_active.empty()) {
+            EvictChunk(m_active.back()->origin);
+        }
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Releases the pooled memory of evicted chunks.
+    /// @note Only frees when no chunk is populated, since chunks are
+    ///   allocated in blocks.
+    inline void
+    ShrinkToFit()
+    {
+        if(!m_active.empty()) {
+            return;
+        }
+
+        m_freeList.clear();
+        m_blocks  .clear();
+        ResetCache();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Iteration                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Calls func(Chunk&) for every populated chunk.
+    /// @warning Don't add or evict chunks from inside func.
+    template <typename Func>
+    inline void
+    ForEachChunk(Func func)
+    {
+        for(auto p_chunk : m_active) {
+            func(*p_chunk);
+        }
+    }
+
+    template <typename Func>
+    inline void
+    ForEachChunk(Func func) const
+    {
+        for(auto p_chunk : m_active) {
+            func(static_cast<const Chunk&>(*p_chunk));
+        }
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Calls func(const Coord &cell, T &value) for every cell of
+    ///   every populated chunk.
+    template <typename Func>
+    inline void
+    ForEachCell(Func func)
+    {
+        for(auto p_chunk : m_active) {
+            auto base_y = p_chunk->origin.y * kChunkSize;
+            auto base_x = p_chunk->origin.x * kChunkSize;
+
+            for(i32 y = 0; y < kChunkSize; ++y) {
+                for(i32 x = 0; x < kChunkSize; ++x) {
+                    func(Coord(base_y + y, base_x + x), p_chunk->At(y, x));
+                }
+            }
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    ACOW_CONSTEXPR_STRICT inline static i32
+    FloorDiv(i32 v) noexcept
+    {
+        // Plain division truncates towards zero, we want floor.
+        return (v >= 0)
+            ? (v / kChunkSize)
+            : -((-(v + 1)) / kChunkSize) - 1;
+    }
+
+    ACOW_CONSTEXPR_STRICT inline static u64
+    MakeKey(const Coord &chunkCoord) noexcept
+    {
+        return (u64(u32(chunkCoord.y)) << 32) | u64(u32(chunkCoord.x));
+    }
+
+    ACOW_CONSTEXPR_STRICT inline static size_t
+    CacheSlotOf(u64 key) noexcept
+    {
+        // Mix y and x so neighbouring chunks land in different slots.
+        return size_t((u32(key >> 32) * 0x9E3779B1u) ^ u32(key))
+             & size_t(kCacheSize - 1);
+    }
+
+    inline Chunk*
+    FindChunkInMap(u64 key) const noexcept
+    {
+        auto it = m_chunks.find(key);
+        return (it == m_chunks.end()) ? nullptr : it->second;
+    }
+
+    inline void
+    ResetCache() noexcept
+    {
+        for(auto &slot : m_cache) {
+            slot.key    = 0;
+            slot.pChunk = nullptr;
+        }
+    }
+
+    inline Chunk*
+    AcquireChunk()
+    {
+        if(m_freeList.empty()) {
+            m_blocks.emplace_back(new Chunk[kChunksPerBlock]);
+
+            auto p_block = m_blocks.back().get();
+            for(i32 i = kChunksPerBlock - 1; i >= 0; --i) {
+                m_freeList.push_back(p_block + i);
+            }
+        }
+
+        auto p_chunk = m_freeList.back();
+        m_freeList.pop_back();
+
+        return p_chunk;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    struct CacheSlot
+    {
+        u64    key;
+        Chunk *pChunk;
+    };
+
+    T m_defaultValue;
+
+    std::unordered_map<u64, Chunk*>         m_chunks;
+    std::vector<Chunk*>                     m_active;
+    std::vector<Chunk*>                     m_freeList;
+    std::vector<std::unique_ptr<Chunk[]>>   m_blocks;
+    CacheSlot                               m_cache[kCacheSize];
+
+    LoadCallback  m_loadCallback;
+    EvictCallback m_evictCallback;
+
+}; // class ChunkedGrid
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,93 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Circle.h                                                      //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Circle primitive - The overlap tests are in Overlap.h.                  //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Rect.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+struct Circle
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT
+    Circle() noexcept
+        : center(Vec2::Zero())
+        , radius(0.0f)
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT
+    Circle(const Vec2 &center, float radius) noexcept
+        : center(center)
+        , radius(radius)
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT
+    Circle(float x, float y, float radius) noexcept
+        : center(x, y)
+        , radius(radius)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline Rect
+    GetBounds() const noexcept
+    {
+        return Rect(center.x - radius, center.y - radius, radius * 2.0f, radius * 2.0f);
+    }
+
+    ACOW_CONSTEXPR_STRICT inline bool
+    Contains(const Vec2 &p) const noexcept
+    {
+        return center.DistanceSqr(p) < (radius * radius);
+    }
+
+    inline void Translate(const Vec2 &delta) noexcept { center += delta; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    Vec2  center;
+    float radius;
+
+}; // struct Circle
+
+} // namespace math
+} // namespace acow
@@ -25,8 +25,37 @@
 
 namespace acow { namespace math {
 
+//----------------------------------------------------------------------------//
+// Templated Constants                                                        //
+//   Rounded once from long double, so Pi<double> has all of its bits and     //
+//   not the ones of the float kPI.                                           //
+//                                                                            //
+//   Variable templates are C++14 - The library code uses the functions in   //
+//   detail, so it still builds as C++11 (without Pi<T> and friends).         //
+//----------------------------------------------------------------------------//
+namespace detail {
+
+template <typename T> constexpr T Pi     () noexcept { return T(3.14159265358979323846264338327950288L); }
+template <typename T> constexpr T HalfPi () noexcept { return T(1.57079632679489661923132169163975144L); }
+template <typename T> constexpr T Tau    () noexcept { return T(6.28318530717958647692528676655900577L); }
+template <typename T> constexpr T Deg2Rad() noexcept { return T(0.01745329251994329576923690768488613L); }
+template <typename T> constexpr T Rad2Deg() noexcept { return T(57.2957795130823208767981548141051703L); }
+
+} // namespace detail
+
+#if defined(__cpp_variable_templates) && (__cpp_variable_templates >= 201304)
+    template <typename T> constexpr T Pi      = detail::Pi     <T>();
+    template <typename T> constexpr T HalfPi  = detail::HalfPi <T>();
+    template <typename T> constexpr T Tau     = detail::Tau    <T>();
+    template <typename T> constexpr T Deg2Rad = detail::Deg2Rad<T>();
+    template <typename T> constexpr T Rad2Deg = detail::Rad2Deg<T>();
+#endif // defined(__cpp_variable_templates) && (__cpp_variable_templates >= 201304)
+
+
 //----------------------------------------------------------------------------//
 // Constants                                                                  //
+//   Kept bit for bit as they were - kRadians2Degrees is 1 ulp away from     //
+//   Rad2Deg<float>, the others are the same values.                          //
 //----------------------------------------------------------------------------//
 constexpr static float kPI              = float(3.14159265358979323846264338327950288);
 constexpr static float k2PI             = float(kPI * 2.0f);
@@ -0,0 +1,592 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ConvexPolygon.h                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Convex polygon with inline storage and separating axis collision        //
+//    against other polygons, Rects and circles.                              //
+//                                                                            //
+//    The axes (and the projection of the polygon on them) are cached and     //
+//    only rebuilt when the shape changes - Translate just shifts them, so    //
+//    static and moving shapes don't redo the normalization every test.       //
+//                                                                            //
+//    MTVs are the translation that the first shape needs to get out of the   //
+//    second one.                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cmath>
+#include <limits>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Circle.h"
+#include "DeterministicMath.h"
+#include "Overlap.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+//----------------------------------------------------------------------------//
+// ConvexPolygon                                                              //
+//----------------------------------------------------------------------------//
+class ConvexPolygon
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static i32 kMaxVertices = 16;
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline static ConvexPolygon
+    FromRect(const Rect &rect) noexcept
+    {
+        const Vec2 vertices[4] = {
+            rect.GetTopLeft    (),
+            rect.GetTopRight   (),
+            rect.GetBottomRight(),
+            rect.GetBottomLeft ()
+        };
+        return ConvexPolygon(vertices, 4);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Oriented box - halfExtents before the rotation.
+    inline static ConvexPolygon
+    MakeBox(const Vec2 &center, const Vec2 &halfExtents, float degrees = 0.0f) noexcept
+    {
+        Vec2 vertices[4] = {
+            Vec2(-halfExtents.x, -halfExtents.y),
+            Vec2( halfExtents.x, -halfExtents.y),
+            Vec2( halfExtents.x,  halfExtents.y),
+            Vec2(-halfExtents.x,  halfExtents.y)
+        };
+        for(auto &v : vertices) {
+            v.Rotate(degrees);
+            v += center;
+        }
+        return ConvexPolygon(vertices, 4);
+    }
+
+    inline static ConvexPolygon
+    MakeRegular(const Vec2 &center, float radius, i32 sides, float degrees = 0.0f) noexcept
+    {
+        sides = (sides < 3) ? 3 : (sides > kMaxVertices) ? kMaxVertices : sides;
+
+        Vec2 vertices[kMaxVertices];
+        for(i32 i = 0; i < sides; ++i) {
+            auto s = 0.0f;
+            auto c = 0.0f;
+            SinCos(ToRadians(degrees) + (detail::Tau<float>() * float(i) / float(sides)), &s, &c);
+            vertices[i] = center + Vec2(c * radius, s * radius);
+        }
+        return ConvexPolygon(vertices, sides);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ConvexPolygon() noexcept
+        : m_vertexCount(0)
+        , m_axisCount  (0)
+    {
+        // Empty...
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Vertices in order around the polygon, in any winding.
+    /// @note Only the first kMaxVertices are used. Convexity isn't checked.
+    ConvexPolygon(const Vec2 *pVertices, i32 count) noexcept
+        : m_vertexCount(0)
+        , m_axisCount  (0)
+    {
+        SetVertices(pVertices, count);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Vertices                                                               //
+    //------------------------------------------------------------------------//
+public:
+    inline i32         GetVertexCount()      const noexcept { return m_vertexCount;    }
+    inline const Vec2* GetVertices   ()      const noexcept { return m_vertices;       }
+    inline const Vec2& GetVertex     (i32 i) const noexcept { return m_vertices[i];    }
+
+    inline void
+    SetVertices(const Vec2 *pVertices, i32 count) noexcept
+    {
+        m_vertexCount = (count < 0) ? 0 : (count > kMaxVertices) ? kMaxVertices : count;
+        for(i32 i = 0; i < m_vertexCount; ++i) {
+            m_vertices[i] = pVertices[i];
+        }
+
+        // Keep a single winding so the normals always point outwards.
+        if(GetSignedArea() < 0.0f) {
+            for(i32 i = 0, j = m_vertexCount - 1; i < j; ++i, --j) {
+                auto t = m_vertices[i]; m_vertices[i] = m_vertices[j]; m_vertices[j] = t;
+            }
+        }
+
+        RebuildAxes();
+    }
+
+    inline Vec2
+    GetCentroid() const noexcept
+    {
+        auto sum = Vec2::Zero();
+        for(i32 i = 0; i < m_vertexCount; ++i) {
+            sum += m_vertices[i];
+        }
+        return (m_vertexCount == 0) ? sum : sum * (1.0f / float(m_vertexCount));
+    }
+
+    inline const Rect& GetBounds() const noexcept { return m_bounds; }
+
+
+    //------------------------------------------------------------------------//
+    // Axes                                                                   //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Unit outward edge normals - Parallel edges share one axis.
+    inline i32         GetAxisCount() const noexcept { return m_axisCount; }
+    inline const Vec2* GetAxes     () const noexcept { return m_axes;      }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Cached projection of the polygon on its own axis i.
+    inline void
+    GetAxisProjection(i32 i, float *pOut_Min, float *pOut_Max) const noexcept
+    {
+        *pOut_Min = m_axisMin[i];
+        *pOut_Max = m_axisMax[i];
+    }
+
+    inline void
+    Project(const Vec2 &axis, float *pOut_Min, float *pOut_Max) const noexcept
+    {
+        auto lo =  std::numeric_limits<float>::max();
+        auto hi = -std::numeric_limits<float>::max();
+        for(i32 i = 0; i < m_vertexCount; ++i) {
+            auto d = Dot(m_vertices[i], axis);
+            lo = (d < lo) ? d : lo;
+            hi = (d > hi) ? d : hi;
+        }
+        *pOut_Min = lo;
+        *pOut_Max = hi;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Transform                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Moves the polygon - The axes stay, the cache is just shifted.
+    inline void
+    Translate(const Vec2 &delta) noexcept
+    {
+        for(i32 i = 0; i < m_vertexCount; ++i) {
+            m_vertices[i] += delta;
+        }
+        for(i32 i = 0; i < m_axisCount; ++i) {
+            auto d = Dot(m_axes[i], delta);
+            m_axisMin[i] += d;
+            m_axisMax[i] += d;
+        }
+        m_bounds.Translate(delta);
+    }
+
+    inline void
+    Rotate(float degrees, const Vec2 &pivot) noexcept
+    {
+        for(i32 i = 0; i < m_vertexCount; ++i) {
+            m_vertices[i] = (m_vertices[i] - pivot).Rotated(degrees) + pivot;
+        }
+        RebuildAxes();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline bool
+    Contains(const Vec2 &p) const noexcept
+    {
+        if(m_vertexCount < 3) {
+            return false;
+        }
+
+        for(i32 i = 0; i < m_vertexCount; ++i) {
+            const auto &a = m_vertices[i];
+            const auto &b = m_vertices[(i + 1) % m_vertexCount];
+            if(Cross(b - a, p - a) < 0.0f) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    inline float
+    GetSignedArea() const noexcept
+    {
+        auto area = 0.0f;
+        for(i32 i = 0; i < m_vertexCount; ++i) {
+            area += Cross(m_vertices[i], m_vertices[(i + 1) % m_vertexCount]);
+        }
+        return area * 0.5f;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline void
+    RebuildAxes() noexcept
+    {
+        m_axisCount = 0;
+        for(i32 i = 0; i < m_vertexCount && m_vertexCount > 1; ++i) {
+            auto edge = m_vertices[(i + 1) % m_vertexCount] - m_vertices[i];
+            auto len  = edge.Magnitude();
+            if(len <= 0.0f) {
+                continue;
+            }
+
+            auto axis = Vec2(edge.y / len, -edge.x / len);
+
+            auto parallel = false;
+            for(i32 j = 0; j < m_axisCount && !parallel; ++j) {
+                parallel = std::fabs(Cross(axis, m_axes[j])) < 1e-6f;
+            }
+            if(!parallel) {
+                m_axes[m_axisCount] = axis;
+                Project(axis, &m_axisMin[m_axisCount], &m_axisMax[m_axisCount]);
+                ++m_axisCount;
+            }
+        }
+
+        auto lo = (m_vertexCount > 0) ? m_vertices[0] : Vec2::Zero();
+        auto hi = lo;
+        for(i32 i = 1; i < m_vertexCount; ++i) {
+            const auto &v = m_vertices[i];
+            lo.x = (v.x < lo.x) ? v.x : lo.x; hi.x = (v.x > hi.x) ? v.x : hi.x;
+            lo.y = (v.y < lo.y) ? v.y : lo.y; hi.y = (v.y > hi.y) ? v.y : hi.y;
+        }
+        m_bounds = Rect(lo.x, lo.y, hi.x - lo.x, hi.y - lo.y);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Vec2  m_vertices[kMaxVertices];
+    Vec2  m_axes    [kMaxVertices];
+    float m_axisMin [kMaxVertices];
+    float m_axisMax [kMaxVertices];
+    Rect  m_bounds;
+    i32   m_vertexCount;
+    i32   m_axisCount;
+
+}; // class ConvexPolygon
+
+
+namespace detail {
+
+//----------------------------------------------------------------------------//
+// SAT Helpers                                                                //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Tests one axis and keeps the smallest push seen so far.
+/// @returns false if the axis separates the intervals.
+inline bool
+SATAxis(
+    const Vec2 &axis,
+    float       aMin,
+    float       aMax,
+    float       bMin,
+    float       bMax,
+    float      *pBestDepth,
+    Vec2       *pBestMTV) noexcept
+{
+    // Push a backwards along the axis, or forwards - Whichever is shorter.
+    auto back    = aMax - bMin;
+    auto forward = bMax - aMin;
+    if(back <= 0.0f || forward <= 0.0f) {
+        return false;
+    }
+
+    auto depth = (back < forward) ? back : forward;
+    if(depth < *pBestDepth) {
+        *pBestDepth = depth;
+        *pBestMTV   = (back < forward) ? axis * -depth : axis * depth;
+    }
+    return true;
+}
+
+// Projection of an AABB on an axis.
+inline void
+ProjectRect(const Rect &r, const Vec2 &axis, float *pOut_Min, float *pOut_Max) noexcept
+{
+    auto c = Dot(r.GetCenter(), axis);
+    auto e = (r.GetWidth() * 0.5f) * std::fabs(axis.x) + (r.GetHeight() * 0.5f) * std::fabs(axis.y);
+
+    *pOut_Min = c - e;
+    *pOut_Max = c + e;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Collision                                                                  //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Separating axis test - Touching shapes don't collide.
+inline bool
+Collide(const ConvexPolygon &a, const ConvexPolygon &b, Vec2 *pOut_MTV = nullptr) noexcept
+{
+    if(!a.GetBounds().Intersects(b.GetBounds())) {
+        return false;
+    }
+
+    auto depth = std::numeric_limits<float>::max();
+    auto mtv   = Vec2::Zero();
+
+    for(i32 i = 0; i < a.GetAxisCount(); ++i) {
+        auto a_min = 0.0f; auto a_max = 0.0f;
+        auto b_min = 0.0f; auto b_max = 0.0f;
+        a.GetAxisProjection(i, &a_min, &a_max);
+        b.Project(a.GetAxes()[i], &b_min, &b_max);
+
+        if(!detail::SATAxis(a.GetAxes()[i], a_min, a_max, b_min, b_max, &depth, &mtv)) {
+            return false;
+        }
+    }
+    for(i32 i = 0; i < b.GetAxisCount(); ++i) {
+        auto a_min = 0.0f; auto a_max = 0.0f;
+        auto b_min = 0.0f; auto b_max = 0.0f;
+        a.Project(b.GetAxes()[i], &a_min, &a_max);
+        b.GetAxisProjection(i, &b_min, &b_max);
+
+        if(!detail::SATAxis(b.GetAxes()[i], a_min, a_max, b_min, b_max, &depth, &mtv)) {
+            return false;
+        }
+    }
+
+    if(pOut_MTV) *pOut_MTV = mtv;
+    return true;
+}
+
+inline bool
+Collide(const ConvexPolygon &poly, const Rect &rect, Vec2 *pOut_MTV = nullptr) noexcept
+{
+    auto depth = std::numeric_limits<float>::max();
+    auto mtv   = Vec2::Zero();
+
+    // The Rect axes - The projection of the polygon on them is its bounds.
+    const auto &bounds = poly.GetBounds();
+    if(!detail::SATAxis(Vec2(1.0f, 0.0f), bounds.GetLeft(), bounds.GetRight(),
+                        rect.GetLeft(), rect.GetRight(), &depth, &mtv) ||
+       !detail::SATAxis(Vec2(0.0f, 1.0f), bounds.GetTop(), bounds.GetBottom(),
+                        rect.GetTop(), rect.GetBottom(), &depth, &mtv))
+    {
+        return false;
+    }
+
+    for(i32 i = 0; i < poly.GetAxisCount(); ++i) {
+        const auto &axis = poly.GetAxes()[i];
+
+        auto p_min = 0.0f; auto p_max = 0.0f;
+        auto r_min = 0.0f; auto r_max = 0.0f;
+        poly.GetAxisProjection(i, &p_min, &p_max);
+        detail::ProjectRect(rect, axis, &r_min, &r_max);
+
+        if(!detail::SATAxis(axis, p_min, p_max, r_min, r_max, &depth, &mtv)) {
+            return false;
+        }
+    }
+
+    if(pOut_MTV) *pOut_MTV = mtv;
+    return true;
+}
+
+inline bool
+Collide(
+    const ConvexPolygon &poly,
+    const Vec2          &center,
+    float                radius,
+    Vec2                *pOut_MTV = nullptr) noexcept
+{
+    if(poly.GetVertexCount() == 0) {
+        return false;
+    }
+
+    auto depth = std::numeric_limits<float>::max();
+    auto mtv   = Vec2::Zero();
+
+    for(i32 i = 0; i < poly.GetAxisCount(); ++i) {
+        const auto &axis = poly.GetAxes()[i];
+
+        auto p_min = 0.0f; auto p_max = 0.0f;
+        poly.GetAxisProjection(i, &p_min, &p_max);
+
+        auto c = Dot(center, axis);
+        if(!detail::SATAxis(axis, p_min, p_max, c - radius, c + radius, &depth, &mtv)) {
+            return false;
+        }
+    }
+
+    // The axis that the polygon normals miss - Towards the closest vertex.
+    auto closest  = poly.GetVertex(0);
+    auto best_sqr = closest.DistanceSqr(center);
+    for(i32 i = 1; i < poly.GetVertexCount(); ++i) {
+        auto d = poly.GetVertex(i).DistanceSqr(center);
+        if(d < best_sqr) {
+            best_sqr = d;
+            closest  = poly.GetVertex(i);
+        }
+    }
+    if(best_sqr > 0.0f) {
+        auto axis  = (closest - center) * (1.0f / Sqrt(best_sqr));
+        auto p_min = 0.0f; auto p_max = 0.0f;
+        poly.Project(axis, &p_min, &p_max);
+
+        auto c = Dot(center, axis);
+        if(!detail::SATAxis(axis, p_min, p_max, c - radius, c + radius, &depth, &mtv)) {
+            return false;
+        }
+    }
+
+    if(pOut_MTV) *pOut_MTV = mtv;
+    return true;
+}
+
+inline bool
+Collide(const ConvexPolygon &poly, const Circle &circle, Vec2 *pOut_MTV = nullptr) noexcept
+{
+    return Collide(poly, circle.center, circle.radius, pOut_MTV);
+}
+
+
+//----------------------------------------------------------------------------//
+// Batch                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Tests the polygon against every rect, pOut_Hits[i] is 1 when
+///   they collide.
+/// @returns How many collide.
+inline size_t
+Collide(const ConvexPolygon &poly, const RectSoA &rects, u8 *pOut_Hits) noexcept
+{
+    const auto &bounds = poly.GetBounds();
+    auto b_left   = bounds.GetLeft  ();
+    auto b_right  = bounds.GetRight ();
+    auto b_top    = bounds.GetTop   ();
+    auto b_bottom = bounds.GetBottom();
+
+    // The test for one rect - Also the scalar tail.
+    auto test = [&](float x, float y, float w, float h) {
+        if(x >= b_right || x + w <= b_left || y >= b_bottom || y + h <= b_top) {
+            return false;
+        }
+        auto r = Rect(x, y, w, h);
+        for(i32 i = 0; i < poly.GetAxisCount(); ++i) {
+            auto p_min = 0.0f; auto p_max = 0.0f;
+            auto r_min = 0.0f; auto r_max = 0.0f;
+            poly.GetAxisProjection(i, &p_min, &p_max);
+            detail::ProjectRect(r, poly.GetAxes()[i], &r_min, &r_max);
+            if(r_min >= p_max || r_max <= p_min) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    size_t hits = 0;
+    size_t i    = 0;
+
+    auto v_half   = simd::Set1(0.5f);
+    auto v_left   = simd::Set1(b_left);
+    auto v_right  = simd::Set1(b_right);
+    auto v_top    = simd::Set1(b_top);
+    auto v_bottom = simd::Set1(b_bottom);
+    for(; i + simd::kWidth <= rects.count; i += simd::kWidth) {
+        auto x = simd::Load(rects.pX + i);
+        auto y = simd::Load(rects.pY + i);
+        auto w = simd::Load(rects.pW + i);
+        auto h = simd::Load(rects.pH + i);
+
+        // Rect axes.
+        auto sep = simd::Or(
+            simd::Or(simd::GreaterEqual(x, v_right),  simd::LessEqual(simd::Add(x, w), v_left)),
+            simd::Or(simd::GreaterEqual(y, v_bottom), simd::LessEqual(simd::Add(y, h), v_top))
+        );
+
+        // Polygon axes - Only while some lane is still overlapping.
+        auto hw = simd::Mul(w, v_half);
+        auto hh = simd::Mul(h, v_half);
+        auto cx = simd::Add(x, hw);
+        auto cy = simd::Add(y, hh);
+        for(i32 a = 0; a < poly.GetAxisCount() && simd::MoveMask(sep) != i32((1u << simd::kWidth) - 1); ++a) {
+            const auto &axis = poly.GetAxes()[a];
+
+            auto p_min = 0.0f; auto p_max = 0.0f;
+            poly.GetAxisProjection(a, &p_min, &p_max);
+
+            auto c = simd::MulAdd(cx, simd::Set1(axis.x), simd::Mul(cy, simd::Set1(axis.y)));
+            auto e = simd::MulAdd(
+                hw, simd::Set1(std::fabs(axis.x)),
+                simd::Mul(hh, simd::Set1(std::fabs(axis.y)))
+            );
+
+            sep = simd::Or(sep, simd::Or(
+                simd::GreaterEqual(simd::Sub(c, e), simd::Set1(p_max)),
+                simd::LessEqual   (simd::Add(c, e), simd::Set1(p_min))
+            ));
+        }
+
+        auto mask = ~simd::MoveMask(sep);
+        for(size_t j = 0; j < simd::kWidth; ++j) {
+            auto hit = u8((mask >> j) & 1);
+            pOut_Hits[i + j] = hit;
+            hits += hit;
+        }
+    }
+    for(; i < rects.count; ++i) {
+        auto hit = test(rects.pX[i], rects.pY[i], rects.pW[i], rects.pH[i]);
+        pOut_Hits[i] = u8(hit);
+        hits += hit;
+    }
+
+    return hits;
+}
+
+} // namespace math
+} // namespace acow
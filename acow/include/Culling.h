@@ -0,0 +1,351 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Culling.h                                                     //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Viewport culling of SoA Rect bounds into compact visible index lists,   //
+//    plus a uniform grid index for the static content and the conversion     //
+//    of the visible entries to integer screen rects (SDL_Rect...).           //
+//                                                                            //
+//      auto visible = camera.GetVisibleRect();                               //
+//      auto n       = Cull(visible, sprites, indices.data());                //
+//      ToScreenRects(camera, sprites, indices.data(), n, sdl_rects.data());  //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Bits.h"
+#include "Camera2D.h"
+#include "Instrumentation.h"
+#include "Overlap.h"
+#include "Rect.h"
+#include "SIMD.h"
+
+
+namespace acow { namespace math {
+
+//----------------------------------------------------------------------------//
+// Cull                                                                       //
+//   Same test as Overlaps(Rect, Rect) - Touching edges aren't visible.       //
+//   pOut_Indices must fit all the tested entries.                            //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Writes the indices of the bounds that overlap visible, in order.
+/// @returns How many were written.
+inline size_t
+Cull(const Rect &visible, const RectSoA &bounds, u32 *pOut_Indices) noexcept
+{
+    ACOW_MATH_TIME(Cull, bounds.count);
+
+    auto view  = detail::BroadcastLanes(visible);
+    auto count = bounds.count;
+
+    size_t i = 0;
+    size_t n = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        auto mask = u32(simd::MoveMask(detail::OverlapLanes(view, detail::LoadLanes(bounds, i))));
+
+        // Compress - Only the set lanes are written.
+        while(mask != 0) {
+            pOut_Indices[n++] = u32(i) + u32(CountTrailingZeros(mask));
+            mask &= mask - 1;
+        }
+    }
+    for(; i < count; ++i) {
+        pOut_Indices[n] = u32(i);
+        n += Overlaps(visible, detail::GetElement(bounds, i)) ? 1 : 0;
+    }
+    return n;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Only tests the candidates - e.g. what a spatial index gave.
+inline size_t
+Cull(
+    const Rect    &visible,
+    const RectSoA &bounds,
+    const u32     *pCandidates,
+    size_t         candidatesCount,
+    u32           *pOut_Indices) noexcept
+{
+    ACOW_MATH_TIME(Cull, candidatesCount);
+
+    size_t n = 0;
+    for(size_t i = 0; i < candidatesCount; ++i) {
+        auto index = pCandidates[i];
+        pOut_Indices[n] = index;
+        n += Overlaps(visible, detail::GetElement(bounds, index)) ? 1 : 0;
+    }
+    return n;
+}
+
+
+//----------------------------------------------------------------------------//
+// Screen Rects                                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Converts the entries at pIndices to screen space, in one pass.
+///   ScreenRect is SDL_Rect or anything with i32 x, y, w, h.
+///   The edges are rounded to the nearest pixel and the sizes taken from
+///   them, so rects that share an edge in the world share it on screen.
+template <typename ScreenRect>
+inline void
+ToScreenRects(
+    const Camera2D &camera,
+    const RectSoA  &bounds,
+    const u32      *pIndices,
+    size_t          count,
+    ScreenRect     *pOut_Rects) noexcept
+{
+    auto visible = camera.GetVisibleRect();
+    auto zoom    = camera.GetZoom();
+
+    // Rounded as floor(v + 0.5) with the 0.5 folded in the offsets.
+    auto offset_x = 0.5f - visible.x * zoom;
+    auto offset_y = 0.5f - visible.y * zoom;
+
+    for(size_t i = 0; i < count; ++i) {
+        auto index = pIndices[i];
+        auto x     = bounds.pX[index];
+        auto y     = bounds.pY[index];
+
+        auto left   = i32(std::floor(x                   * zoom + offset_x));
+        auto top    = i32(std::floor(y                   * zoom + offset_y));
+        auto right  = i32(std::floor((x + bounds.pW[index]) * zoom + offset_x));
+        auto bottom = i32(std::floor((y + bounds.pH[index]) * zoom + offset_y));
+
+        pOut_Rects[i].x = left;
+        pOut_Rects[i].y = top;
+        pOut_Rects[i].w = right  - left;
+        pOut_Rects[i].h = bottom - top;
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// StaticCullIndex                                                            //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Uniform grid over bounds that don't move - Built once, then each
+///   query only tests the entries of the cells the view touches.
+///   Entries bigger than kMaxCellsPerEntry cells are tested on every query.
+class StaticCullIndex
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static u32 kMaxCellsPerEntry = 64;
+    constexpr static i32 kMaxCellsPerAxis  = 4096;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    StaticCullIndex() noexcept
+        : m_cellSize(1.0f)
+        , m_columns (0)
+        , m_rows    (0)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Build / Query                                                          //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Indexes the bounds (which are copied) - cellSize around the
+    ///   view size / 4 is usually good. It grows if the grid gets too big.
+    inline void
+    Build(const RectSoA &bounds, float cellSize)
+    {
+        m_rects.resize(bounds.count);
+        m_oversized.clear();
+        m_cellStarts.clear();
+        m_entries.clear();
+        m_columns = 0;
+        m_rows    = 0;
+
+        if(bounds.count == 0) {
+            return;
+        }
+
+        auto min_x = bounds.pX[0];
+        auto min_y = bounds.pY[0];
+        auto max_x = min_x;
+        auto max_y = min_y;
+        for(size_t i = 0; i < bounds.count; ++i) {
+            m_rects[i] = detail::GetElement(bounds, i);
+            min_x = std::min(min_x, m_rects[i].GetLeft  ());
+            min_y = std::min(min_y, m_rects[i].GetTop   ());
+            max_x = std::max(max_x, m_rects[i].GetRight ());
+            max_y = std::max(max_y, m_rects[i].GetBottom());
+        }
+
+        // Enough cells to split the entries, not so many to waste memory.
+        auto max_cells = double(bounds.count) * 4.0 + 16.0;
+        auto area      = double(max_x - min_x) * double(max_y - min_y);
+        if(area / (double(cellSize) * double(cellSize)) > max_cells) {
+            cellSize = float(std::sqrt(area / max_cells));
+        }
+        cellSize = std::max(cellSize, 1e-6f);
+
+        m_origin   = Vec2(min_x, min_y);
+        m_cellSize = cellSize;
+        m_columns  = i32(std::min(double(kMaxCellsPerAxis), std::ceil(double(max_x - min_x) / cellSize) + 1.0));
+        m_rows     = i32(std::min(double(kMaxCellsPerAxis), std::ceil(double(max_y - min_y) / cellSize) + 1.0));
+
+        // Counting sort of the entries into the cells - Counts, offsets, fill.
+        m_cellStarts.assign(size_t(m_columns) * size_t(m_rows) + 1, 0);
+        ForEachEntryCell(true, [this](size_t cell, u32) { ++m_cellStarts[cell + 1]; });
+        for(size_t i = 1; i < m_cellStarts.size(); ++i) {
+            m_cellStarts[i] += m_cellStarts[i - 1];
+        }
+
+        m_entries.resize(m_cellStarts.back());
+        auto cursors = std::vector<u32>(m_cellStarts.begin(), m_cellStarts.end() - 1);
+        ForEachEntryCell(false, [this, &cursors](size_t cell, u32 entry) {
+            m_entries[cursors[cell]++] = entry;
+        });
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Appends the indices of the entries that overlap visible - Each
+    ///   one once, in no particular order.
+    /// @returns How many were appended.
+    inline size_t
+    Query(const Rect &visible, std::vector<u32> *pOut_Indices) const
+    {
+        ACOW_MATH_TIME(CullIndexQuery, 1);
+
+        auto start = pOut_Indices->size();
+        for(auto entry : m_oversized) {
+            if(Overlaps(visible, m_rects[entry])) {
+                pOut_Indices->push_back(entry);
+            }
+        }
+
+        if(m_columns == 0 || visible.GetRight () <= m_origin.x
+                          || visible.GetBottom() <= m_origin.y) {
+            return pOut_Indices->size() - start;
+        }
+
+        auto x0 = ColumnOf(visible.GetLeft ());
+        auto x1 = ColumnOf(visible.GetRight ());
+        auto y0 = RowOf   (visible.GetTop  ());
+        auto y1 = RowOf   (visible.GetBottom());
+        for(auto y = y0; y <= y1; ++y) {
+            for(auto x = x0; x <= x1; ++x) {
+                auto cell = size_t(y) * size_t(m_columns) + size_t(x);
+                for(auto i = m_cellStarts[cell]; i < m_cellStarts[cell + 1]; ++i) {
+                    auto        entry = m_entries[i];
+                    const auto &rect  = m_rects[entry];
+                    if(!Overlaps(visible, rect)) {
+                        continue;
+                    }
+
+                    // Reported only by the cell that has the top left corner
+                    // of the overlap - The entry may be in many cells.
+                    auto ref_x = std::max(rect.GetLeft(), visible.GetLeft());
+                    auto ref_y = std::max(rect.GetTop (), visible.GetTop ());
+                    if(ColumnOf(ref_x) == x && RowOf(ref_y) == y) {
+                        pOut_Indices->push_back(entry);
+                    }
+                }
+            }
+        }
+        return pOut_Indices->size() - start;
+    }
+
+    inline size_t GetEntriesCount() const noexcept { return m_rects.size(); }
+    inline float  GetCellSize    () const noexcept { return m_cellSize;     }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline i32
+    ColumnOf(float x) const noexcept
+    {
+        auto c = std::floor((x - m_origin.x) / m_cellSize);
+        return (c < 0.0f) ? 0 : (c >= float(m_columns - 1)) ? m_columns - 1 : i32(c);
+    }
+
+    inline i32
+    RowOf(float y) const noexcept
+    {
+        auto r = std::floor((y - m_origin.y) / m_cellSize);
+        return (r < 0.0f) ? 0 : (r >= float(m_rows - 1)) ? m_rows - 1 : i32(r);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Calls func(cell, entry) for every cell of every entry that
+    ///   isn't oversized - Those go to m_oversized when collectOversized.
+    template <typename Func>
+    inline void
+    ForEachEntryCell(bool collectOversized, Func func)
+    {
+        for(size_t i = 0; i < m_rects.size(); ++i) {
+            const auto &rect = m_rects[i];
+
+            auto x0 = ColumnOf(rect.GetLeft ());
+            auto x1 = ColumnOf(rect.GetRight ());
+            auto y0 = RowOf   (rect.GetTop  ());
+            auto y1 = RowOf   (rect.GetBottom());
+            if(u64(x1 - x0 + 1) * u64(y1 - y0 + 1) > kMaxCellsPerEntry) {
+                if(collectOversized) {
+                    m_oversized.push_back(u32(i));
+                }
+                continue;
+            }
+
+            for(auto y = y0; y <= y1; ++y) {
+                for(auto x = x0; x <= x1; ++x) {
+                    func(size_t(y) * size_t(m_columns) + size_t(x), u32(i));
+                }
+            }
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Vec2              m_origin;
+    float             m_cellSize;
+    i32               m_columns;
+    i32               m_rows;
+    std::vector<Rect> m_rects;
+    std::vector<u32>  m_oversized;
+    std::vector<u32>  m_cellStarts;  // Columns * rows + 1 - CSR offsets.
+    std::vector<u32>  m_entries;
+
+}; // class StaticCullIndex
+
+} // namespace math
+} // namespace acow
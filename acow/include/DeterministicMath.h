@@ -0,0 +1,336 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : DeterministicMath.h                                           //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    sqrt / sin / cos with a fixed algorithm, so Vec2 gives the same bits    //
+//    everywhere when ACOW_MATH_DETERMINISTIC is on (see CMakeLists.txt, it   //
+//    also turns off FMA contraction, which is needed for this to hold).      //
+//    GCC ignores the FP_CONTRACT pragma, so defining the macro by hand       //
+//    there also needs -ffp-contract=off and ACOW_MATH_FP_CONTRACT_OFF=1.     //
+//                                                                            //
+//    Sqrt and SinCos are what Vec2 calls - They pick the deterministic       //
+//    versions when the mode is on and the libm ones otherwise. Inside of     //
+//    constant evaluation they use ConstexprSqrt and DetSinCos, so Vec2       //
+//    tables (directions, rotations, shapes) can be constexpr.                //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <limits>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "LibrarySupport.h"
+
+
+//----------------------------------------------------------------------------//
+// Mode                                                                       //
+//----------------------------------------------------------------------------//
+#if !defined(ACOW_MATH_DETERMINISTIC)
+    #define ACOW_MATH_DETERMINISTIC 0
+#endif // !defined(ACOW_MATH_DETERMINISTIC)
+
+#if (ACOW_MATH_DETERMINISTIC)
+    // x87 keeps intermediates in 80 bits, so results depend on register
+    // spills - Nothing can be deterministic on top of that.
+    #if defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD != 0)
+        #error "ACOW_MATH_DETERMINISTIC needs FLT_EVAL_METHOD == 0 (use SSE2 on x86)."
+    #endif // defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD != 0)
+
+    // Only clang honors the pragma - GCC has to get -ffp-contract=off,
+    // which can't be detected, so the build says it did.
+    #if defined(__clang__)
+        #pragma STDC FP_CONTRACT OFF
+    #elif defined(__GNUC__) && !(ACOW_MATH_FP_CONTRACT_OFF)
+        #error "ACOW_MATH_DETERMINISTIC needs -ffp-contract=off on GCC (use the CMake option, or pass it and define ACOW_MATH_FP_CONTRACT_OFF=1)."
+    #endif // defined(__clang__)
+#endif // (ACOW_MATH_DETERMINISTIC)
+
+
+namespace acow { namespace math {
+
+//----------------------------------------------------------------------------//
+// Constexpr Functions                                                        //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief sqrt that can run in constant evaluation - Same bits as the
+///   hardware one: the Newton steps in double end within 1 double ulp,
+///   and the sqrt of a float is never that close to a float midpoint, so
+///   rounding it to float is exact. Slow, meant for the compiler only.
+ACOW_CONSTEXPR_LOOSE inline float
+ConstexprSqrt(float v) noexcept
+{
+    if(v != v || v == 0.0f || v == std::numeric_limits<float>::infinity()) {
+        return v;
+    }
+    if(v < 0.0f) {
+        return std::numeric_limits<float>::quiet_NaN();
+    }
+
+    // Brings d to [1, 4) by powers of 4 - Exact, and sqrt(4^k) = 2^k.
+    auto d     = double(v);
+    auto scale = 1.0;
+    while(d >= 4.0) { d *= 0.25; scale *= 2.0; }
+    while(d <  1.0) { d *= 4.0;  scale *= 0.5; }
+
+    // 0.5 relative error at most, 6 steps get past double precision.
+    auto r = 1.5;
+    for(int i = 0; i < 6; ++i) {
+        r = 0.5 * (r + d / r);
+    }
+    return float(r * scale);
+}
+
+
+//----------------------------------------------------------------------------//
+// Deterministic Functions                                                    //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief sqrt is one of the operations that IEEE 754 requires to be
+///   correctly rounded, so the hardware instruction (sqrtss, fsqrt...)
+///   already gives the same bits everywhere.
+ACOW_CONSTEXPR_LOOSE inline float
+DetSqrt(float v) noexcept
+{
+    if(ACOW_MATH_IS_CONSTANT_EVALUATED()) {
+        return ConstexprSqrt(v);
+    }
+    return std::sqrt(v);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Sine and cosine of an angle in radians.
+///   Cody-Waite reduction to [-pi/4, pi/4] and the fdlibm kernel
+///   polynomials, all in double with +, -, * only. Error below 1 float
+///   ulp for |radians| < ~1e6. Works in constant evaluation as well.
+///   NaN for NaN / inf, and for |radians| >= ~6e18 where the quadrant
+///   doesn't fit in an i64 anymore.
+ACOW_CONSTEXPR_LOOSE inline void
+DetSinCos(float radians, float *pOut_Sin, float *pOut_Cos) noexcept
+{
+    // pi/2 split in 3 parts - The first has 33 bits so q * part is exact.
+    constexpr double kPio2_1   = 1.57079632673412561417e+00;
+    constexpr double kPio2_2   = 6.07710050630396597660e-11;
+    constexpr double kPio2_3   = 2.02226624879595063154e-21;
+    constexpr double kInvPio2  = 6.36619772367581382433e-01;
+
+    constexpr double S1 = -1.66666666666666324348e-01;
+    constexpr double S2 =  8.33333333332248946124e-03;
+    constexpr double S3 = -1.98412698298579493134e-04;
+    constexpr double S4 =  2.75573137070700676789e-06;
+    constexpr double S5 = -2.50507602534068634195e-08;
+    constexpr double S6 =  1.58969099521155010221e-10;
+
+    constexpr double C1 =  4.16666666666666019037e-02;
+    constexpr double C2 = -1.38888888888741095749e-03;
+    constexpr double C3 =  2.48015872894767294178e-05;
+    constexpr double C4 = -2.75573143513906633035e-07;
+    constexpr double C5 =  2.08757232129817482790e-09;
+    constexpr double C6 = -1.13596475577881948265e-11;
+
+    auto x  = double(radians);
+    auto fq = x * kInvPio2;
+    // Converting those to i64 is UB - NaN fails both of the tests.
+    if(!(fq > -4.0e18 && fq < 4.0e18)) {
+        if(pOut_Sin) *pOut_Sin = std::numeric_limits<float>::quiet_NaN();
+        if(pOut_Cos) *pOut_Cos = std::numeric_limits<float>::quiet_NaN();
+        return;
+    }
+
+    auto q  = i64(fq + ((fq >= 0.0) ? 0.5 : -0.5));
+    auto dq = double(q);
+
+    auto r = ((x - dq * kPio2_1) - dq * kPio2_2) - dq * kPio2_3;
+    auto z = r * r;
+
+    auto s = r + (r * z) * (S1 + z * (S2 + z * (S3 + z * (S4 + z * (S5 + z * S6)))));
+    auto c = (1.0 - 0.5 * z) + (z * z) * (C1 + z * (C2 + z * (C3 + z * (C4 + z * (C5 + z * C6)))));
+
+    auto sin_v = 0.0;
+    auto cos_v = 0.0;
+    switch(q & 3) {
+        case 0 : sin_v =  s; cos_v =  c; break;
+        case 1 : sin_v =  c; cos_v = -s; break;
+        case 2 : sin_v = -s; cos_v = -c; break;
+        default: sin_v = -c; cos_v =  s; break;
+    }
+
+    if(pOut_Sin) *pOut_Sin = float(sin_v);
+    if(pOut_Cos) *pOut_Cos = float(cos_v);
+}
+
+
+//----------------------------------------------------------------------------//
+// Dispatch                                                                   //
+//----------------------------------------------------------------------------//
+ACOW_CONSTEXPR_LOOSE inline float
+Sqrt(float v) noexcept
+{
+    if(ACOW_MATH_IS_CONSTANT_EVALUATED()) {
+        return ConstexprSqrt(v);
+    }
+
+    #if (ACOW_MATH_DETERMINISTIC)
+        return DetSqrt(v);
+    #else
+        return sqrtf(v);
+    #endif // (ACOW_MATH_DETERMINISTIC)
+}
+
+ACOW_CONSTEXPR_LOOSE inline void
+SinCos(float radians, float *pOut_Sin, float *pOut_Cos) noexcept
+{
+    // Can be 1 ulp off of the libm results of the same build.
+    if(ACOW_MATH_IS_CONSTANT_EVALUATED()) {
+        DetSinCos(radians, pOut_Sin, pOut_Cos);
+        return;
+    }
+
+    #if (ACOW_MATH_DETERMINISTIC)
+        DetSinCos(radians, pOut_Sin, pOut_Cos);
+    #else
+        if(pOut_Sin) *pOut_Sin = sinf(radians);
+        if(pOut_Cos) *pOut_Cos = cosf(radians);
+    #endif // (ACOW_MATH_DETERMINISTIC)
+}
+
+
+//----------------------------------------------------------------------------//
+// Golden Values                                                              //
+//----------------------------------------------------------------------------//
+namespace detail {
+
+struct DetGolden
+{
+    u32 input;
+    u32 sqrtBits;
+    u32 sinBits;
+    u32 cosBits;
+};
+
+constexpr DetGolden kDetGolden[] = {
+    {0x00000000u, 0x00000000u, 0x00000000u, 0x3F800000u}, // 0
+    {0x3F000000u, 0x3F3504F3u, 0x3EF57744u, 0x3F60A940u}, // 0.5
+    {0x3F800000u, 0x3F800000u, 0x3F576AA4u, 0x3F0A5140u}, // 1
+    {0x40000000u, 0x3FB504F3u, 0x3F68C7B7u, 0xBED51133u}, // 2
+    {0x40490FDBu, 0x3FE2DFC5u, 0xB3BBBD2Eu, 0xBF800000u}, // 3.14159
+    {0x41200000u, 0x404A62C2u, 0xBF0B44F8u, 0xBF56CD64u}, // 10
+    {0x42C80000u, 0x41200000u, 0xBF01A12Eu, 0x3F5CC0EEu}, // 100
+    {0x4640E6B6u, 0x42DE38E3u, 0xBF344B08u, 0x3F35BE20u}, // 12345.7
+    {0x3A83126Fu, 0x3D0186E3u, 0x3A83126Eu, 0x3F7FFFF8u}, // 0.001
+    {0x358637BDu, 0x3A83126Fu, 0x358637BDu, 0x3F800000u}, // 1e-06
+    {0x3FC90FDBu, 0x3FA06C99u, 0x3F800000u, 0xB33BBD2Eu}, // 1.5708
+    {0x40E00000u, 0x402953FDu, 0x3F283046u, 0x3F40FFBDu}, // 7
+    {0x49742400u, 0x447A0000u, 0xBEB33259u, 0x3F6FCEFDu}, // 1e+06
+    {0x00D9C7DDu, 0x2026F5FBu, 0x00D9C7DDu, 0x3F800000u}, // 2e-38
+    {0xC0000000u, 0x3FB504F3u, 0xBF68C7B7u, 0xBED51133u}, // -2
+    {0xC640E6B6u, 0x42DE38E3u, 0x3F344B08u, 0x3F35BE20u}, // -12345.7
+};
+
+///-----------------------------------------------------------------------------
+/// @brief The float of the bits, with arithmetic only so it is constexpr
+///   - Exact: every float is a 24 bit integer times a power of two, and
+///   double has the bits and range for both.
+ACOW_CONSTEXPR_LOOSE inline float
+FloatFromBits(u32 bits) noexcept
+{
+    auto exponent = i32((bits >> 23) & 0xFFu);
+    auto mantissa = double(bits & 0x7FFFFFu);
+    if(exponent != 0) {
+        mantissa += double(0x800000u);
+    } else {
+        exponent = 1;
+    }
+
+    auto v = mantissa;
+    for(auto e = exponent; e > 150; --e) { v *= 2.0; }
+    for(auto e = exponent; e < 150; ++e) { v *= 0.5; }
+    return float((bits & 0x80000000u) ? -v : v);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief kDetGolden against the constant evaluation of the same code.
+///   What the compiler computes has no FMA and no excess precision, so
+///   this catches changes to the algorithm and the constants - Not the
+///   build flags, that's what VerifyDeterministicMath is for.
+ACOW_CONSTEXPR_LOOSE inline bool
+CheckDetGolden() noexcept
+{
+    for(const auto &golden : kDetGolden) {
+        auto v = FloatFromBits(golden.input);
+        auto s = 0.0f;
+        auto c = 0.0f;
+        DetSinCos(v, &s, &c);
+
+        auto abs_v = (v < 0.0f) ? -v : v;
+        if(ConstexprSqrt(abs_v) != FloatFromBits(golden.sqrtBits) ||
+           s                    != FloatFromBits(golden.sinBits ) ||
+           c                    != FloatFromBits(golden.cosBits ))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// C++14 constexpr only - The loops aren't constant expressions in C++11,
+// where tests/DeterministicMathTest.cpp still checks the same table.
+#if defined(__cpp_constexpr) && (__cpp_constexpr >= 201304)
+    static_assert(CheckDetGolden(), "DetSinCos / ConstexprSqrt don't match the golden values.");
+#endif // defined(__cpp_constexpr) && (__cpp_constexpr >= 201304)
+
+} // namespace detail
+
+///-----------------------------------------------------------------------------
+/// @brief Checks the deterministic functions against baked results.
+///   Call it when a lockstep session starts (or in CI for every target):
+///   false means this build diverges from the reference and replays /
+///   peers won't stay in sync. acow_math_benchmarks runs it on start.
+inline bool
+VerifyDeterministicMath() noexcept
+{
+    auto to_bits = [](float f) {
+        u32 b = 0;
+        std::memcpy(&b, &f, sizeof(b));
+        return b;
+    };
+
+    for(const auto &golden : detail::kDetGolden) {
+        auto v = 0.0f;
+        std::memcpy(&v, &golden.input, sizeof(v));
+
+        auto s = 0.0f;
+        auto c = 0.0f;
+        DetSinCos(v, &s, &c);
+
+        // sqrt of |v| - The NaN of a negative sqrt isn't the same everywhere.
+        if(to_bits(DetSqrt(std::fabs(v))) != golden.sqrtBits ||
+           to_bits(s)                     != golden.sinBits  ||
+           to_bits(c)                     != golden.cosBits)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,393 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : DistanceField.h                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Distance from every cell of a grid to the nearest obstacle cell, in     //
+//    cells - For influence maps, SDF rendering effects, etc.                 //
+//                                                                            //
+//    Grids are row major, cell Coord(y, x) is at [y * width + x], and a      //
+//    mask cell != 0 is an obstacle (or, for the signed field, the shape).    //
+//                                                                            //
+//      - ComputeDistanceField       : Exact euclidean (Felzenszwalb &        //
+//                                     Huttenlocher), rows and columns on     //
+//                                     the ThreadPool.                        //
+//      - ComputeSignedDistanceField : Same, negative inside of the shape.    //
+//      - ComputeChamferDistanceField: Two pass chamfer approximation.        //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Instrumentation.h"
+#include "SIMD.h"
+#include "ThreadPool.h"
+#include "TileCollisionMap.h"
+
+
+namespace acow { namespace math {
+
+//----------------------------------------------------------------------------//
+// Enums / Constants / Typedefs                                               //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Weights of the axial / diagonal steps of the chamfer passes.
+enum class ChamferMetric : u32
+{
+    Manhattan,    // 1, 2       - |dx| + |dy|.
+    Chessboard,   // 1, 1       - max(|dx|, |dy|).
+    Chamfer3_4,   // 1, 4/3     - Borgefors 3-4, up to ~6% off euclidean.
+    ChamferSqrt2, // 1, sqrt(2) - Octagonal, up to ~8% over euclidean.
+}; // enum class ChamferMetric
+
+
+namespace detail {
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Columns of the column pass and rows of the row pass per chunk.
+constexpr static size_t kDistanceColumnsGrain = 256;
+constexpr static size_t kDistanceRowsGrain    = 16;
+
+///-----------------------------------------------------------------------------
+/// @brief pDistances[i] = min(pDistances[i], pNeighbors[i] + step) -
+///   The vertical part of the passes, which has no dependency along x.
+inline void
+RelaxWithRow(float *pDistances, const float *pNeighbors, size_t count, float step) noexcept
+{
+    auto v_step = simd::Set1(step);
+
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        auto d = simd::Load(pDistances + i);
+        auto n = simd::Add(simd::Load(pNeighbors + i), v_step);
+        simd::Store(pDistances + i, simd::Min(d, n));
+    }
+    for(; i < count; ++i) {
+        pDistances[i] = std::min(pDistances[i], pNeighbors[i] + step);
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Distance along the column to the nearest obstacle of the column,
+///   for the columns [x0, x1) - far when the column has none.
+///   Two sweeps over the rows, each row updated as a whole with SIMD.
+/// @returns If any of the columns has an obstacle.
+inline bool
+ComputeColumnDistances(
+    const u8 *pMask,
+    bool      invert,
+    i32       width,
+    i32       height,
+    size_t    x0,
+    size_t    x1,
+    float     far,
+    float    *pOut_Distances) noexcept
+{
+    auto count = x1 - x0;
+    auto found = false;
+    for(i32 y = 0; y < height; ++y) {
+        auto p_mask = pMask          + size_t(y) * size_t(width) + x0;
+        auto p_row  = pOut_Distances + size_t(y) * size_t(width) + x0;
+        for(size_t i = 0; i < count; ++i) {
+            auto obstacle = ((p_mask[i] != 0) != invert);
+            p_row[i] = (obstacle) ? 0.0f : far;
+            found   |= obstacle;
+        }
+        if(y > 0) {
+            RelaxWithRow(p_row, p_row - width, count, 1.0f);
+        }
+    }
+    for(i32 y = height - 2; y >= 0; --y) {
+        auto p_row = pOut_Distances + size_t(y) * size_t(width) + x0;
+        RelaxWithRow(p_row, p_row + width, count, 1.0f);
+    }
+    return found;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Lower envelope of the parabolas (x - q)^2 + f(q) of one row, in
+///   place: pRow has the column distances coming in and the euclidean
+///   distances going out. Scratch has 3 * width + 1 doubles.
+///   Doubles keep the squared distances exact past 4k x 4k.
+inline void
+ComputeRowDistances(float *pRow, i32 width, double *pScratch) noexcept
+{
+    auto p_f = pScratch;
+    auto p_z = pScratch + width;
+    auto p_v = pScratch + 2 * width + 1;
+
+    for(i32 q = 0; q < width; ++q) {
+        p_f[q] = double(pRow[q]) * double(pRow[q]);
+    }
+
+    auto inf = std::numeric_limits<double>::infinity();
+    auto k   = 0;
+    p_v[0] = 0.0;
+    p_z[0] = -inf;
+    p_z[1] = +inf;
+    for(i32 q = 1; q < width; ++q) {
+        // z[0] is -inf, so k never goes under 0 - f is always finite.
+        auto dq = double(q);
+        auto s  = 0.0;
+        while(true) {
+            auto v = p_v[k];
+            s = ((p_f[q] + dq * dq) - (p_f[i32(v)] + v * v)) / (2.0 * (dq - v));
+            if(s > p_z[k]) {
+                break;
+            }
+            --k;
+        }
+
+        ++k;
+        p_v[k]     = dq;
+        p_z[k]     = s;
+        p_z[k + 1] = +inf;
+    }
+
+    k = 0;
+    for(i32 q = 0; q < width; ++q) {
+        while(p_z[k + 1] < double(q)) {
+            ++k;
+        }
+        auto dx = double(q) - p_v[k];
+        pRow[q] = float(dx * dx + p_f[i32(p_v[k])]);
+    }
+
+    auto i = 0;
+    for(; i + i32(simd::kWidth) <= width; i += i32(simd::kWidth)) {
+        simd::Store(pRow + i, simd::Sqrt(simd::Load(pRow + i)));
+    }
+    for(; i < width; ++i) {
+        pRow[i] = std::sqrt(pRow[i]);
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @returns false when there are no obstacles - pOut_Distances is all +inf.
+inline bool
+ComputeExactDistances(
+    const u8   *pMask,
+    bool        invert,
+    i32         width,
+    i32         height,
+    float      *pOut_Distances,
+    ThreadPool &pool)
+{
+    // Bigger than any distance in the grid, and still finite when squared.
+    auto far   = float(width) + float(height);
+    auto found = std::vector<u8>((size_t(width) + kDistanceColumnsGrain - 1) / kDistanceColumnsGrain, 0);
+
+    ParallelFor(0, size_t(width), kDistanceColumnsGrain, [&](size_t x0, size_t x1) {
+        auto any = ComputeColumnDistances(pMask, invert, width, height, x0, x1, far, pOut_Distances);
+        found[x0 / kDistanceColumnsGrain] = (any) ? 1 : 0;
+    }, pool);
+
+    if(std::find(found.begin(), found.end(), u8(1)) == found.end()) {
+        std::fill(
+            pOut_Distances,
+            pOut_Distances + size_t(width) * size_t(height),
+            std::numeric_limits<float>::infinity()
+        );
+        return false;
+    }
+
+    ParallelFor(0, size_t(height), kDistanceRowsGrain, [&](size_t y0, size_t y1) {
+        auto scratch = std::vector<double>(3 * size_t(width) + 1);
+        for(auto y = y0; y < y1; ++y) {
+            ComputeRowDistances(pOut_Distances + y * size_t(width), width, scratch.data());
+        }
+    }, pool);
+    return true;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief The mask of the solid tiles of the map.
+inline std::vector<u8>
+GetTileMask(const TileCollisionMap &map)
+{
+    auto mask = std::vector<u8>(size_t(map.GetWidth()) * size_t(map.GetHeight()));
+    for(i32 y = 0; y < map.GetHeight(); ++y) {
+        auto p_words = map.GetRowWords(y);
+        auto p_mask  = mask.data() + size_t(y) * size_t(map.GetWidth());
+        for(i32 x = 0; x < map.GetWidth(); ++x) {
+            p_mask[x] = u8((p_words[x / 64] >> (x % 64)) & 1u);
+        }
+    }
+    return mask;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Exact                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Euclidean distance to the nearest obstacle - 0 on the obstacles
+///   and +inf everywhere when there are none. Columns and then rows, each
+///   in chunks on the pool.
+inline void
+ComputeDistanceField(
+    const u8   *pMask,
+    i32         width,
+    i32         height,
+    float      *pOut_Distances,
+    ThreadPool &pool = ThreadPool::GetDefault())
+{
+    if(width <= 0 || height <= 0) {
+        return;
+    }
+
+    ACOW_MATH_TIME(DistanceField, size_t(width) * size_t(height));
+    detail::ComputeExactDistances(pMask, false, width, height, pOut_Distances, pool);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief The solid tiles are the obstacles.
+inline void
+ComputeDistanceField(
+    const TileCollisionMap &map,
+    float                  *pOut_Distances,
+    ThreadPool             &pool = ThreadPool::GetDefault())
+{
+    auto mask = detail::GetTileMask(map);
+    ComputeDistanceField(mask.data(), map.GetWidth(), map.GetHeight(), pOut_Distances, pool);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Distance to the edge of the shape - Positive outside, negative
+///   inside. Measured from the cell centers to the edge between cells
+///   (half a cell less than the center to center distances), so it
+///   changes sign exactly at the edge. +inf everywhere for an empty
+///   shape, -inf for a full one.
+inline void
+ComputeSignedDistanceField(
+    const u8   *pMask,
+    i32         width,
+    i32         height,
+    float      *pOut_Distances,
+    ThreadPool &pool = ThreadPool::GetDefault())
+{
+    if(width <= 0 || height <= 0) {
+        return;
+    }
+
+    ACOW_MATH_TIME(DistanceField, size_t(width) * size_t(height));
+
+    auto inside = std::vector<float>(size_t(width) * size_t(height));
+    detail::ComputeExactDistances(pMask, false, width, height, pOut_Distances, pool);
+    detail::ComputeExactDistances(pMask, true,  width, height, inside.data(), pool);
+
+    // One of the two is 0 on each cell.
+    auto v_half = simd::Set1(0.5f);
+    ParallelFor(0, inside.size(), 64 * 1024, [&](size_t b, size_t e) {
+        auto i = b;
+        for(; i + simd::kWidth <= e; i += simd::kWidth) {
+            auto outside = simd::Load(pOut_Distances + i);
+            auto d       = simd::Sub(outside, simd::Load(inside.data() + i));
+            auto m       = simd::Greater(outside, simd::Zero());
+            simd::Store(pOut_Distances + i, simd::Select(m, simd::Sub(d, v_half), simd::Add(d, v_half)));
+        }
+        for(; i < e; ++i) {
+            auto d = pOut_Distances[i] - inside[i];
+            pOut_Distances[i] = (pOut_Distances[i] > 0.0f) ? d - 0.5f : d + 0.5f;
+        }
+    }, pool);
+}
+
+
+//----------------------------------------------------------------------------//
+// Chamfer                                                                    //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Approximated distance to the nearest obstacle - A forward and a
+///   backward raster pass with 3x3 steps. The row to row part is SIMD,
+///   the along the row part is a sequential scan, and rows depend on the
+///   previous ones, so it runs on the calling thread.
+///   0 on the obstacles and +inf everywhere when there are none.
+inline void
+ComputeChamferDistanceField(
+    const u8      *pMask,
+    i32            width,
+    i32            height,
+    ChamferMetric  metric,
+    float         *pOut_Distances) noexcept
+{
+    if(width <= 0 || height <= 0) {
+        return;
+    }
+
+    ACOW_MATH_TIME(DistanceField, size_t(width) * size_t(height));
+
+    auto axial    = 1.0f;
+    auto diagonal = (metric == ChamferMetric::Manhattan ) ? 2.0f
+                  : (metric == ChamferMetric::Chessboard) ? 1.0f
+                  : (metric == ChamferMetric::Chamfer3_4) ? 4.0f / 3.0f
+                  : 1.41421356f;
+
+    auto inf = std::numeric_limits<float>::infinity();
+    auto w   = size_t(width);
+
+    // Forward - Up left, up, up right and left.
+    for(i32 y = 0; y < height; ++y) {
+        auto p_mask = pMask          + size_t(y) * w;
+        auto p_row  = pOut_Distances + size_t(y) * w;
+        for(size_t x = 0; x < w; ++x) {
+            p_row[x] = (p_mask[x] != 0) ? 0.0f : inf;
+        }
+
+        if(y > 0) {
+            auto p_up = p_row - w;
+            detail::RelaxWithRow(p_row, p_up, w, axial);
+            if(w > 1) {
+                detail::RelaxWithRow(p_row + 1, p_up,     w - 1, diagonal);
+                detail::RelaxWithRow(p_row,     p_up + 1, w - 1, diagonal);
+            }
+        }
+        for(size_t x = 1; x < w; ++x) {
+            p_row[x] = std::min(p_row[x], p_row[x - 1] + axial);
+        }
+    }
+
+    // Backward - Down right, down, down left and right.
+    for(i32 y = height - 1; y >= 0; --y) {
+        auto p_row = pOut_Distances + size_t(y) * w;
+        if(y < height - 1) {
+            auto p_down = p_row + w;
+            detail::RelaxWithRow(p_row, p_down, w, axial);
+            if(w > 1) {
+                detail::RelaxWithRow(p_row + 1, p_down,     w - 1, diagonal);
+                detail::RelaxWithRow(p_row,     p_down + 1, w - 1, diagonal);
+            }
+        }
+        for(size_t x = w - 1; x > 0; --x) {
+            p_row[x - 1] = std::min(p_row[x - 1], p_row[x] + axial);
+        }
+    }
+}
+
+} // namespace math
+} // namespace acow
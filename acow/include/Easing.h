@@ -0,0 +1,461 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Easing.h                                                      //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Standard easing curves, exact and as baked lookup tables.               //
+//    All of them take t in [0, 1] and map 0 to 0 and 1 to 1.                 //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cmath>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Constants.h"
+#include "Operations.h"
+
+
+namespace acow { namespace math {
+
+//----------------------------------------------------------------------------//
+// Easing Functions                                                           //
+//   Formulas from Robert Penner's easing equations:                          //
+//     http://robertpenner.com/easing/                                        //
+//----------------------------------------------------------------------------//
+//------------------------------------------------------------------------------
+// Linear
+ACOW_CONSTEXPR_STRICT inline float EaseLinear(float t) noexcept { return t; }
+
+//------------------------------------------------------------------------------
+// Quad
+ACOW_CONSTEXPR_STRICT inline float
+EaseQuadIn(float t) noexcept { return t * t; }
+
+ACOW_CONSTEXPR_STRICT inline float
+EaseQuadOut(float t) noexcept { return t * (2.0f - t); }
+
+ACOW_CONSTEXPR_STRICT inline float
+EaseQuadInOut(float t) noexcept
+{
+    return (t < 0.5f)
+        ? (2.0f * t * t)
+        : (-1.0f + (4.0f - 2.0f * t) * t);
+}
+
+//------------------------------------------------------------------------------
+// Cubic
+ACOW_CONSTEXPR_STRICT inline float
+EaseCubicIn(float t) noexcept { return t * t * t; }
+
+ACOW_CONSTEXPR_STRICT inline float
+EaseCubicOut(float t) noexcept
+{
+    return (t - 1.0f) * (t - 1.0f) * (t - 1.0f) + 1.0f;
+}
+
+ACOW_CONSTEXPR_STRICT inline float
+EaseCubicInOut(float t) noexcept
+{
+    return (t < 0.5f)
+        ? (4.0f * t * t * t)
+        : ((t - 1.0f) * (2.0f * t - 2.0f) * (2.0f * t - 2.0f) + 1.0f);
+}
+
+//------------------------------------------------------------------------------
+// Expo
+inline float
+EaseExpoIn(float t) noexcept
+{
+    return (t <= 0.0f) ? 0.0f : std::pow(2.0f, 10.0f * (t - 1.0f));
+}
+
+inline float
+EaseExpoOut(float t) noexcept
+{
+    return (t >= 1.0f) ? 1.0f : 1.0f - std::pow(2.0f, -10.0f * t);
+}
+
+inline float
+EaseExpoInOut(float t) noexcept
+{
+    if(t <= 0.0f) return 0.0f;
+    if(t >= 1.0f) return 1.0f;
+
+    return (t < 0.5f)
+        ? (0.5f * std::pow(2.0f, (20.0f * t) - 10.0f))
+        : (1.0f - 0.5f * std::pow(2.0f, (-20.0f * t) + 10.0f));
+}
+
+//------------------------------------------------------------------------------
+// Elastic
+inline float
+EaseElasticIn(float t) noexcept
+{
+    if(t <= 0.0f) return 0.0f;
+    if(t >= 1.0f) return 1.0f;
+
+    return -std::pow(2.0f, 10.0f * (t - 1.0f))
+         * std::sin((t - 1.075f) * k2PI / 0.3f);
+}
+
+inline float
+EaseElasticOut(float t) noexcept
+{
+    if(t <= 0.0f) return 0.0f;
+    if(t >= 1.0f) return 1.0f;
+
+    return std::pow(2.0f, -10.0f * t)
+         * std::sin((t - 0.075f) * k2PI / 0.3f) + 1.0f;
+}
+
+inline float
+EaseElasticInOut(float t) noexcept
+{
+    if(t <= 0.0f) return 0.0f;
+    if(t >= 1.0f) return 1.0f;
+
+    auto s = (2.0f * t) - 1.0f;
+    auto w = std::sin((s - 0.1125f) * k2PI / 0.45f);
+
+    return (t < 0.5f)
+        ? (-0.5f * std::pow(2.0f,  10.0f * s) * w)
+        : ( 0.5f * std::pow(2.0f, -10.0f * s) * w + 1.0f);
+}
+
+//------------------------------------------------------------------------------
+// Bounce
+ACOW_CONSTEXPR_LOOSE inline float
+EaseBounceOut(float t) noexcept
+{
+    if(t < (1.0f / 2.75f)) {
+        return 7.5625f * t * t;
+    }
+    if(t < (2.0f / 2.75f)) {
+        t -= (1.5f / 2.75f);
+        return 7.5625f * t * t + 0.75f;
+    }
+    if(t < (2.5f / 2.75f)) {
+        t -= (2.25f / 2.75f);
+        return 7.5625f * t * t + 0.9375f;
+    }
+
+    t -= (2.625f / 2.75f);
+    return 7.5625f * t * t + 0.984375f;
+}
+
+ACOW_CONSTEXPR_LOOSE inline float
+EaseBounceIn(float t) noexcept
+{
+    return 1.0f - EaseBounceOut(1.0f - t);
+}
+
+ACOW_CONSTEXPR_LOOSE inline float
+EaseBounceInOut(float t) noexcept
+{
+    return (t < 0.5f)
+        ? (0.5f * (1.0f - EaseBounceOut(1.0f - 2.0f * t)))
+        : (0.5f * EaseBounceOut(2.0f * t - 1.0f) + 0.5f);
+}
+
+
+//----------------------------------------------------------------------------//
+// Easing Type                                                                //
+//----------------------------------------------------------------------------//
+enum class EasingType
+{
+    Linear,
+    QuadIn,    QuadOut,    QuadInOut,
+    CubicIn,   CubicOut,   CubicInOut,
+    ExpoIn,    ExpoOut,    ExpoInOut,
+    ElasticIn, ElasticOut, ElasticInOut,
+    BounceIn,  BounceOut,  BounceInOut,
+}; // enum class EasingType
+
+typedef float (*EasingFunc)(float t);
+
+inline EasingFunc
+GetEasingFunc(EasingType type) noexcept
+{
+    switch(type) {
+        case EasingType::Linear       : return &EaseLinear;
+        case EasingType::QuadIn       : return &EaseQuadIn;
+        case EasingType::QuadOut      : return &EaseQuadOut;
+        case EasingType::QuadInOut    : return &EaseQuadInOut;
+        case EasingType::CubicIn      : return &EaseCubicIn;
+        case EasingType::CubicOut     : return &EaseCubicOut;
+        case EasingType::CubicInOut   : return &EaseCubicInOut;
+        case EasingType::ExpoIn       : return &EaseExpoIn;
+        case EasingType::ExpoOut      : return &EaseExpoOut;
+        case EasingType::ExpoInOut    : return &EaseExpoInOut;
+        case EasingType::ElasticIn    : return &EaseElasticIn;
+        case EasingType::ElasticOut   : return &EaseElasticOut;
+        case EasingType::ElasticInOut : return &EaseElasticInOut;
+        case EasingType::BounceIn     : return &EaseBounceIn;
+        case EasingType::BounceOut    : return &EaseBounceOut;
+        case EasingType::BounceInOut  : return &EaseBounceInOut;
+    }
+
+    return &EaseLinear;
+}
+
+inline float
+Ease(EasingType type, float t) noexcept
+{
+    return GetEasingFunc(type)(t);
+}
+
+
+//----------------------------------------------------------------------------//
+// Cubic Bezier                                                               //
+//   Timing function as in CSS: The curve goes from (0, 0) to (1, 1) with     //
+//   control points (x1, y1) and (x2, y2). x1 and x2 must be in [0, 1].       //
+//----------------------------------------------------------------------------//
+class CubicBezierEasing
+{
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline static CubicBezierEasing Ease     () noexcept { return CubicBezierEasing(0.25f, 0.1f, 0.25f, 1.0f); }
+    inline static CubicBezierEasing EaseIn   () noexcept { return CubicBezierEasing(0.42f, 0.0f, 1.0f,  1.0f); }
+    inline static CubicBezierEasing EaseOut  () noexcept { return CubicBezierEasing(0.0f,  0.0f, 0.58f, 1.0f); }
+    inline static CubicBezierEasing EaseInOut() noexcept { return CubicBezierEasing(0.42f, 0.0f, 0.58f, 1.0f); }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline
+    CubicBezierEasing(float x1, float y1, float x2, float y2) noexcept
+        // Polynomial coefficients of B(s) = ((a*s + b)*s + c)*s.
+        : m_cx(3.0f * x1)
+        , m_bx(3.0f * (x2 - x1) - m_cx)
+        , m_ax(1.0f - m_cx - m_bx)
+        , m_cy(3.0f * y1)
+        , m_by(3.0f * (y2 - y1) - m_cy)
+        , m_ay(1.0f - m_cy - m_by)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Evaluation                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the y of the curve at x = t.
+    inline float
+    Evaluate(float t) const noexcept
+    {
+        if(t <= 0.0f) return 0.0f;
+        if(t >= 1.0f) return 1.0f;
+
+        return SampleY(SolveX(t));
+    }
+
+    inline float operator()(float t) const noexcept { return Evaluate(t); }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    ACOW_CONSTEXPR_STRICT inline float
+    SampleX(float s) const noexcept { return ((m_ax * s + m_bx) * s + m_cx) * s; }
+
+    ACOW_CONSTEXPR_STRICT inline float
+    SampleY(float s) const noexcept { return ((m_ay * s + m_by) * s + m_cy) * s; }
+
+    ACOW_CONSTEXPR_STRICT inline float
+    SampleDX(float s) const noexcept { return (3.0f * m_ax * s + 2.0f * m_bx) * s + m_cx; }
+
+    inline float
+    SolveX(float x) const noexcept
+    {
+        constexpr float kEpsilon = 1e-6f;
+
+        // Newton-Raphson first, it converges in a couple of steps
+        // for most curves...
+        auto s = x;
+        for(i32 i = 0; i < 8; ++i) {
+            auto err = SampleX(s) - x;
+            if(std::fabs(err) < kEpsilon) {
+                return s;
+            }
+
+            auto d = SampleDX(s);
+            if(std::fabs(d) < kEpsilon) {
+                break;
+            }
+            s -= err / d;
+        }
+
+        // ...Bisection when the slope is too flat.
+        auto lo = 0.0f;
+        auto hi = 1.0f;
+        s = x;
+        for(i32 i = 0; i < 32; ++i) {
+            auto v = SampleX(s);
+            if(std::fabs(v - x) < kEpsilon) {
+                break;
+            }
+
+            if(v < x) lo = s;
+            else      hi = s;
+
+            s = (lo + hi) * 0.5f;
+        }
+
+        return s;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    float m_cx, m_bx, m_ax;
+    float m_cy, m_by, m_ay;
+
+}; // class CubicBezierEasing
+
+
+//----------------------------------------------------------------------------//
+// Easing Table                                                               //
+//   Curve sampled at evenly spaced t and linearly interpolated between the   //
+//   samples. Max error against the exact curve with the default 256          //
+//   samples (tests/EasingTest.cpp checks it):                                //
+//     Polynomial and CubicBezier : 1e-4 (measured ~2.3e-5)                   //
+//     Expo and Elastic           : 1e-3 (measured ~9.8e-4)                   //
+//     Bounce                     : 7e-3 (measured ~6.4e-3, at the kinks)     //
+//   The error goes down with the square of the samples for the polynomial    //
+//   curves, but only linearly at the kinks of Bounce. Most of the Expo /     //
+//   Elastic one is the ~2^-10 step the exact curves have where they are      //
+//   forced to 0 / 1, and more samples don't remove that.                     //
+//----------------------------------------------------------------------------//
+class EasingTable
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static size_t kDefaultSamplesCount = 256;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Accepted max error of the default tables - See above.
+    constexpr static double kPolynomialMaxError  = 1e-4;
+    constexpr static double kExponentialMaxError = 1e-3;
+    constexpr static double kBounceMaxError      = 7e-3;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Bakes any callable float(float) over [0, 1].
+    template <typename Func>
+    explicit
+    EasingTable(Func func, size_t samplesCount = kDefaultSamplesCount)
+        : m_samples(((samplesCount < 2) ? 2 : samplesCount) + 1)
+    {
+        // Last sample is repeated so Evaluate(1) doesn't need a branch.
+        auto last = m_samples.size() - 2;
+        for(size_t i = 0; i <= last; ++i) {
+            m_samples[i] = func(float(i) / float(last));
+        }
+        m_samples[last + 1] = m_samples[last];
+
+        m_scale = float(last);
+    }
+
+    explicit
+    EasingTable(EasingType type, size_t samplesCount = kDefaultSamplesCount)
+        : EasingTable(GetEasingFunc(type), samplesCount)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Evaluation                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the interpolated value at t - t is clamped to [0, 1].
+    ///   A NaN t gives the value at 0.
+    inline float
+    Evaluate(float t) const noexcept
+    {
+        // Comparisons with NaN are false, so NaN goes to 0 - size_t(NaN) is UB.
+        t = (t > 0.0f) ? t    : 0.0f;
+        t = (t > 1.0f) ? 1.0f : t;
+
+        auto f = t * m_scale;
+        auto i = size_t(f);
+        auto a = m_samples[i];
+        auto b = m_samples[i + 1];
+
+        return a + (b - a) * (f - float(i));
+    }
+
+    inline float operator()(float t) const noexcept { return Evaluate(t); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Evaluates count values of t - Output can alias the input.
+    ///   Same clamping as the single Evaluate, NaN included.
+    inline void
+    Evaluate(const float *pT, size_t count, float *pOut_Values) const noexcept
+    {
+        auto p_samples = m_samples.data();
+        auto scale     = m_scale;
+
+        for(size_t i = 0; i < count; ++i) {
+            // Branchless clamp so the loop vectorizes (but for the gathers).
+            // NaN fails (t > 0) and goes to 0.
+            auto t = pT[i];
+            t = (t > 0.0f) ? t    : 0.0f;
+            t = (t > 1.0f) ? 1.0f : t;
+
+            auto f   = t * scale;
+            auto idx = size_t(f);
+            auto a   = p_samples[idx];
+            auto b   = p_samples[idx + 1];
+
+            pOut_Values[i] = a + (b - a) * (f - float(idx));
+        }
+    }
+
+    inline size_t GetSamplesCount() const noexcept { return m_samples.size() - 1; }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<float> m_samples;
+    float              m_scale;
+
+}; // class EasingTable
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,587 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Fixed.h                                                       //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Fixed point scalar for deterministic (lockstep) simulation.             //
+//    Every operation is done with integers, so results are bit identical     //
+//    across compilers, libms and FMA settings.                               //
+//                                                                            //
+//      Fixed16_16 - Q16.16 in an i32 - Range +-32768, step ~1.5e-5           //
+//      Fixed32_32 - Q32.32 in an i64 - Range +-2^31,  step ~2.3e-10          //
+//                                                                            //
+//    Multiplication rounds to nearest (half up), division truncates          //
+//    towards zero, both the same on every platform.                          //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cmath>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Bits.h"
+
+
+//----------------------------------------------------------------------------//
+// 128 bits integers                                                          //
+//   Used for Q32.32 products. Define ACOW_MATH_DISABLE_INT128 to use the     //
+//   portable version (it's what MSVC gets) - Both give the same bits.        //
+//----------------------------------------------------------------------------//
+#if !defined(ACOW_MATH_DISABLE_INT128) && defined(__SIZEOF_INT128__)
+    #define ACOW_MATH_HAS_INT128 1
+#else
+    #define ACOW_MATH_HAS_INT128 0
+#endif // !defined(ACOW_MATH_DISABLE_INT128) && defined(__SIZEOF_INT128__)
+
+
+namespace acow { namespace math {
+
+namespace detail {
+
+//----------------------------------------------------------------------------//
+// Integer Helpers                                                            //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief floor(sqrt(v)), exactly.
+///   The double sqrt is only a guess (off by one at most for big v), the
+///   integer fix up makes the result exact - And being exact it's the same
+///   whatever the FPU does, so it's still deterministic.
+inline u64
+ISqrt64(u64 v) noexcept
+{
+    auto r = u64(std::sqrt(double(v)));
+    if(r > 0xFFFFFFFFull) {
+        r = 0xFFFFFFFFull;
+    }
+
+    while(r * r > v) {
+        --r;
+    }
+    while(r < 0xFFFFFFFFull && (r + 1) * (r + 1) <= v) {
+        ++r;
+    }
+
+    return r;
+}
+
+//------------------------------------------------------------------------------
+// Q32.32 products / quotients without a 128 bits type.
+struct U128
+{
+    u64 hi;
+    u64 lo;
+};
+
+inline U128
+MulU64(u64 a, u64 b) noexcept
+{
+    auto a_lo = a & 0xFFFFFFFFull; auto a_hi = a >> 32;
+    auto b_lo = b & 0xFFFFFFFFull; auto b_hi = b >> 32;
+
+    auto p0 = a_lo * b_lo;
+    auto p1 = a_lo * b_hi;
+    auto p2 = a_hi * b_lo;
+    auto p3 = a_hi * b_hi;
+
+    auto mid = (p0 >> 32) + (p1 & 0xFFFFFFFFull) + (p2 & 0xFFFFFFFFull);
+
+    U128 r;
+    r.lo = (mid << 32) | (p0 & 0xFFFFFFFFull);
+    r.hi = p3 + (p1 >> 32) + (p2 >> 32) + (mid >> 32);
+    return r;
+}
+
+inline U128
+NegateU128(U128 v) noexcept
+{
+    U128 r;
+    r.lo = ~v.lo + 1;
+    r.hi = ~v.hi + (r.lo == 0 ? 1 : 0);
+    return r;
+}
+
+inline U128
+AddU128(U128 v, u64 x) noexcept
+{
+    U128 r;
+    r.lo = v.lo + x;
+    r.hi = v.hi + (r.lo < v.lo ? 1 : 0);
+    return r;
+}
+
+// Arithmetic (sign filling) right shift of a two's complement 128 bits.
+inline u64
+ShiftRightS128(U128 v, i32 shift) noexcept
+{
+    if(shift == 0) {
+        return v.lo;
+    }
+    return (v.lo >> shift) | (v.hi << (64 - shift));
+}
+
+// (num << shift) / den for non negative values, quotient must fit 64 bits.
+inline u64
+DivShiftU64(u64 num, u64 den, i32 shift) noexcept
+{
+    U128 n;
+    n.hi = (shift == 0) ? 0 : (num >> (64 - shift));
+    n.lo = num << shift;
+
+    u64 q   = 0;
+    u64 rem = 0;
+    for(i32 i = 127; i >= 0; --i) {
+        auto carry = rem >> 63;
+        auto bit   = (i >= 64) ? (n.hi >> (i - 64)) & 1 : (n.lo >> i) & 1;
+
+        rem = (rem << 1) | bit;
+        q <<= 1;
+        if(carry || rem >= den) {
+            rem -= den;
+            q   |= 1;
+        }
+    }
+    return q;
+}
+
+//------------------------------------------------------------------------------
+// (a * b) >> shift rounded to nearest, half up.
+inline i32
+MulShift(i32 a, i32 b, i32 shift) noexcept
+{
+    auto p = i64(a) * i64(b);
+    return i32((p + (i64(1) << (shift - 1))) >> shift);
+}
+
+inline i64
+MulShift(i64 a, i64 b, i32 shift) noexcept
+{
+    #if (ACOW_MATH_HAS_INT128)
+        auto p = __int128(a) * __int128(b);
+        return i64((p + (__int128(1) << (shift - 1))) >> shift);
+    #else
+        auto negative = (a < 0) != (b < 0);
+        auto ua = (a < 0) ? (0 - u64(a)) : u64(a);
+        auto ub = (b < 0) ? (0 - u64(b)) : u64(b);
+
+        auto p = MulU64(ua, ub);
+        if(negative) {
+            p = NegateU128(p);
+        }
+        p = AddU128(p, u64(1) << (shift - 1));
+        // Carry of a negative value plus the rounding is already in hi.
+        return i64(ShiftRightS128(p, shift));
+    #endif // (ACOW_MATH_HAS_INT128)
+}
+
+//------------------------------------------------------------------------------
+// (a << shift) / b truncated towards zero.
+inline i32
+DivShift(i32 a, i32 b, i32 shift) noexcept
+{
+    return i32((i64(a) * (i64(1) << shift)) / i64(b));
+}
+
+inline i64
+DivShift(i64 a, i64 b, i32 shift) noexcept
+{
+    #if (ACOW_MATH_HAS_INT128)
+        return i64((__int128(a) * (__int128(1) << shift)) / __int128(b));
+    #else
+        auto negative = (a < 0) != (b < 0);
+        auto ua = (a < 0) ? (0 - u64(a)) : u64(a);
+        auto ub = (b < 0) ? (0 - u64(b)) : u64(b);
+
+        auto q = DivShiftU64(ua, ub, shift);
+        return negative ? i64(0 - q) : i64(q);
+    #endif // (ACOW_MATH_HAS_INT128)
+}
+
+//------------------------------------------------------------------------------
+// sin(k * 90 / 256 degrees) for k in [0, 256], as Q2.30.
+//   Baked so the tables are the same everywhere, whatever the libm.
+inline const i32*
+GetFixedSinTable() noexcept
+{
+    static const i32 s_table[257] = {
+                 0,    6588356,   13176464,   19764076,   26350943,   32936819,
+          39521455,   46104602,   52686014,   59265442,   65842639,   72417357,
+          78989349,   85558366,   92124163,   98686491,  105245103,  111799753,
+         118350194,  124896179,  131437462,  137973796,  144504935,  151030634,
+         157550647,  164064728,  170572633,  177074115,  183568930,  190056834,
+         196537583,  203010932,  209476638,  215934457,  222384147,  228825464,
+         235258165,  241682010,  248096755,  254502159,  260897982,  267283981,
+         273659918,  280025552,  286380643,  292724951,  299058239,  305380268,
+         311690799,  317989595,  324276419,  330551034,  336813204,  343062693,
+         349299266,  355522689,  361732726,  367929144,  374111709,  380280190,
+         386434353,  392573967,  398698801,  404808624,  410903207,  416982319,
+         423045732,  429093217,  435124548,  441139496,  447137835,  453119340,
+         459083786,  465030947,  470960600,  476872522,  482766489,  488642281,
+         494499676,  500338453,  506158392,  511959275,  517740883,  523502998,
+         529245404,  534967884,  540670223,  546352205,  552013618,  557654248,
+         563273883,  568872310,  574449320,  580004702,  585538248,  591049748,
+         596538995,  602005783,  607449906,  612871159,  618269338,  623644239,
+         628995660,  634323400,  639627258,  644907034,  650162530,  655393548,
+         660599890,  665781362,  670937767,  676068911,  681174602,  686254647,
+         691308855,  696337036,  701339000,  706314559,  711263525,  716185713,
+         721080937,  725949013,  730789757,  735602987,  740388522,  745146182,
+         749875788,  754577161,  759250125,  763894504,  768510122,  773096806,
+         777654384,  782182683,  786681534,  791150767,  795590213,  799999706,
+         804379079,  808728167,  813046808,  817334838,  821592095,  825818421,
+         830013654,  834177638,  838310216,  842411232,  846480531,  850517961,
+         854523370,  858496606,  862437520,  866345964,  870221790,  874064853,
+         877875009,  881652112,  885396022,  889106597,  892783698,  896427186,
+         900036924,  903612776,  907154608,  910662286,  914135678,  917574653,
+         920979082,  924348837,  927683790,  930983817,  934248793,  937478595,
+         940673101,  943832191,  946955747,  950043650,  953095785,  956112036,
+         959092290,  962036435,  964944360,  967815955,  970651112,  973449725,
+         976211688,  978936898,  981625251,  984276646,  986890984,  989468165,
+         992008094,  994510675,  996975812,  999403415, 1001793390, 1004145648,
+        1006460100, 1008736660, 1010975242, 1013175761, 1015338134, 1017462281,
+        1019548121, 1021595575, 1023604567, 1025575020, 1027506862, 1029400018,
+        1031254418, 1033069992, 1034846671, 1036584389, 1038283080, 1039942680,
+        1041563127, 1043144360, 1044686319, 1046188946, 1047652185, 1049075980,
+        1050460278, 1051805027, 1053110176, 1054375676, 1055601479, 1056787540,
+        1057933813, 1059040255, 1060106826, 1061133483, 1062120190, 1063066909,
+        1063973603, 1064840240, 1065666786, 1066453210, 1067199483, 1067905576,
+        1068571464, 1069197120, 1069782521, 1070327646, 1070832474, 1071296985,
+        1071721163, 1072104991, 1072448455, 1072751542, 1073014240, 1073236540,
+        1073418433, 1073559913, 1073660973, 1073721611, 1073741824
+    };
+    return s_table;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Fixed                                                                      //
+//----------------------------------------------------------------------------//
+template <typename T, i32 FracBits>
+class Fixed
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef T Storage;
+
+    constexpr static i32 kFracBits = FracBits;
+    constexpr static T   kOneRaw   = T(1) << FracBits;
+
+
+    //------------------------------------------------------------------------//
+    // Static Functions                                                       //
+    //------------------------------------------------------------------------//
+public:
+    #define DEFINE_FIXED(_name_, _raw_)           \
+        ACOW_CONSTEXPR_STRICT inline static Fixed \
+        _name_() noexcept                         \
+        {                                         \
+            return FromRaw(_raw_);                \
+        }
+
+    DEFINE_FIXED(Zero, 0)
+    DEFINE_FIXED(One,  kOneRaw)
+    DEFINE_FIXED(Half, kOneRaw / 2)
+
+    #undef DEFINE_FIXED
+
+    ACOW_CONSTEXPR_STRICT inline static Fixed
+    FromRaw(T raw) noexcept
+    {
+        return Fixed(raw, RawTag());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Converts from floating point, rounding to nearest.
+    /// @note Deterministic (it's a single correctly rounded operation), but
+    ///   meant for loading data - Keep the simulation in fixed.
+    inline static Fixed
+    FromFloat(double value) noexcept
+    {
+        return FromRaw(T(std::llround(value * double(kOneRaw))));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT
+    Fixed() noexcept
+        : raw(0)
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT explicit
+    Fixed(i32 value) noexcept
+        : raw(T(value) * kOneRaw)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Conversion                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline float
+    ToFloat() const noexcept { return float(double(raw) / double(kOneRaw)); }
+
+    ACOW_CONSTEXPR_STRICT inline double
+    ToDouble() const noexcept { return double(raw) / double(kOneRaw); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Integer part, rounded towards negative infinity.
+    ACOW_CONSTEXPR_STRICT inline T
+    ToInt() const noexcept { return raw >> FracBits; }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT friend inline Fixed
+    operator +(Fixed lhs, Fixed rhs) noexcept { return FromRaw(lhs.raw + rhs.raw); }
+
+    ACOW_CONSTEXPR_STRICT friend inline Fixed
+    operator -(Fixed lhs, Fixed rhs) noexcept { return FromRaw(lhs.raw - rhs.raw); }
+
+    ACOW_CONSTEXPR_STRICT friend inline Fixed
+    operator -(Fixed v) noexcept { return FromRaw(-v.raw); }
+
+    friend inline Fixed
+    operator *(Fixed lhs, Fixed rhs) noexcept
+    {
+        return FromRaw(detail::MulShift(lhs.raw, rhs.raw, FracBits));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @warning rhs must not be zero.
+    friend inline Fixed
+    operator /(Fixed lhs, Fixed rhs) noexcept
+    {
+        return FromRaw(detail::DivShift(lhs.raw, rhs.raw, FracBits));
+    }
+
+    // Integer scalars are exact, no rounding involved.
+    ACOW_CONSTEXPR_STRICT friend inline Fixed
+    operator *(Fixed lhs, i32 rhs) noexcept { return FromRaw(lhs.raw * T(rhs)); }
+
+    ACOW_CONSTEXPR_STRICT friend inline Fixed
+    operator *(i32 lhs, Fixed rhs) noexcept { return FromRaw(T(lhs) * rhs.raw); }
+
+    ACOW_CONSTEXPR_STRICT friend inline Fixed
+    operator /(Fixed lhs, i32 rhs) noexcept { return FromRaw(lhs.raw / T(rhs)); }
+
+
+    ACOW_CONSTEXPR_LOOSE friend inline Fixed&
+    operator +=(Fixed &lhs, Fixed rhs) noexcept { lhs.raw += rhs.raw; return lhs; }
+
+    ACOW_CONSTEXPR_LOOSE friend inline Fixed&
+    operator -=(Fixed &lhs, Fixed rhs) noexcept { lhs.raw -= rhs.raw; return lhs; }
+
+    friend inline Fixed&
+    operator *=(Fixed &lhs, Fixed rhs) noexcept { lhs = lhs * rhs; return lhs; }
+
+    friend inline Fixed&
+    operator /=(Fixed &lhs, Fixed rhs) noexcept { lhs = lhs / rhs; return lhs; }
+
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator ==(Fixed lhs, Fixed rhs) noexcept { return lhs.raw == rhs.raw; }
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator !=(Fixed lhs, Fixed rhs) noexcept { return lhs.raw != rhs.raw; }
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator <(Fixed lhs, Fixed rhs) noexcept { return lhs.raw < rhs.raw; }
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator <=(Fixed lhs, Fixed rhs) noexcept { return lhs.raw <= rhs.raw; }
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator >(Fixed lhs, Fixed rhs) noexcept { return lhs.raw > rhs.raw; }
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator >=(Fixed lhs, Fixed rhs) noexcept { return lhs.raw >= rhs.raw; }
+
+
+    //------------------------------------------------------------------------//
+    // Private                                                                //
+    //------------------------------------------------------------------------//
+private:
+    struct RawTag {};
+
+    ACOW_CONSTEXPR_STRICT
+    Fixed(T raw, RawTag) noexcept
+        : raw(raw)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    T raw;
+
+}; // class Fixed
+
+
+//----------------------------------------------------------------------------//
+// Typedefs                                                                   //
+//----------------------------------------------------------------------------//
+typedef Fixed<i32, 16> Fixed16_16;
+typedef Fixed<i64, 32> Fixed32_32;
+
+
+//----------------------------------------------------------------------------//
+// Functions                                                                  //
+//----------------------------------------------------------------------------//
+template <typename T, i32 F>
+ACOW_CONSTEXPR_STRICT inline Fixed<T, F>
+Abs(Fixed<T, F> v) noexcept
+{
+    return (v.raw < 0) ? -v : v;
+}
+
+template <typename T, i32 F>
+inline Fixed<T, F>
+Lerp(Fixed<T, F> s, Fixed<T, F> e, Fixed<T, F> t) noexcept
+{
+    return s + (e - s) * t;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief floor(sqrt(v)) - Negative values give 0.
+template <typename T, i32 F>
+inline Fixed<T, F>
+Sqrt(Fixed<T, F> v) noexcept
+{
+    if(v.raw <= 0) {
+        return Fixed<T, F>::Zero();
+    }
+
+    // sqrt(raw * 2^F) - Shift as much as fits (even amount) and make
+    // up for the rest afterwards. Q16.16 always fits, so it's exact.
+    auto raw   = u64(v.raw);
+    auto room  = (CountLeadingZeros(raw) & ~1);
+    auto shift = (F < room) ? F : room;
+    auto r     = detail::ISqrt64(raw << shift) << ((F - shift) / 2);
+
+    return Fixed<T, F>::FromRaw(T(r));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief sqrt(x*x + y*y) without overflowing the intermediate squares.
+template <typename T, i32 F>
+inline Fixed<T, F>
+Hypot(Fixed<T, F> x, Fixed<T, F> y) noexcept
+{
+    auto ax = (x.raw < 0) ? (0 - u64(x.raw)) : u64(x.raw);
+    auto ay = (y.raw < 0) ? (0 - u64(y.raw)) : u64(y.raw);
+    auto m  = (ax > ay) ? ax : ay;
+    if(m == 0) {
+        return Fixed<T, F>::Zero();
+    }
+
+    // Scale both below 2^31 so the sum of squares fits in 64 bits.
+    auto bits  = 64 - CountLeadingZeros(m);
+    auto shift = (bits > 31) ? (bits - 31) : 0;
+
+    ax >>= shift;
+    ay >>= shift;
+
+    return Fixed<T, F>::FromRaw(T(detail::ISqrt64(ax * ax + ay * ay) << shift));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Sine and cosine of an angle in degrees, from a 1024 steps per
+///   turn table with linear interpolation. Max error ~5e-6 (plus the
+///   rounding to the type, ~1.5e-5 for Fixed16_16).
+template <typename T, i32 F>
+inline void
+SinCosDegrees(
+    Fixed<T, F>  degrees,
+    Fixed<T, F> *pOut_Sin,
+    Fixed<T, F> *pOut_Cos) noexcept
+{
+    const T full_turn = T(360) * Fixed<T, F>::kOneRaw;
+
+    auto d = degrees.raw % full_turn;
+    if(d < 0) {
+        d += full_turn;
+    }
+
+    // Table position with F bits of fraction.
+    auto pos  = (u64(d) * 1024) / 360;
+    auto idx  = u32(pos >> F);
+    auto frac = i64(pos & ((u64(1) << F) - 1));
+
+    auto p_table = detail::GetFixedSinTable();
+    auto lookup  = [p_table, frac](u32 step) -> i64 {
+        // Quarter wave table, unfolded to the full turn.
+        step &= 1023;
+        auto quadrant = step >> 8;
+        auto i        = step & 255;
+
+        auto a = i64(0);
+        auto b = i64(0);
+        switch(quadrant) {
+            case 0 : a =  p_table[i];       b =  p_table[i + 1];   break;
+            case 1 : a =  p_table[256 - i]; b =  p_table[255 - i]; break;
+            case 2 : a = -p_table[i];       b = -p_table[i + 1];   break;
+            default: a = -p_table[256 - i]; b = -p_table[255 - i]; break;
+        }
+
+        // Q2.30 -> QF, rounding to nearest.
+        constexpr i32 kDown = (F < 30) ? (30 - F) : 0;
+        constexpr i32 kUp   = (F > 30) ? (F - 30) : 0;
+        constexpr i64 kHalf = (kDown > 0) ? (i64(1) << ((kDown > 0) ? kDown - 1 : 0)) : 0;
+
+        auto v = a + (((b - a) * frac) >> F);
+        return ((v + kHalf) >> kDown) * (i64(1) << kUp);
+    };
+
+    if(pOut_Sin) *pOut_Sin = Fixed<T, F>::FromRaw(T(lookup(idx)));
+    if(pOut_Cos) *pOut_Cos = Fixed<T, F>::FromRaw(T(lookup(idx + 256)));
+}
+
+template <typename T, i32 F>
+inline Fixed<T, F>
+SinDegrees(Fixed<T, F> degrees) noexcept
+{
+    Fixed<T, F> s;
+    SinCosDegrees(degrees, &s, static_cast<Fixed<T, F>*>(nullptr));
+    return s;
+}
+
+template <typename T, i32 F>
+inline Fixed<T, F>
+CosDegrees(Fixed<T, F> degrees) noexcept
+{
+    Fixed<T, F> c;
+    SinCosDegrees(degrees, static_cast<Fixed<T, F>*>(nullptr), &c);
+    return c;
+}
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,228 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FixedRect.h                                                   //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Rect counterpart over Fixed, for deterministic simulation.              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "FixedVec2.h"
+#include "Rect.h"
+
+
+namespace acow { namespace math {
+
+template <typename TFixed>
+class BasicFixedRect
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef TFixed                 Scalar;
+    typedef BasicFixedVec2<TFixed> Vec;
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline static BasicFixedRect
+    Empty() noexcept
+    {
+        return BasicFixedRect();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Converts from Rect - Meant for loading data only.
+    inline static BasicFixedRect
+    FromRect(const Rect &r) noexcept
+    {
+        return BasicFixedRect(
+            TFixed::FromFloat(r.x), TFixed::FromFloat(r.y),
+            TFixed::FromFloat(r.w), TFixed::FromFloat(r.h)
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT
+    BasicFixedRect() noexcept
+        : x(), y(), w(), h()
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT
+    BasicFixedRect(TFixed x, TFixed y, TFixed w, TFixed h) noexcept
+        : x(x), y(y), w(w), h(h)
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT
+    BasicFixedRect(const Vec &topLeft, const Vec &size) noexcept
+        : x(topLeft.x), y(topLeft.y), w(size.x), h(size.y)
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT inline Rect
+    ToRect() const noexcept
+    {
+        return Rect(x.ToFloat(), y.ToFloat(), w.ToFloat(), h.ToFloat());
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Position                                                               //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline TFixed GetLeft  () const noexcept { return x;     }
+    ACOW_CONSTEXPR_STRICT inline TFixed GetTop   () const noexcept { return y;     }
+    ACOW_CONSTEXPR_STRICT inline TFixed GetRight () const noexcept { return x + w; }
+    ACOW_CONSTEXPR_STRICT inline TFixed GetBottom() const noexcept { return y + h; }
+
+    ACOW_CONSTEXPR_STRICT inline Vec GetTopLeft    () const noexcept { return Vec(x,     y);     }
+    ACOW_CONSTEXPR_STRICT inline Vec GetTopRight   () const noexcept { return Vec(x + w, y);     }
+    ACOW_CONSTEXPR_STRICT inline Vec GetBottomLeft () const noexcept { return Vec(x,     y + h); }
+    ACOW_CONSTEXPR_STRICT inline Vec GetBottomRight() const noexcept { return Vec(x + w, y + h); }
+    ACOW_CONSTEXPR_STRICT inline Vec GetSize       () const noexcept { return Vec(w,     h);     }
+
+    // Halving with the i32 division is exact for even raws, so no rounding
+    // differences between GetCenter and SetCenter.
+    ACOW_CONSTEXPR_STRICT inline Vec
+    GetCenter() const noexcept
+    {
+        return Vec(x + (w / 2), y + (h / 2));
+    }
+
+    ACOW_CONSTEXPR_LOOSE inline void
+    SetCenter(const Vec &p) noexcept
+    {
+        x = p.x - (w / 2);
+        y = p.y - (h / 2);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline bool
+    IsEmpty() const noexcept
+    {
+        return (w == TFixed::Zero()) && (h == TFixed::Zero());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Left and top edges are inside, right and bottom are not.
+    ACOW_CONSTEXPR_STRICT inline bool
+    Contains(const Vec &p) const noexcept
+    {
+        return (p.x >= GetLeft()) && (p.x < GetRight())
+            && (p.y >= GetTop ()) && (p.y < GetBottom());
+    }
+
+    ACOW_CONSTEXPR_STRICT inline bool
+    Contains(const BasicFixedRect &r) const noexcept
+    {
+        return (r.GetLeft () >= GetLeft ()) && (r.GetRight () <= GetRight ())
+            && (r.GetTop  () >= GetTop  ()) && (r.GetBottom() <= GetBottom());
+    }
+
+    ACOW_CONSTEXPR_STRICT inline bool
+    Intersects(const BasicFixedRect &r) const noexcept
+    {
+        return (GetLeft() < r.GetRight ()) && (r.GetLeft() < GetRight ())
+            && (GetTop () < r.GetBottom()) && (r.GetTop () < GetBottom());
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Movement                                                               //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_LOOSE inline void
+    MoveTo(const Vec &p) noexcept
+    {
+        x = p.x;
+        y = p.y;
+    }
+
+    ACOW_CONSTEXPR_LOOSE inline void
+    Translate(const Vec &delta) noexcept
+    {
+        x += delta.x;
+        y += delta.y;
+    }
+
+    ACOW_CONSTEXPR_LOOSE inline BasicFixedRect
+    GetTranslated(const Vec &delta) const noexcept
+    {
+        auto other = BasicFixedRect(*this);
+        other.Translate(delta);
+
+        return other;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator ==(const BasicFixedRect &lhs, const BasicFixedRect &rhs) noexcept
+    {
+        return lhs.x == rhs.x
+            && lhs.y == rhs.y
+            && lhs.w == rhs.w
+            && lhs.h == rhs.h;
+    }
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator !=(const BasicFixedRect &lhs, const BasicFixedRect &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    TFixed x; TFixed y;
+    TFixed w; TFixed h;
+
+}; // class BasicFixedRect
+
+
+//----------------------------------------------------------------------------//
+// Typedefs                                                                   //
+//----------------------------------------------------------------------------//
+typedef BasicFixedRect<Fixed16_16> FixedRect;
+typedef BasicFixedRect<Fixed32_32> FixedRect_64;
+
+} // namespace math
+} // namespace acow
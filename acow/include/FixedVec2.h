@@ -0,0 +1,301 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FixedVec2.h                                                   //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Vec2 counterpart over Fixed, for deterministic simulation.              //
+//    Same API as Vec2 - Magnitude uses the integer sqrt and Rotate the       //
+//    table based sin / cos of Fixed.h.                                       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Fixed.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+template <typename TFixed>
+struct BasicFixedVec2
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef TFixed Scalar;
+
+
+    //------------------------------------------------------------------------//
+    // Static Functions                                                       //
+    //------------------------------------------------------------------------//
+public:
+    #define DEFINE_FIXED_VEC2(_name_, _x_, _y_)            \
+        ACOW_CONSTEXPR_STRICT inline static BasicFixedVec2 \
+        _name_() noexcept                                  \
+        {                                                  \
+            return BasicFixedVec2(_x_, _y_);               \
+        }
+
+    DEFINE_FIXED_VEC2(Zero, TFixed::Zero(), TFixed::Zero())
+    DEFINE_FIXED_VEC2(One , TFixed::One (), TFixed::One ())
+    DEFINE_FIXED_VEC2(Half, TFixed::Half(), TFixed::Half())
+
+    DEFINE_FIXED_VEC2(Left ,  TFixed(-1),  TFixed( 0))
+    DEFINE_FIXED_VEC2(Right,  TFixed(+1),  TFixed( 0))
+    DEFINE_FIXED_VEC2(Up   ,  TFixed( 0),  TFixed(-1))
+    DEFINE_FIXED_VEC2(Down ,  TFixed( 0),  TFixed(+1))
+
+    #undef DEFINE_FIXED_VEC2
+
+    ///-------------------------------------------------------------------------
+    /// @brief Converts from Vec2 - Meant for loading data only.
+    inline static BasicFixedVec2
+    FromVec2(const Vec2 &v) noexcept
+    {
+        return BasicFixedVec2(TFixed::FromFloat(v.x), TFixed::FromFloat(v.y));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Vars                                                            //
+    //------------------------------------------------------------------------//
+public:
+    TFixed x;
+    TFixed y;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT explicit
+    BasicFixedVec2(TFixed x = TFixed(), TFixed y = TFixed()) noexcept
+        : x(x), y(y)
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT inline Vec2
+    ToVec2() const noexcept
+    {
+        return Vec2(x.ToFloat(), y.ToFloat());
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Magnitude                                                              //
+    //------------------------------------------------------------------------//
+public:
+    inline TFixed
+    Magnitude() const noexcept
+    {
+        return Hypot(x, y);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @warning Overflows when the magnitude is above sqrt of the max
+    ///   value of TFixed (~181 for Fixed16_16) - Prefer Magnitude.
+    inline TFixed
+    MagnitudeSqr() const noexcept
+    {
+        return (x * x) + (y * y);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Distance                                                               //
+    //------------------------------------------------------------------------//
+public:
+    inline TFixed
+    Distance(const BasicFixedVec2 &v2) const noexcept
+    {
+        return Hypot(x - v2.x, y - v2.y);
+    }
+
+    inline TFixed
+    DistanceSqr(const BasicFixedVec2 &v2) const noexcept
+    {
+        return (x - v2.x) * (x - v2.x)
+             + (y - v2.y) * (y - v2.y);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Normalize                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the magnitude 1 - The zero vector stays zero.
+    inline void
+    Normalize() noexcept
+    {
+        auto magnitude = Magnitude();
+        if(magnitude == TFixed::Zero()) {
+            return;
+        }
+
+        x /= magnitude; y /= magnitude;
+    }
+
+    inline BasicFixedVec2
+    Normalized() const noexcept
+    {
+        auto vec2 = BasicFixedVec2(*this);
+        vec2.Normalize();
+
+        return vec2;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Rotation                                                               //
+    //------------------------------------------------------------------------//
+public:
+    inline void
+    Rotate(TFixed degrees) noexcept
+    {
+        TFixed s, c;
+        SinCosDegrees(degrees, &s, &c);
+
+        auto rx = (x * c) - (y * s);
+        auto ry = (x * s) + (y * c);
+
+        x = rx;
+        y = ry;
+    }
+
+    inline BasicFixedVec2
+    Rotated(TFixed degrees) const noexcept
+    {
+        auto vec2 = BasicFixedVec2(*this);
+        vec2.Rotate(degrees);
+
+        return vec2;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT friend inline BasicFixedVec2
+    operator +(const BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        return BasicFixedVec2(lhs.x + rhs.x, lhs.y + rhs.y);
+    }
+
+    ACOW_CONSTEXPR_STRICT friend inline BasicFixedVec2
+    operator -(const BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        return BasicFixedVec2(lhs.x - rhs.x, lhs.y - rhs.y);
+    }
+
+    friend inline BasicFixedVec2
+    operator *(const BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        return BasicFixedVec2(lhs.x * rhs.x, lhs.y * rhs.y);
+    }
+
+    friend inline BasicFixedVec2
+    operator /(const BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        return BasicFixedVec2(lhs.x / rhs.x, lhs.y / rhs.y);
+    }
+
+
+    ACOW_CONSTEXPR_LOOSE friend inline BasicFixedVec2&
+    operator +=(BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        lhs.x += rhs.x; lhs.y += rhs.y;
+        return lhs;
+    }
+
+    ACOW_CONSTEXPR_LOOSE friend inline BasicFixedVec2&
+    operator -=(BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        lhs.x -= rhs.x; lhs.y -= rhs.y;
+        return lhs;
+    }
+
+    friend inline BasicFixedVec2&
+    operator *=(BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        lhs.x *= rhs.x; lhs.y *= rhs.y;
+        return lhs;
+    }
+
+    friend inline BasicFixedVec2&
+    operator /=(BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        lhs.x /= rhs.x; lhs.y /= rhs.y;
+        return lhs;
+    }
+
+
+    friend inline BasicFixedVec2
+    operator *(const BasicFixedVec2 &lhs, TFixed scalar) noexcept
+    {
+        return BasicFixedVec2(lhs.x * scalar, lhs.y * scalar);
+    }
+
+    friend inline BasicFixedVec2
+    operator *(TFixed scalar, const BasicFixedVec2 &rhs) noexcept
+    {
+        return rhs * scalar;
+    }
+
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator ==(const BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        return (lhs.x == rhs.x) && (lhs.y == rhs.y);
+    }
+
+    ACOW_CONSTEXPR_STRICT friend inline bool
+    operator !=(const BasicFixedVec2 &lhs, const BasicFixedVec2 &rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+}; // struct BasicFixedVec2
+
+
+//----------------------------------------------------------------------------//
+// Lerp                                                                       //
+//----------------------------------------------------------------------------//
+template <typename TFixed>
+inline BasicFixedVec2<TFixed>
+Lerp(
+    const BasicFixedVec2<TFixed> &s,
+    const BasicFixedVec2<TFixed> &e,
+    TFixed                        t) noexcept
+{
+    return BasicFixedVec2<TFixed>(Lerp(s.x, e.x, t), Lerp(s.y, e.y, t));
+}
+
+
+//----------------------------------------------------------------------------//
+// Typedefs                                                                   //
+//----------------------------------------------------------------------------//
+typedef BasicFixedVec2<Fixed16_16> FixedVec2;
+typedef BasicFixedVec2<Fixed32_32> FixedVec2_64;
+
+} // namespace math
+} // namespace acow
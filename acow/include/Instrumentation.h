@@ -0,0 +1,443 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Instrumentation.h                                             //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Opt-in counters for the hot paths - Calls, items and ticks per          //
+//    operation family and batch kernel, kept per thread.                     //
+//                                                                            //
+//    Off by default and free then (the macros expand to nothing). Turn on    //
+//    with ACOW_MATH_INSTRUMENTATION=1 (CMake option of the same name).       //
+//                                                                            //
+//      auto snapshot = instrumentation::TakeSnapshot();                      //
+//      std::puts(instrumentation::ToText(snapshot).c_str());                 //
+//      instrumentation::Reset();                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+// x86 time stamp counter
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+    #include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+    #include <x86intrin.h>
+#endif // defined(_MSC_VER) && ...
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "LibrarySupport.h"
+
+
+//----------------------------------------------------------------------------//
+// Settings                                                                   //
+//----------------------------------------------------------------------------//
+#if !defined(ACOW_MATH_INSTRUMENTATION)
+    #define ACOW_MATH_INSTRUMENTATION 0
+#endif // !defined(ACOW_MATH_INSTRUMENTATION)
+
+
+
+namespace acow { namespace math { namespace instrumentation {
+
+//----------------------------------------------------------------------------//
+// Counters                                                                   //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief The primitives only count calls - Timing them would cost more
+///   than they do. The batch kernels count calls, items and ticks.
+enum class Counter : u32
+{
+    // Primitives.
+    RectContains,
+    RectIntersects,
+    Vec2Normalize,
+    Vec2Rotate,
+
+    // Batch kernels.
+    BatchAngles,
+    BatchClamp,
+    BatchInverseLerp,
+    BatchLerp,
+    BatchNormalize,
+    BatchRemap,
+    BatchOverlaps,
+    ComputeBounds,
+    ComputeConvexHull,
+    ComputeBoundingCircle,
+    Cull,
+    CullIndexQuery,
+    DistanceField,
+    ParticleIntegrate,
+    ParallelFor,
+    SplineEvaluate,
+    TransformUpdate,
+    Vec2Encode,
+    Vec2Decode,
+
+    Count
+}; // enum class Counter
+
+constexpr static size_t kCountersCount = size_t(Counter::Count);
+
+inline const char*
+GetCounterName(Counter counter) noexcept
+{
+    static const char* s_names[kCountersCount] = {
+        "Rect::Contains",
+        "Rect::Intersects",
+        "Vec2::Normalize",
+        "Vec2::Rotate",
+
+        "Angles (batch)",
+        "Clamp (batch)",
+        "InverseLerp (batch)",
+        "Lerp (batch)",
+        "Normalize (batch)",
+        "Remap (batch)",
+        "Overlaps (batch)",
+        "ComputeBounds",
+        "ComputeConvexHull",
+        "ComputeBoundingCircle",
+        "Cull",
+        "StaticCullIndex::Query",
+        "DistanceField",
+        "ParticleStore::Integrate",
+        "ParallelFor",
+        "CubicBezier::Evaluate (batch)",
+        "TransformHierarchy::Update",
+        "Vec2StreamEncoder::EncodeFrame",
+        "Vec2StreamDecoder::DecodeFrame",
+    };
+    return (counter < Counter::Count) ? s_names[size_t(counter)] : "";
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Time stamp counter cycles on x86, steady clock nanoseconds on
+///   the others.
+inline u64
+ReadTicks() noexcept
+{
+    #if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+        return u64(__rdtsc());
+    #elif defined(__x86_64__) || defined(__i386__)
+        return u64(__rdtsc());
+    #else
+        return u64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()
+        ).count());
+    #endif // defined(_MSC_VER) && ...
+}
+
+
+//----------------------------------------------------------------------------//
+// Snapshot                                                                   //
+//----------------------------------------------------------------------------//
+struct CounterStats
+{
+    u64 calls;
+    u64 items;
+    u64 ticks;
+}; // struct CounterStats
+
+struct Snapshot
+{
+    CounterStats counters[kCountersCount];
+
+    inline const CounterStats&
+    operator[](Counter counter) const noexcept
+    {
+        return counters[size_t(counter)];
+    }
+}; // struct Snapshot
+
+
+namespace detail {
+
+///-----------------------------------------------------------------------------
+/// @brief The counters of one thread - Only that thread writes them, so
+///   the relaxed load + store is a plain add. Other threads only read.
+struct ThreadCounters
+{
+    std::atomic<u64> calls[kCountersCount];
+    std::atomic<u64> items[kCountersCount];
+    std::atomic<u64> ticks[kCountersCount];
+
+    inline ThreadCounters() noexcept;
+    inline ~ThreadCounters();
+
+    inline static void
+    Bump(std::atomic<u64> &value, u64 amount) noexcept
+    {
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    inline void
+    AddTo(Snapshot *pSnapshot) const noexcept
+    {
+        for(size_t i = 0; i < kCountersCount; ++i) {
+            pSnapshot->counters[i].calls += calls[i].load(std::memory_order_relaxed);
+            pSnapshot->counters[i].items += items[i].load(std::memory_order_relaxed);
+            pSnapshot->counters[i].ticks += ticks[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    inline void
+    Clear() noexcept
+    {
+        for(size_t i = 0; i < kCountersCount; ++i) {
+            calls[i].store(0, std::memory_order_relaxed);
+            items[i].store(0, std::memory_order_relaxed);
+            ticks[i].store(0, std::memory_order_relaxed);
+        }
+    }
+}; // struct ThreadCounters
+
+///-----------------------------------------------------------------------------
+/// @brief Every live thread's counters, plus what the finished ones left.
+struct Registry
+{
+    std::mutex                   mutex;
+    std::vector<ThreadCounters*> threads;
+    Snapshot                     retired;
+
+    inline static Registry&
+    Get()
+    {
+        static Registry s_registry;
+        return s_registry;
+    }
+
+    Registry() noexcept
+        : retired()
+    {
+        // Empty...
+    }
+}; // struct Registry
+
+ThreadCounters::ThreadCounters() noexcept
+{
+    Clear();
+
+    auto &registry = Registry::Get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.threads.push_back(this);
+}
+
+ThreadCounters::~ThreadCounters()
+{
+    auto &registry = Registry::Get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    AddTo(&registry.retired);
+    registry.threads.erase(std::find(registry.threads.begin(), registry.threads.end(), this));
+}
+
+inline ThreadCounters&
+GetThreadCounters()
+{
+    static thread_local ThreadCounters s_counters;
+    return s_counters;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Counting                                                                   //
+//   Used through the macros at the end of the file.                         //
+//----------------------------------------------------------------------------//
+inline void
+Count(Counter counter, u64 items = 1)
+{
+    auto &counters = detail::GetThreadCounters();
+    detail::ThreadCounters::Bump(counters.calls[size_t(counter)], 1);
+    detail::ThreadCounters::Bump(counters.items[size_t(counter)], items);
+}
+
+class ScopedTimer
+{
+public:
+    ScopedTimer(Counter counter, u64 items) noexcept
+        : m_counter(counter)
+        , m_items  (items)
+        , m_start  (ReadTicks())
+    {
+        // Empty...
+    }
+
+    ~ScopedTimer()
+    {
+        auto  elapsed  = ReadTicks() - m_start;
+        auto &counters = detail::GetThreadCounters();
+        auto  index    = size_t(m_counter);
+        detail::ThreadCounters::Bump(counters.calls[index], 1);
+        detail::ThreadCounters::Bump(counters.items[index], m_items);
+        detail::ThreadCounters::Bump(counters.ticks[index], elapsed);
+    }
+
+    ScopedTimer(const ScopedTimer &) = delete;
+    ScopedTimer& operator=(const ScopedTimer &) = delete;
+
+private:
+    Counter m_counter;
+    u64     m_items;
+    u64     m_start;
+}; // class ScopedTimer
+
+
+//----------------------------------------------------------------------------//
+// Snapshot / Reset                                                           //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Sum of every thread, including the ones that already ended -
+///   Counts of other threads may be a few calls behind.
+inline Snapshot
+TakeSnapshot()
+{
+    auto &registry = detail::Registry::Get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto snapshot = registry.retired;
+    for(auto p_thread : registry.threads) {
+        p_thread->AddTo(&snapshot);
+    }
+    return snapshot;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Zeroes every thread - Best done between frames, calls made by
+///   other threads at the same time may survive it.
+inline void
+Reset()
+{
+    auto &registry = detail::Registry::Get();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    registry.retired = Snapshot();
+    for(auto p_thread : registry.threads) {
+        p_thread->Clear();
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Dump                                                                       //
+//   Only the counters that ran.                                              //
+//----------------------------------------------------------------------------//
+inline std::string
+ToText(const Snapshot &snapshot)
+{
+    std::string text;
+    char line[160];
+
+    std::snprintf(
+        line, sizeof(line), "%-34s %14s %16s %18s %12s\n",
+        "counter", "calls", "items", "ticks", "ticks/item"
+    );
+    text += line;
+
+    for(size_t i = 0; i < kCountersCount; ++i) {
+        const auto &c = snapshot.counters[i];
+        if(c.calls == 0) {
+            continue;
+        }
+
+        std::snprintf(
+            line, sizeof(line), "%-34s %14llu %16llu %18llu %12.2f\n",
+            GetCounterName(Counter(i)),
+            (unsigned long long)c.calls,
+            (unsigned long long)c.items,
+            (unsigned long long)c.ticks,
+            (c.items == 0) ? 0.0 : double(c.ticks) / double(c.items)
+        );
+        text += line;
+    }
+    return text;
+}
+
+inline std::string
+ToJSON(const Snapshot &snapshot)
+{
+    std::string json = "{\n  \"counters\": [";
+    char line[256];
+
+    auto first = true;
+    for(size_t i = 0; i < kCountersCount; ++i) {
+        const auto &c = snapshot.counters[i];
+        if(c.calls == 0) {
+            continue;
+        }
+
+        std::snprintf(
+            line, sizeof(line),
+            "%s\n    {\"name\": \"%s\", \"calls\": %llu, \"items\": %llu, \"ticks\": %llu}",
+            first ? "" : ",",
+            GetCounterName(Counter(i)),
+            (unsigned long long)c.calls,
+            (unsigned long long)c.items,
+            (unsigned long long)c.ticks
+        );
+        json += line;
+        first = false;
+    }
+    json += first ? "]\n}\n" : "\n  ]\n}\n";
+    return json;
+}
+
+} // namespace instrumentation
+} // namespace math
+} // namespace acow
+
+
+//----------------------------------------------------------------------------//
+// Macros                                                                     //
+//   ACOW_MATH_COUNT           - Calls, in regular functions.                 //
+//   ACOW_MATH_COUNT_CONSTEXPR - Calls, in constexpr functions.               //
+//   ACOW_MATH_TIME            - Calls, items and ticks of the scope.         //
+//----------------------------------------------------------------------------//
+#define ACOW_MATH_INSTRUMENTATION_CONCAT_(_a_, _b_) _a_##_b_
+#define ACOW_MATH_INSTRUMENTATION_CONCAT(_a_, _b_)  ACOW_MATH_INSTRUMENTATION_CONCAT_(_a_, _b_)
+
+#if (ACOW_MATH_INSTRUMENTATION)
+    #define ACOW_MATH_COUNT(_counter_) \
+        ::acow::math::instrumentation::Count(::acow::math::instrumentation::Counter::_counter_)
+
+    // The constexpr primitives can only count outside of constant evaluation.
+    #if (ACOW_MATH_HAS_IS_CONSTANT_EVALUATED)
+        #define ACOW_MATH_COUNT_CONSTEXPR(_counter_) \
+            if(!ACOW_MATH_IS_CONSTANT_EVALUATED()) { ACOW_MATH_COUNT(_counter_); }
+    #else
+        #define ACOW_MATH_COUNT_CONSTEXPR(_counter_)
+    #endif // (ACOW_MATH_HAS_IS_CONSTANT_EVALUATED)
+
+    #define ACOW_MATH_TIME(_counter_, _items_)                                \
+        ::acow::math::instrumentation::ScopedTimer                            \
+        ACOW_MATH_INSTRUMENTATION_CONCAT(acow_math_timer_, __LINE__)(         \
+            ::acow::math::instrumentation::Counter::_counter_, u64(_items_)   \
+        )
+#else
+    #define ACOW_MATH_COUNT(_counter_)
+    #define ACOW_MATH_COUNT_CONSTEXPR(_counter_)
+    #define ACOW_MATH_TIME(_counter_, _items_)
+#endif // (ACOW_MATH_INSTRUMENTATION)
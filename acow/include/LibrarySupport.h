@@ -20,9 +20,64 @@
 
 #pragma once
 
+//----------------------------------------------------------------------------//
+// Compiler                                                                   //
+//   ACOW_MATH_IS_CONSTANT_EVALUATED() is true inside of constant evaluation  //
+//   - What C++20 std::is_constant_evaluated does, from C++14 on the          //
+//   compilers that have the builtin. Always false on the others.             //
+//----------------------------------------------------------------------------//
+#if defined(__has_builtin)
+    #if __has_builtin(__builtin_is_constant_evaluated)
+        #define ACOW_MATH_HAS_IS_CONSTANT_EVALUATED 1
+    #endif // __has_builtin(__builtin_is_constant_evaluated)
+#elif (defined(__GNUC__) && __GNUC__ >= 9) || (defined(_MSC_VER) && _MSC_VER >= 1925)
+    #define ACOW_MATH_HAS_IS_CONSTANT_EVALUATED 1
+#endif // defined(__has_builtin)
+
+#if !defined(ACOW_MATH_HAS_IS_CONSTANT_EVALUATED)
+    #define ACOW_MATH_HAS_IS_CONSTANT_EVALUATED 0
+#endif // !defined(ACOW_MATH_HAS_IS_CONSTANT_EVALUATED)
+
+#if (ACOW_MATH_HAS_IS_CONSTANT_EVALUATED)
+    #define ACOW_MATH_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#else
+    #define ACOW_MATH_IS_CONSTANT_EVALUATED() false
+#endif // (ACOW_MATH_HAS_IS_CONSTANT_EVALUATED)
+
+
 //----------------------------------------------------------------------------//
 // SDL                                                                        //
 //----------------------------------------------------------------------------//
 #if (ACOW_MATH_HAS_SDL_SUPPORT)
     #include <SDL.h>
 #endif // (ACOW_MATH_HAS_SDL_SUPPORT)
+
+
+//----------------------------------------------------------------------------//
+// SIMD                                                                       //
+//   Picked at compile time from the target flags (-msse2, -mavx, /arch...)   //
+//   Define ACOW_MATH_DISABLE_SIMD to force the scalar paths.                 //
+//----------------------------------------------------------------------------//
+#if !defined(ACOW_MATH_DISABLE_SIMD)
+    #if defined(__AVX__)
+        #define ACOW_MATH_HAS_AVX 1
+    #endif // defined(__AVX__)
+
+    #if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+        #define ACOW_MATH_HAS_SSE2 1
+    #endif // defined(__SSE2__) ...
+#endif // !defined(ACOW_MATH_DISABLE_SIMD)
+
+#if !defined(ACOW_MATH_HAS_AVX)
+    #define ACOW_MATH_HAS_AVX 0
+#endif // !defined(ACOW_MATH_HAS_AVX)
+
+#if !defined(ACOW_MATH_HAS_SSE2)
+    #define ACOW_MATH_HAS_SSE2 0
+#endif // !defined(ACOW_MATH_HAS_SSE2)
+
+#if (ACOW_MATH_HAS_AVX)
+    #include <immintrin.h>
+#elif (ACOW_MATH_HAS_SSE2)
+    #include <emmintrin.h>
+#endif // (ACOW_MATH_HAS_AVX)
@@ -0,0 +1,529 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Noise.h                                                       //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    2D value / Perlin / simplex noise and their fBm, evaluated a whole      //
+//    simd::f32x at a time - Rows, tiles and Vec2 arrays per call.            //
+//                                                                            //
+//    The lattice hash is the float permutation polynomial of Gustavson and   //
+//    McEwan's webgl-noise, so no table gathers are needed and every backend  //
+//    (and the single sample functions) gives the same bits. The lattice      //
+//    repeats every 289 units; The seed shifts it around.                     //
+//                                                                            //
+//    Noise2D is immutable after construction - Tiles can be filled from      //
+//    as many threads as wanted.                                              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Coord.h"
+#include "Random.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+namespace detail {
+
+//----------------------------------------------------------------------------//
+// Kernels                                                                    //
+//   Every float is an integer below 2^24 in the hash, so it's all exact.     //
+//----------------------------------------------------------------------------//
+inline simd::f32x
+NoiseMod289(simd::f32x x) noexcept
+{
+    auto q = simd::Floor(simd::Mul(x, simd::Set1(1.0f / 289.0f)));
+    return simd::Sub(x, simd::Mul(q, simd::Set1(289.0f)));
+}
+
+inline simd::f32x
+NoisePermute(simd::f32x x) noexcept
+{
+    // ((34x + 10) * x) mod 289
+    auto t = simd::MulAdd(x, simd::Set1(34.0f), simd::Set1(10.0f));
+    return NoiseMod289(simd::Mul(t, x));
+}
+
+inline simd::f32x
+NoiseHash(simd::f32x ix, simd::f32x iy) noexcept
+{
+    return NoisePermute(simd::Add(NoisePermute(iy), ix));
+}
+
+inline simd::f32x
+NoiseFract(simd::f32x x) noexcept
+{
+    return simd::Sub(x, simd::Floor(x));
+}
+
+inline simd::f32x
+NoiseAbs(simd::f32x x) noexcept
+{
+    return simd::Max(x, simd::Sub(simd::Zero(), x));
+}
+
+inline simd::f32x
+NoiseLerp(simd::f32x a, simd::f32x b, simd::f32x t) noexcept
+{
+    return simd::MulAdd(simd::Sub(b, a), t, a);
+}
+
+// 6t^5 - 15t^4 + 10t^3
+inline simd::f32x
+NoiseFade(simd::f32x t) noexcept
+{
+    auto p = simd::MulAdd(t, simd::Set1(6.0f), simd::Set1(-15.0f));
+    p = simd::MulAdd(p, t, simd::Set1(10.0f));
+    return simd::Mul(p, simd::Mul(t, simd::Mul(t, t)));
+}
+
+//------------------------------------------------------------------------------
+// Value
+inline simd::f32x
+ValueNoise(simd::f32x x, simd::f32x y, simd::f32x ox, simd::f32x oy) noexcept
+{
+    auto one = simd::Set1(1.0f);
+
+    auto fx = simd::Floor(x);
+    auto fy = simd::Floor(y);
+    auto tx = NoiseFade(simd::Sub(x, fx));
+    auto ty = NoiseFade(simd::Sub(y, fy));
+
+    auto ix0 = NoiseMod289(simd::Add(fx, ox));
+    auto iy0 = NoiseMod289(simd::Add(fy, oy));
+    auto ix1 = NoiseMod289(simd::Add(ix0, one));
+    auto iy1 = NoiseMod289(simd::Add(iy0, one));
+
+    auto scale = simd::Set1(2.0f / 288.0f);
+    auto v00 = simd::Sub(simd::Mul(NoiseHash(ix0, iy0), scale), one);
+    auto v10 = simd::Sub(simd::Mul(NoiseHash(ix1, iy0), scale), one);
+    auto v01 = simd::Sub(simd::Mul(NoiseHash(ix0, iy1), scale), one);
+    auto v11 = simd::Sub(simd::Mul(NoiseHash(ix1, iy1), scale), one);
+
+    return NoiseLerp(NoiseLerp(v00, v10, tx), NoiseLerp(v01, v11, tx), ty);
+}
+
+//------------------------------------------------------------------------------
+// Perlin
+inline simd::f32x
+PerlinCorner(simd::f32x ix, simd::f32x iy, simd::f32x dx, simd::f32x dy) noexcept
+{
+    // Gradients spread over a diamond, normalized with a Taylor 1/sqrt.
+    auto gx = simd::Sub(
+        simd::Mul(NoiseFract(simd::Mul(NoiseHash(ix, iy), simd::Set1(1.0f / 41.0f))), simd::Set1(2.0f)),
+        simd::Set1(1.0f)
+    );
+    auto gy = simd::Sub(NoiseAbs(gx), simd::Set1(0.5f));
+    gx = simd::Sub(gx, simd::Floor(simd::Add(gx, simd::Set1(0.5f))));
+
+    auto len_sqr = simd::Add(simd::Mul(gx, gx), simd::Mul(gy, gy));
+    auto inv_len = simd::Sub(
+        simd::Set1(1.79284291400159f),
+        simd::Mul(simd::Set1(0.85373472095314f), len_sqr)
+    );
+
+    return simd::Mul(simd::Add(simd::Mul(gx, dx), simd::Mul(gy, dy)), inv_len);
+}
+
+inline simd::f32x
+PerlinNoise(simd::f32x x, simd::f32x y, simd::f32x ox, simd::f32x oy) noexcept
+{
+    auto one = simd::Set1(1.0f);
+
+    auto fx  = simd::Floor(x);
+    auto fy  = simd::Floor(y);
+    auto dx0 = simd::Sub(x, fx);
+    auto dy0 = simd::Sub(y, fy);
+    auto dx1 = simd::Sub(dx0, one);
+    auto dy1 = simd::Sub(dy0, one);
+
+    auto ix0 = NoiseMod289(simd::Add(fx, ox));
+    auto iy0 = NoiseMod289(simd::Add(fy, oy));
+    auto ix1 = NoiseMod289(simd::Add(ix0, one));
+    auto iy1 = NoiseMod289(simd::Add(iy0, one));
+
+    auto n00 = PerlinCorner(ix0, iy0, dx0, dy0);
+    auto n10 = PerlinCorner(ix1, iy0, dx1, dy0);
+    auto n01 = PerlinCorner(ix0, iy1, dx0, dy1);
+    auto n11 = PerlinCorner(ix1, iy1, dx1, dy1);
+
+    auto tx = NoiseFade(dx0);
+    auto ty = NoiseFade(dy0);
+    auto n  = NoiseLerp(NoiseLerp(n00, n10, tx), NoiseLerp(n01, n11, tx), ty);
+
+    return simd::Mul(n, simd::Set1(2.3f));
+}
+
+//------------------------------------------------------------------------------
+// Simplex
+inline simd::f32x
+SimplexCorner(simd::f32x ix, simd::f32x iy, simd::f32x dx, simd::f32x dy) noexcept
+{
+    auto m = simd::Sub(
+        simd::Set1(0.5f),
+        simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy))
+    );
+    m = simd::Max(m, simd::Zero());
+    m = simd::Mul(m, m);
+    m = simd::Mul(m, m);
+
+    auto gx = simd::Sub(
+        simd::Mul(NoiseFract(simd::Mul(NoiseHash(ix, iy), simd::Set1(1.0f / 41.0f))), simd::Set1(2.0f)),
+        simd::Set1(1.0f)
+    );
+    auto h  = simd::Sub(NoiseAbs(gx), simd::Set1(0.5f));
+    auto a0 = simd::Sub(gx, simd::Floor(simd::Add(gx, simd::Set1(0.5f))));
+
+    auto len_sqr = simd::Add(simd::Mul(a0, a0), simd::Mul(h, h));
+    m = simd::Mul(m, simd::Sub(
+        simd::Set1(1.79284291400159f),
+        simd::Mul(simd::Set1(0.85373472095314f), len_sqr)
+    ));
+
+    return simd::Mul(m, simd::Add(simd::Mul(a0, dx), simd::Mul(h, dy)));
+}
+
+inline simd::f32x
+SimplexNoise(simd::f32x x, simd::f32x y, simd::f32x ox, simd::f32x oy) noexcept
+{
+    // (3 - sqrt(3)) / 6 and (sqrt(3) - 1) / 2
+    auto G2  = simd::Set1(0.211324865405187f);
+    auto F2  = simd::Set1(0.366025403784439f);
+    auto one = simd::Set1(1.0f);
+
+    // Skew to find the simplex cell, unskew to get the first corner.
+    auto s  = simd::Mul(simd::Add(x, y), F2);
+    auto fx = simd::Floor(simd::Add(x, s));
+    auto fy = simd::Floor(simd::Add(y, s));
+    auto t  = simd::Mul(simd::Add(fx, fy), G2);
+
+    auto dx0 = simd::Add(simd::Sub(x, fx), t);
+    auto dy0 = simd::Add(simd::Sub(y, fy), t);
+
+    // Upper or lower triangle.
+    auto lower = simd::Greater(dx0, dy0);
+    auto i1x   = simd::Select(lower, one, simd::Zero());
+    auto i1y   = simd::Sub(one, i1x);
+
+    auto dx1 = simd::Add(simd::Sub(dx0, i1x), G2);
+    auto dy1 = simd::Add(simd::Sub(dy0, i1y), G2);
+    auto dx2 = simd::Add(simd::Sub(dx0, one), simd::Add(G2, G2));
+    auto dy2 = simd::Add(simd::Sub(dy0, one), simd::Add(G2, G2));
+
+    auto ix = NoiseMod289(simd::Add(fx, ox));
+    auto iy = NoiseMod289(simd::Add(fy, oy));
+
+    auto n = simd::Add(
+        SimplexCorner(ix, iy, dx0, dy0),
+        simd::Add(
+            SimplexCorner(simd::Add(ix, i1x), simd::Add(iy, i1y), dx1, dy1),
+            SimplexCorner(simd::Add(ix, one), simd::Add(iy, one), dx2, dy2)
+        )
+    );
+
+    return simd::Mul(n, simd::Set1(130.0f));
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+enum class NoiseType
+{
+    Value,
+    Perlin,
+    Simplex,
+}; // enum class NoiseType
+
+///-----------------------------------------------------------------------------
+/// @brief fBm - Sums octaves of the noise, each one lacunarity times the
+///   frequency and gain times the amplitude of the previous one.
+///   A constructor instead of default member initializers, so it can
+///   still be brace initialized in C++11.
+struct FractalSettings
+{
+    ACOW_CONSTEXPR_STRICT
+    FractalSettings(i32 octaves = 5, float lacunarity = 2.0f, float gain = 0.5f) noexcept
+        : octaves(octaves), lacunarity(lacunarity), gain(gain)
+    {
+        // Empty...
+    }
+
+    i32   octaves;
+    float lacunarity;
+    float gain;
+}; // struct FractalSettings
+
+
+//----------------------------------------------------------------------------//
+// Noise2D                                                                    //
+//----------------------------------------------------------------------------//
+class Noise2D
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    // Each octave gets its own lattice offset, so they don't line up.
+    constexpr static i32 kMaxOctaves = 16;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit
+    Noise2D(u64 seed, NoiseType type = NoiseType::Simplex) noexcept
+        : m_type(type)
+    {
+        auto rng = Pcg32(seed);
+        for(i32 i = 0; i < kMaxOctaves; ++i) {
+            m_offsetsX[i] = float(rng.NextInRange(289));
+            m_offsetsY[i] = float(rng.NextInRange(289));
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Single Sample                                                          //
+    //   Goes through the same kernels, so it matches the batch functions.    //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Noise at (x, y), roughly in [-1, 1].
+    inline float
+    Sample(float x, float y) const noexcept
+    {
+        return SampleFractal(x, y, FractalSettings{1, 1.0f, 1.0f});
+    }
+
+    inline float Sample(const Vec2 &p) const noexcept { return Sample(p.x, p.y); }
+
+    inline float
+    SampleFractal(float x, float y, const FractalSettings &settings) const noexcept
+    {
+        float xs[simd::kWidth];
+        float ys[simd::kWidth];
+        float out[simd::kWidth];
+        for(size_t i = 0; i < simd::kWidth; ++i) {
+            xs[i] = x;
+            ys[i] = y;
+        }
+
+        simd::Store(out, Evaluate(simd::Load(xs), simd::Load(ys), settings));
+        return out[0];
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Batch                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Noise at each of the positions.
+    inline void
+    Sample(const Vec2 *pPositions, size_t count, float *pOut_Values) const noexcept
+    {
+        SampleFractal(pPositions, count, FractalSettings{1, 1.0f, 1.0f}, pOut_Values);
+    }
+
+    inline void
+    SampleFractal(
+        const Vec2            *pPositions,
+        size_t                 count,
+        const FractalSettings &settings,
+        float                 *pOut_Values) const noexcept
+    {
+        float xs[simd::kWidth];
+        float ys[simd::kWidth];
+        Run(count, pOut_Values, [&](size_t i, size_t n, simd::f32x *pX, simd::f32x *pY) {
+            for(size_t j = 0; j < simd::kWidth; ++j) {
+                // Padding lanes repeat the last position.
+                const auto &p = pPositions[i + ((j < n) ? j : n - 1)];
+                xs[j] = p.x;
+                ys[j] = p.y;
+            }
+            *pX = simd::Load(xs);
+            *pY = simd::Load(ys);
+        }, settings);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief count samples at (x + i * step, y).
+    inline void
+    SampleRow(
+        float                  x,
+        float                  y,
+        float                  step,
+        size_t                 count,
+        const FractalSettings &settings,
+        float                 *pOut_Values) const noexcept
+    {
+        RunRow(x, y, step, 1.0f, count, settings, pOut_Values);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Fills a rows x cols tile of a grid, row major with stride
+    ///   floats between rows. The cell (origin.y + r, origin.x + c) is
+    ///   sampled at ((origin.x + c) * frequency, (origin.y + r) * frequency),
+    ///   so adjacent tiles match at the borders.
+    inline void
+    SampleTile(
+        const Coord           &origin,
+        i32                    rows,
+        i32                    cols,
+        size_t                 stride,
+        float                  frequency,
+        const FractalSettings &settings,
+        float                 *pOut_Values) const noexcept
+    {
+        // Scaling the integer cell (and not adding steps) is what makes
+        //   the borders of adjacent tiles exactly the same.
+        for(i32 r = 0; r < rows; ++r) {
+            RunRow(
+                float(origin.x),
+                float(origin.y + r) * frequency,
+                1.0f,
+                frequency,
+                size_t(cols),
+                settings,
+                pOut_Values + size_t(r) * stride
+            );
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline simd::f32x
+    EvaluateOctave(simd::f32x x, simd::f32x y, i32 octave) const noexcept
+    {
+        auto ox = simd::Set1(m_offsetsX[octave]);
+        auto oy = simd::Set1(m_offsetsY[octave]);
+        switch(m_type) {
+            case NoiseType::Value  : return detail::ValueNoise  (x, y, ox, oy);
+            case NoiseType::Perlin : return detail::PerlinNoise (x, y, ox, oy);
+            case NoiseType::Simplex: return detail::SimplexNoise(x, y, ox, oy);
+        }
+        return simd::Zero();
+    }
+
+    inline simd::f32x
+    Evaluate(simd::f32x x, simd::f32x y, const FractalSettings &settings) const noexcept
+    {
+        auto octaves = (settings.octaves < 1          ) ? 1
+                     : (settings.octaves > kMaxOctaves) ? kMaxOctaves
+                     : settings.octaves;
+
+        auto sum       = simd::Zero();
+        auto frequency = 1.0f;
+        auto amplitude = 1.0f;
+        auto total     = 0.0f;
+        for(i32 i = 0; i < octaves; ++i) {
+            auto v_freq = simd::Set1(frequency);
+            auto n      = EvaluateOctave(simd::Mul(x, v_freq), simd::Mul(y, v_freq), i);
+
+            sum        = simd::MulAdd(n, simd::Set1(amplitude), sum);
+            total     += amplitude;
+            frequency *= settings.lacunarity;
+            amplitude *= settings.gain;
+        }
+
+        // Keeps the result in the same range as a single octave.
+        return simd::Mul(sum, simd::Set1(1.0f / total));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief count samples at ((x + i * step) * scale, y).
+    inline void
+    RunRow(
+        float                  x,
+        float                  y,
+        float                  step,
+        float                  scale,
+        size_t                 count,
+        const FractalSettings &settings,
+        float                 *pOut_Values) const noexcept
+    {
+        float lanes[simd::kWidth];
+        for(size_t j = 0; j < simd::kWidth; ++j) {
+            lanes[j] = float(j);
+        }
+
+        auto v_lanes = simd::Load(lanes);
+        auto v_step  = simd::Set1(step);
+        auto v_scale = simd::Set1(scale);
+        auto v_x     = simd::Set1(x);
+        auto v_y     = simd::Set1(y);
+        Run(count, pOut_Values, [&](size_t i, size_t, simd::f32x *pX, simd::f32x *pY) {
+            auto index = simd::Add(simd::Set1(float(i)), v_lanes);
+            *pX = simd::Mul(simd::MulAdd(index, v_step, v_x), v_scale);
+            *pY = v_y;
+        }, settings);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Calls load(i, n, &x, &y) for each kWidth positions starting
+    ///   at i (n of them valid) and writes the noise of the valid ones.
+    template <typename LoadFunc>
+    inline void
+    Run(
+        size_t                 count,
+        float                 *pOut_Values,
+        LoadFunc               load,
+        const FractalSettings &settings) const noexcept
+    {
+        auto x = simd::Zero();
+        auto y = simd::Zero();
+
+        size_t i = 0;
+        for(; i + simd::kWidth <= count; i += simd::kWidth) {
+            load(i, simd::kWidth, &x, &y);
+            simd::Store(pOut_Values + i, Evaluate(x, y, settings));
+        }
+        if(i < count) {
+            float tail[simd::kWidth];
+            load(i, count - i, &x, &y);
+            simd::Store(tail, Evaluate(x, y, settings));
+
+            for(size_t j = 0; i + j < count; ++j) {
+                pOut_Values[i + j] = tail[j];
+            }
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    NoiseType m_type;
+    float     m_offsetsX[kMaxOctaves];
+    float     m_offsetsY[kMaxOctaves];
+
+}; // class Noise2D
+
+} // namespace math
+} // namespace acow
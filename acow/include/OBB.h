@@ -0,0 +1,176 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : OBB.h                                                         //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Oriented bounding box - center, half extents and the rotation stored    //
+//    as its cos / sin, so the tests never call a trig function.              //
+//                                                                            //
+//    The overlap tests are in Overlap.h.                                     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Constants.h"
+#include "DeterministicMath.h"
+#include "Rect.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+class OBB
+{
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT inline static OBB
+    FromRect(const Rect &rect) noexcept
+    {
+        return OBB(
+            rect.GetCenter(),
+            Vec2(rect.GetWidth() * 0.5f, rect.GetHeight() * 0.5f),
+            1.0f,
+            0.0f
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT
+    OBB() noexcept
+        : center     (Vec2::Zero())
+        , halfExtents(Vec2::Zero())
+        , m_cos      (1.0f)
+        , m_sin      (0.0f)
+    {
+        // Empty...
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief cosAngle and sinAngle must be of the same angle - Meant for
+    ///   when they are already at hand (and for constant expressions).
+    ACOW_CONSTEXPR_STRICT
+    OBB(const Vec2 &center, const Vec2 &halfExtents, float cosAngle, float sinAngle) noexcept
+        : center     (center)
+        , halfExtents(halfExtents)
+        , m_cos      (cosAngle)
+        , m_sin      (sinAngle)
+    {
+        // Empty...
+    }
+
+    OBB(const Vec2 &center, const Vec2 &halfExtents, float degrees) noexcept
+        : center     (center)
+        , halfExtents(halfExtents)
+        , m_cos      (1.0f)
+        , m_sin      (0.0f)
+    {
+        SetRotation(degrees);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Rotation                                                               //
+    //------------------------------------------------------------------------//
+public:
+    inline void
+    SetRotation(float degrees) noexcept
+    {
+        SinCos(ToRadians(degrees), &m_sin, &m_cos);
+    }
+
+    ACOW_CONSTEXPR_STRICT inline float GetCos() const noexcept { return m_cos; }
+    ACOW_CONSTEXPR_STRICT inline float GetSin() const noexcept { return m_sin; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Unit vectors of the local x and y of the box.
+    ACOW_CONSTEXPR_STRICT inline Vec2 GetAxisX() const noexcept { return Vec2( m_cos, m_sin); }
+    ACOW_CONSTEXPR_STRICT inline Vec2 GetAxisY() const noexcept { return Vec2(-m_sin, m_cos); }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Smallest Rect that contains the box.
+    ACOW_CONSTEXPR_STRICT inline Rect
+    GetBounds() const noexcept
+    {
+        return BoundsFromExtents(
+            halfExtents.x * Abs(m_cos) + halfExtents.y * Abs(m_sin),
+            halfExtents.x * Abs(m_sin) + halfExtents.y * Abs(m_cos)
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Point in the box space (x along GetAxisX...), center at 0, 0.
+    ACOW_CONSTEXPR_STRICT inline Vec2
+    ToLocal(const Vec2 &p) const noexcept
+    {
+        return Vec2(
+            (p.x - center.x) *  m_cos + (p.y - center.y) * m_sin,
+            (p.x - center.x) * -m_sin + (p.y - center.y) * m_cos
+        );
+    }
+
+    ACOW_CONSTEXPR_STRICT inline bool
+    Contains(const Vec2 &p) const noexcept
+    {
+        return Abs(ToLocal(p).x) < halfExtents.x
+            && Abs(ToLocal(p).y) < halfExtents.y;
+    }
+
+    inline void Translate(const Vec2 &delta) noexcept { center += delta; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    ACOW_CONSTEXPR_STRICT inline static float
+    Abs(float v) noexcept { return (v < 0.0f) ? -v : v; }
+
+    ACOW_CONSTEXPR_STRICT inline Rect
+    BoundsFromExtents(float ex, float ey) const noexcept
+    {
+        return Rect(center.x - ex, center.y - ey, ex * 2.0f, ey * 2.0f);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    Vec2 center;
+    Vec2 halfExtents;
+
+private:
+    float m_cos;
+    float m_sin;
+
+}; // class OBB
+
+} // namespace math
+} // namespace acow
@@ -22,8 +22,12 @@
 
 // std
 #include <cmath>
+#include <limits>
 // AmazingCow Libs
 #include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Bits.h"
+#include "Constants.h"
 
 
 namespace acow { namespace math {
@@ -34,8 +38,11 @@ namespace acow { namespace math {
 template <typename T>
 T Clamp(const T &v, const T &_min, const T &_max)
 {
-    //COWTODO(n2omatt): We might use std::min, std::max.
-    //  So search about perfomance (I saw something on CPPCon...)
+    // Measured against std::min(std::max(...)) and the bithack Min / Max
+    // (benchmarks/OperationsBench.cpp): GCC vectorizes all of them to
+    // the same min/max instructions, so no change needed (not checked
+    // on Clang / MSVC).
+    // For arrays use the batch Clamp in BatchOperations.h.
     if(v < _min) return _min;
     if(v > _max) return _max;
 
@@ -54,31 +61,87 @@ Lerp(float s, float e, float t) noexcept
     return (1.0f - t) * s + (t * e);
 }
 
+ACOW_CONSTEXPR_STRICT inline float
+InverseLerp(float s, float e, float v) noexcept
+{
+    // Returns the t that Lerp(s, e, t) would map to v.
+    //   Degenerate range (s == e) gives 0.
+    return (e != s) ? (v - s) / (e - s) : 0.0f;
+}
+
+ACOW_CONSTEXPR_STRICT inline float
+Remap(float v, float inS, float inE, float outS, float outE) noexcept
+{
+    return Lerp(outS, outE, InverseLerp(inS, inE, v));
+}
+
+
+//----------------------------------------------------------------------------//
+// Angles                                                                     //
+//   For arrays use the batch versions in BatchOperations.h.                  //
+//----------------------------------------------------------------------------//
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline T
+ToRadians(T degrees) noexcept
+{
+    return degrees * detail::Deg2Rad<T>();
+}
+
+template <typename T>
+ACOW_CONSTEXPR_STRICT inline T
+ToDegrees(T radians) noexcept
+{
+    return radians * detail::Rad2Deg<T>();
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Same angle in [-pi, pi) - A floor instead of fmod, so it's the
+///   same math as the batch version. Rounding can give pi itself for
+///   the angles right below it.
+template <typename T>
+inline T
+WrapRadians(T radians) noexcept
+{
+    return radians - detail::Tau<T>() * std::floor((radians + detail::Pi<T>()) * (T(1) / detail::Tau<T>()));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Same angle in [-180, 180) - See WrapRadians.
+template <typename T>
+inline T
+WrapDegrees(T degrees) noexcept
+{
+    return degrees - T(360) * std::floor((degrees + T(180)) * (T(1) / T(360)));
+}
+
 
 //----------------------------------------------------------------------------//
 // Power of Two                                                               //
 //----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief False for negative values - The sign bit alone isn't a power
+///   of two of T.
+template <typename T>
 ACOW_CONSTEXPR_STRICT inline bool
-IsPOT(unsigned int value) noexcept
+IsPOT(T value) noexcept
 {
     //--------------------------------------------------------------------------
     // Thanks to seander:
     //   https://graphics.stanford.edu/~seander/bithacks.html
-    return (value && !(value & (value - 1)));
+    typedef typename detail::BitsOf<T>::Unsigned U;
+    return (U(value) && !detail::IsAboveMax<T>(U(value)) && !(U(value) & (U(value) - 1)));
 }
 
-ACOW_CONSTEXPR_LOOSE inline unsigned int
+static_assert( IsPOT(1) &&  IsPOT(u32(0x80000000u)) &&  IsPOT(u64(1) << 63) && IsPOT(i64(1) << 62), "IsPOT");
+static_assert(!IsPOT(0) && !IsPOT(6) && !IsPOT(i8(-128)), "IsPOT");
+static_assert(!IsPOT(std::numeric_limits<i32>::min()) && !IsPOT(std::numeric_limits<i64>::min()), "IsPOT");
+
+ACOW_CONSTEXPR_STRICT inline unsigned int
 ClosestPOT(unsigned int value) noexcept
 {
-    value--;
-    value |= value >> 1;
-    value |= value >> 2;
-    value |= value >> 4;
-    value |= value >> 8;
-    value |= value >> 16;
-    value++;
-
-    return value;
+    // The old shift cascade gave 0 for 0 - NextPOT gives 1.
+    //   See Bits.h for the other widths and the rest of the bit utilities.
+    return NextPOT(value);
 }
 
 //----------------------------------------------------------------------------//
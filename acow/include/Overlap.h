@@ -0,0 +1,394 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Overlap.h                                                     //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Overlap tests between every pair of Rect, Circle and OBB - constexpr    //
+//    for single pairs and simd::f32x kernels for one shape against arrays    //
+//    stored as SoA (one array per field).                                    //
+//                                                                            //
+//    Touching shapes don't overlap, same as Rect::Intersects.                //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Bits.h"
+#include "Circle.h"
+#include "Instrumentation.h"
+#include "OBB.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+namespace detail {
+
+ACOW_CONSTEXPR_STRICT inline float
+OverlapAbs(float v) noexcept
+{
+    return (v < 0.0f) ? -v : v;
+}
+
+ACOW_CONSTEXPR_STRICT inline float
+OverlapClamp(float v, float lo, float hi) noexcept
+{
+    return (v < lo) ? lo : (v > hi) ? hi : v;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Single Pair                                                                //
+//----------------------------------------------------------------------------//
+ACOW_CONSTEXPR_STRICT inline bool
+Overlaps(const Rect &a, const Rect &b) noexcept
+{
+    return a.Intersects(b);
+}
+
+ACOW_CONSTEXPR_STRICT inline bool
+Overlaps(const Circle &a, const Circle &b) noexcept
+{
+    return a.center.DistanceSqr(b.center) < (a.radius + b.radius) * (a.radius + b.radius);
+}
+
+ACOW_CONSTEXPR_LOOSE inline bool
+Overlaps(const Rect &rect, const Circle &circle) noexcept
+{
+    // Closest point of the rect to the center.
+    auto px = detail::OverlapClamp(circle.center.x, rect.GetLeft(), rect.GetRight ());
+    auto py = detail::OverlapClamp(circle.center.y, rect.GetTop (), rect.GetBottom());
+
+    auto dx = circle.center.x - px;
+    auto dy = circle.center.y - py;
+    return (dx * dx + dy * dy) < (circle.radius * circle.radius);
+}
+
+ACOW_CONSTEXPR_LOOSE inline bool
+Overlaps(const OBB &box, const Circle &circle) noexcept
+{
+    // Same as the rect, in the box space.
+    auto local = box.ToLocal(circle.center);
+    auto px    = detail::OverlapClamp(local.x, -box.halfExtents.x, box.halfExtents.x);
+    auto py    = detail::OverlapClamp(local.y, -box.halfExtents.y, box.halfExtents.y);
+
+    auto dx = local.x - px;
+    auto dy = local.y - py;
+    return (dx * dx + dy * dy) < (circle.radius * circle.radius);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Separating axis test on the 4 box axes.
+ACOW_CONSTEXPR_LOOSE inline bool
+Overlaps(const OBB &a, const OBB &b) noexcept
+{
+    using detail::OverlapAbs;
+
+    auto t  = b.center - a.center;
+    auto ua = a.GetAxisX(); auto va = a.GetAxisY();
+    auto ub = b.GetAxisX(); auto vb = b.GetAxisY();
+
+    // Rotation of b in the a space.
+    auto r00 = OverlapAbs(Dot(ua, ub)); auto r01 = OverlapAbs(Dot(ua, vb));
+    auto r10 = OverlapAbs(Dot(va, ub)); auto r11 = OverlapAbs(Dot(va, vb));
+
+    const auto &ha = a.halfExtents;
+    const auto &hb = b.halfExtents;
+
+    return OverlapAbs(Dot(t, ua)) < ha.x + hb.x * r00 + hb.y * r01
+        && OverlapAbs(Dot(t, va)) < ha.y + hb.x * r10 + hb.y * r11
+        && OverlapAbs(Dot(t, ub)) < hb.x + ha.x * r00 + ha.y * r10
+        && OverlapAbs(Dot(t, vb)) < hb.y + ha.x * r01 + ha.y * r11;
+}
+
+ACOW_CONSTEXPR_LOOSE inline bool
+Overlaps(const OBB &box, const Rect &rect) noexcept
+{
+    return Overlaps(box, OBB::FromRect(rect));
+}
+
+// Swapped arguments.
+ACOW_CONSTEXPR_LOOSE inline bool Overlaps(const Circle &c, const Rect &r) noexcept { return Overlaps(r, c); }
+ACOW_CONSTEXPR_LOOSE inline bool Overlaps(const Circle &c, const OBB  &b) noexcept { return Overlaps(b, c); }
+ACOW_CONSTEXPR_LOOSE inline bool Overlaps(const Rect   &r, const OBB  &b) noexcept { return Overlaps(b, r); }
+
+
+//----------------------------------------------------------------------------//
+// SoA                                                                        //
+//----------------------------------------------------------------------------//
+struct RectSoA
+{
+    const float *pX;
+    const float *pY;
+    const float *pW;
+    const float *pH;
+    size_t       count;
+}; // struct RectSoA
+
+struct CircleSoA
+{
+    const float *pX;
+    const float *pY;
+    const float *pRadius;
+    size_t       count;
+}; // struct CircleSoA
+
+///-----------------------------------------------------------------------------
+/// @brief pCos / pSin as in OBB::GetCos / OBB::GetSin.
+struct OBBSoA
+{
+    const float *pX;
+    const float *pY;
+    const float *pHalfX;
+    const float *pHalfY;
+    const float *pCos;
+    const float *pSin;
+    size_t       count;
+}; // struct OBBSoA
+
+
+namespace detail {
+
+//----------------------------------------------------------------------------//
+// Lanes                                                                      //
+//   kWidth shapes of a kind - Masks are all ones where they overlap.         //
+//----------------------------------------------------------------------------//
+struct RectLanes   { simd::f32x left, top, right, bottom;         };
+struct CircleLanes { simd::f32x x, y, radius;                     };
+struct OBBLanes    { simd::f32x x, y, halfX, halfY, cosA, sinA;   };
+
+//------------------------------------------------------------------------------
+// Broadcast
+inline RectLanes
+BroadcastLanes(const Rect &r) noexcept
+{
+    return RectLanes{
+        simd::Set1(r.GetLeft ()), simd::Set1(r.GetTop   ()),
+        simd::Set1(r.GetRight()), simd::Set1(r.GetBottom())
+    };
+}
+
+inline CircleLanes
+BroadcastLanes(const Circle &c) noexcept
+{
+    return CircleLanes{ simd::Set1(c.center.x), simd::Set1(c.center.y), simd::Set1(c.radius) };
+}
+
+inline OBBLanes
+BroadcastLanes(const OBB &b) noexcept
+{
+    return OBBLanes{
+        simd::Set1(b.center.x),      simd::Set1(b.center.y),
+        simd::Set1(b.halfExtents.x), simd::Set1(b.halfExtents.y),
+        simd::Set1(b.GetCos()),      simd::Set1(b.GetSin())
+    };
+}
+
+//------------------------------------------------------------------------------
+// Load
+inline RectLanes
+LoadLanes(const RectSoA &soa, size_t i) noexcept
+{
+    auto x = simd::Load(soa.pX + i);
+    auto y = simd::Load(soa.pY + i);
+    return RectLanes{
+        x, y,
+        simd::Add(x, simd::Load(soa.pW + i)),
+        simd::Add(y, simd::Load(soa.pH + i))
+    };
+}
+
+inline CircleLanes
+LoadLanes(const CircleSoA &soa, size_t i) noexcept
+{
+    return CircleLanes{
+        simd::Load(soa.pX + i), simd::Load(soa.pY + i), simd::Load(soa.pRadius + i)
+    };
+}
+
+inline OBBLanes
+LoadLanes(const OBBSoA &soa, size_t i) noexcept
+{
+    return OBBLanes{
+        simd::Load(soa.pX    + i), simd::Load(soa.pY    + i),
+        simd::Load(soa.pHalfX + i), simd::Load(soa.pHalfY + i),
+        simd::Load(soa.pCos  + i), simd::Load(soa.pSin  + i)
+    };
+}
+
+//------------------------------------------------------------------------------
+// Single element of the SoA - For the tails.
+inline Rect   GetElement(const RectSoA   &s, size_t i) noexcept { return Rect(s.pX[i], s.pY[i], s.pW[i], s.pH[i]); }
+inline Circle GetElement(const CircleSoA &s, size_t i) noexcept { return Circle(s.pX[i], s.pY[i], s.pRadius[i]); }
+
+inline OBB
+GetElement(const OBBSoA &s, size_t i) noexcept
+{
+    return OBB(Vec2(s.pX[i], s.pY[i]), Vec2(s.pHalfX[i], s.pHalfY[i]), s.pCos[i], s.pSin[i]);
+}
+
+//------------------------------------------------------------------------------
+// Kernels
+inline simd::f32x
+LanesAbs(simd::f32x v) noexcept
+{
+    return simd::Max(v, simd::Sub(simd::Zero(), v));
+}
+
+inline simd::f32x
+LanesClamp(simd::f32x v, simd::f32x lo, simd::f32x hi) noexcept
+{
+    return simd::Min(hi, simd::Max(lo, v));
+}
+
+inline OBBLanes
+ToOBBLanes(const RectLanes &r) noexcept
+{
+    auto half = simd::Set1(0.5f);
+    auto hx   = simd::Mul(simd::Sub(r.right,  r.left), half);
+    auto hy   = simd::Mul(simd::Sub(r.bottom, r.top),  half);
+    return OBBLanes{
+        simd::Add(r.left, hx), simd::Add(r.top, hy),
+        hx, hy,
+        simd::Set1(1.0f), simd::Zero()
+    };
+}
+
+inline simd::f32x
+OverlapLanes(const RectLanes &a, const RectLanes &b) noexcept
+{
+    return simd::And(
+        simd::And(simd::Less(a.left, b.right),  simd::Less(b.left, a.right)),
+        simd::And(simd::Less(a.top,  b.bottom), simd::Less(b.top,  a.bottom))
+    );
+}
+
+inline simd::f32x
+OverlapLanes(const CircleLanes &a, const CircleLanes &b) noexcept
+{
+    auto dx = simd::Sub(a.x, b.x);
+    auto dy = simd::Sub(a.y, b.y);
+    auto r  = simd::Add(a.radius, b.radius);
+    return simd::Less(simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy)), simd::Mul(r, r));
+}
+
+inline simd::f32x
+OverlapLanes(const RectLanes &r, const CircleLanes &c) noexcept
+{
+    auto dx = simd::Sub(c.x, LanesClamp(c.x, r.left, r.right));
+    auto dy = simd::Sub(c.y, LanesClamp(c.y, r.top,  r.bottom));
+    return simd::Less(
+        simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy)),
+        simd::Mul(c.radius, c.radius)
+    );
+}
+
+inline simd::f32x
+OverlapLanes(const OBBLanes &b, const CircleLanes &c) noexcept
+{
+    auto tx = simd::Sub(c.x, b.x);
+    auto ty = simd::Sub(c.y, b.y);
+    auto lx = simd::Add(simd::Mul(tx, b.cosA), simd::Mul(ty, b.sinA));
+    auto ly = simd::Sub(simd::Mul(ty, b.cosA), simd::Mul(tx, b.sinA));
+
+    auto dx = simd::Sub(lx, LanesClamp(lx, simd::Sub(simd::Zero(), b.halfX), b.halfX));
+    auto dy = simd::Sub(ly, LanesClamp(ly, simd::Sub(simd::Zero(), b.halfY), b.halfY));
+    return simd::Less(
+        simd::Add(simd::Mul(dx, dx), simd::Mul(dy, dy)),
+        simd::Mul(c.radius, c.radius)
+    );
+}
+
+inline simd::f32x
+OverlapLanes(const OBBLanes &a, const OBBLanes &b) noexcept
+{
+    auto tx = simd::Sub(b.x, a.x);
+    auto ty = simd::Sub(b.y, a.y);
+
+    // Axes: ua = (c, s), va = (-s, c) - Dots written out.
+    auto dot = [](simd::f32x ax, simd::f32x ay, simd::f32x bx, simd::f32x by) {
+        return simd::Add(simd::Mul(ax, bx), simd::Mul(ay, by));
+    };
+    auto neg_sa = simd::Sub(simd::Zero(), a.sinA);
+    auto neg_sb = simd::Sub(simd::Zero(), b.sinA);
+
+    auto r00 = LanesAbs(dot(a.cosA, a.sinA, b.cosA, b.sinA));
+    auto r01 = LanesAbs(dot(a.cosA, a.sinA, neg_sb, b.cosA));
+    auto r10 = LanesAbs(dot(neg_sa, a.cosA, b.cosA, b.sinA));
+    auto r11 = LanesAbs(dot(neg_sa, a.cosA, neg_sb, b.cosA));
+
+    auto t_ua = LanesAbs(dot(tx, ty, a.cosA, a.sinA));
+    auto t_va = LanesAbs(dot(tx, ty, neg_sa, a.cosA));
+    auto t_ub = LanesAbs(dot(tx, ty, b.cosA, b.sinA));
+    auto t_vb = LanesAbs(dot(tx, ty, neg_sb, b.cosA));
+
+    auto m0 = simd::Less(t_ua, simd::Add(a.halfX, simd::Add(simd::Mul(b.halfX, r00), simd::Mul(b.halfY, r01))));
+    auto m1 = simd::Less(t_va, simd::Add(a.halfY, simd::Add(simd::Mul(b.halfX, r10), simd::Mul(b.halfY, r11))));
+    auto m2 = simd::Less(t_ub, simd::Add(b.halfX, simd::Add(simd::Mul(a.halfX, r00), simd::Mul(a.halfY, r10))));
+    auto m3 = simd::Less(t_vb, simd::Add(b.halfY, simd::Add(simd::Mul(a.halfX, r01), simd::Mul(a.halfY, r11))));
+
+    return simd::And(simd::And(m0, m1), simd::And(m2, m3));
+}
+
+inline simd::f32x OverlapLanes(const OBBLanes    &b, const RectLanes   &r) noexcept { return OverlapLanes(b, ToOBBLanes(r)); }
+inline simd::f32x OverlapLanes(const CircleLanes &c, const RectLanes   &r) noexcept { return OverlapLanes(r, c); }
+inline simd::f32x OverlapLanes(const CircleLanes &c, const OBBLanes    &b) noexcept { return OverlapLanes(b, c); }
+inline simd::f32x OverlapLanes(const RectLanes   &r, const OBBLanes    &b) noexcept { return OverlapLanes(b, r); }
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Batch                                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Tests shape (Rect, Circle or OBB) against every element of the
+///   RectSoA, CircleSoA or OBBSoA - pOut_Hits[i] is 1 when they overlap.
+/// @returns How many overlap.
+template <typename TShape, typename TSoA>
+inline size_t
+Overlaps(const TShape &shape, const TSoA &soa, u8 *pOut_Hits) noexcept
+{
+    ACOW_MATH_TIME(BatchOverlaps, soa.count);
+
+    auto lanes = detail::BroadcastLanes(shape);
+
+    size_t hits = 0;
+    size_t i    = 0;
+    for(; i + simd::kWidth <= soa.count; i += simd::kWidth) {
+        auto mask = u32(simd::MoveMask(detail::OverlapLanes(lanes, detail::LoadLanes(soa, i))));
+        for(size_t j = 0; j < simd::kWidth; ++j) {
+            pOut_Hits[i + j] = u8((mask >> j) & 1u);
+        }
+        hits += PopCount(mask);
+    }
+    for(; i < soa.count; ++i) {
+        auto hit = Overlaps(shape, detail::GetElement(soa, i));
+        pOut_Hits[i] = u8(hit);
+        hits += hit;
+    }
+
+    return hits;
+}
+
+} // namespace math
+} // namespace acow
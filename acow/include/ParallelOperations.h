@@ -0,0 +1,207 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParallelOperations.h                                          //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    The batch kernels (BatchOperations.h, Bounds.h, Overlap.h) split over   //
+//    a ThreadPool with ParallelFor / ParallelReduce - Same results as the    //
+//    single threaded versions.                                               //
+//                                                                            //
+//    Spans smaller than grainSize run on the calling thread.                 //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "BatchOperations.h"
+#include "Bounds.h"
+#include "Overlap.h"
+#include "ThreadPool.h"
+
+
+namespace acow { namespace math { namespace parallel {
+
+///-----------------------------------------------------------------------------
+/// @brief Elements of each chunk - Big enough that handing a chunk to
+///   another thread costs much less than processing it.
+constexpr static size_t kDefaultGrainSize = 64 * 1024;
+
+
+//----------------------------------------------------------------------------//
+// Transforms                                                                 //
+//----------------------------------------------------------------------------//
+inline void
+Clamp(
+    const float *pValues,
+    size_t       count,
+    float        min,
+    float        max,
+    float       *pOut_Values,
+    size_t       grainSize = kDefaultGrainSize,
+    ThreadPool  &pool      = ThreadPool::GetDefault())
+{
+    ParallelFor(0, count, grainSize, [=](size_t b, size_t e) {
+        math::Clamp(pValues + b, e - b, min, max, pOut_Values + b);
+    }, pool);
+}
+
+inline void
+Clamp(
+    const Vec2 *pPoints,
+    size_t      count,
+    const Rect &bounds,
+    Vec2       *pOut_Points,
+    size_t      grainSize = kDefaultGrainSize,
+    ThreadPool &pool      = ThreadPool::GetDefault())
+{
+    ParallelFor(0, count, grainSize, [=, &bounds](size_t b, size_t e) {
+        math::Clamp(pPoints + b, e - b, bounds, pOut_Points + b);
+    }, pool);
+}
+
+inline void
+Lerp(
+    const Vec2 *pStart,
+    const Vec2 *pEnd,
+    size_t      count,
+    float       t,
+    Vec2       *pOut_Values,
+    size_t      grainSize = kDefaultGrainSize,
+    ThreadPool &pool      = ThreadPool::GetDefault())
+{
+    ParallelFor(0, count, grainSize, [=](size_t b, size_t e) {
+        math::Lerp(pStart + b, pEnd + b, e - b, t, pOut_Values + b);
+    }, pool);
+}
+
+inline void
+Normalize(
+    const Vec2 *pVectors,
+    size_t      count,
+    Vec2       *pOut_Vectors,
+    size_t      grainSize = kDefaultGrainSize,
+    ThreadPool &pool      = ThreadPool::GetDefault())
+{
+    ParallelFor(0, count, grainSize, [=](size_t b, size_t e) {
+        math::Normalize(pVectors + b, e - b, pOut_Vectors + b);
+    }, pool);
+}
+
+inline void
+Remap(
+    const float *pValues,
+    size_t       count,
+    float        inS,
+    float        inE,
+    float        outS,
+    float        outE,
+    float       *pOut_Values,
+    size_t       grainSize = kDefaultGrainSize,
+    ThreadPool  &pool      = ThreadPool::GetDefault())
+{
+    ParallelFor(0, count, grainSize, [=](size_t b, size_t e) {
+        math::Remap(pValues + b, e - b, inS, inE, outS, outE, pOut_Values + b);
+    }, pool);
+}
+
+
+//----------------------------------------------------------------------------//
+// Reductions                                                                 //
+//----------------------------------------------------------------------------//
+inline Rect
+ComputeBounds(
+    const Vec2 *pPoints,
+    size_t      count,
+    size_t      grainSize = kDefaultGrainSize,
+    ThreadPool &pool      = ThreadPool::GetDefault())
+{
+    if(count == 0) {
+        return Rect();
+    }
+
+    // The first point as the identity - It's in every union anyway.
+    return ParallelReduce(
+        0, count, grainSize,
+        math::ComputeBounds(pPoints, 1),
+        [=](size_t b, size_t e) {
+            return math::ComputeBounds(pPoints + b, e - b);
+        },
+        [](const Rect &a, const Rect &b) {
+            auto left   = std::min(a.GetLeft  (), b.GetLeft  ());
+            auto top    = std::min(a.GetTop   (), b.GetTop   ());
+            auto right  = std::max(a.GetRight (), b.GetRight ());
+            auto bottom = std::max(a.GetBottom(), b.GetBottom());
+            return Rect(left, top, right - left, bottom - top);
+        },
+        pool
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// Culling                                                                    //
+//----------------------------------------------------------------------------//
+namespace detail {
+
+inline RectSoA
+SliceSoA(const RectSoA &s, size_t b, size_t e) noexcept
+{
+    return RectSoA{ s.pX + b, s.pY + b, s.pW + b, s.pH + b, e - b };
+}
+
+inline CircleSoA
+SliceSoA(const CircleSoA &s, size_t b, size_t e) noexcept
+{
+    return CircleSoA{ s.pX + b, s.pY + b, s.pRadius + b, e - b };
+}
+
+inline OBBSoA
+SliceSoA(const OBBSoA &s, size_t b, size_t e) noexcept
+{
+    return OBBSoA{
+        s.pX + b, s.pY + b, s.pHalfX + b, s.pHalfY + b, s.pCos + b, s.pSin + b, e - b
+    };
+}
+
+} // namespace detail
+
+///-----------------------------------------------------------------------------
+/// @brief Same as math::Overlaps(shape, soa, pOut_Hits).
+template <typename TShape, typename TSoA>
+inline size_t
+Overlaps(
+    const TShape &shape,
+    const TSoA   &soa,
+    u8           *pOut_Hits,
+    size_t        grainSize = kDefaultGrainSize,
+    ThreadPool   &pool      = ThreadPool::GetDefault())
+{
+    return ParallelReduce(
+        0, soa.count, grainSize,
+        size_t(0),
+        [&](size_t b, size_t e) {
+            return math::Overlaps(shape, detail::SliceSoA(soa, b, e), pOut_Hits + b);
+        },
+        [](size_t a, size_t b) { return a + b; },
+        pool
+    );
+}
+
+} // namespace parallel
+} // namespace math
+} // namespace acow
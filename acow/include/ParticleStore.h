@@ -0,0 +1,425 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParticleStore.h                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Particles as SoA (one float array per field) so the integration runs    //
+//    on simd::f32x. Dead particles are removed by swapping the last one      //
+//    into their place - The order isn't kept.                                //
+//                                                                            //
+//    IntegrateParallel splits the particles in cache line aligned chunks     //
+//    over a ThreadPool.                                                      //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstdint>
+#include <limits>
+#include <new>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Bits.h"
+#include "Instrumentation.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "ThreadPool.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+namespace detail {
+
+///-----------------------------------------------------------------------------
+/// @brief Allocator whose blocks start on a cache line - operator new
+///   only guarantees 16 bytes in C++14, so it over allocates and keeps
+///   the pointer it got right before the aligned block.
+template <typename T>
+struct CacheLineAllocator
+{
+    typedef T value_type;
+
+    constexpr static size_t kAlignment = 64;
+
+    CacheLineAllocator() noexcept = default;
+
+    template <typename U>
+    CacheLineAllocator(const CacheLineAllocator<U> &) noexcept
+    {
+        // Empty...
+    }
+
+    inline T*
+    allocate(size_t count)
+    {
+        const auto kExtra = kAlignment + sizeof(void*);
+        if(count > (std::numeric_limits<size_t>::max() - kExtra) / sizeof(T)) {
+            throw std::bad_alloc();
+        }
+
+        auto p_raw   = static_cast<u8*>(::operator new(count * sizeof(T) + kExtra));
+        auto address = AlignUp(reinterpret_cast<uintptr_t>(p_raw + sizeof(void*)), uintptr_t(kAlignment));
+        auto p_block = reinterpret_cast<void**>(address);
+
+        p_block[-1] = p_raw;
+        return reinterpret_cast<T*>(p_block);
+    }
+
+    inline void
+    deallocate(T *p, size_t) noexcept
+    {
+        ::operator delete(reinterpret_cast<void**>(p)[-1]);
+    }
+};
+
+template <typename T, typename U>
+inline bool operator==(const CacheLineAllocator<T> &, const CacheLineAllocator<U> &) noexcept { return true;  }
+
+template <typename T, typename U>
+inline bool operator!=(const CacheLineAllocator<T> &, const CacheLineAllocator<U> &) noexcept { return false; }
+
+} // namespace detail
+
+
+class ParticleStore
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    enum class Field {
+        PositionX, PositionY,
+        VelocityX, VelocityY,
+        AccelerationX, AccelerationY,
+        Lifetime,
+
+        Count
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief SemiImplicitEuler - v += a * dt; p += v * dt.
+    ///   VelocityVerlet         - p += (v + a * dt / 2) * dt; v += a * dt.
+    ///   Verlet is exact for constant accelerations (projectiles), Euler
+    ///   undershoots them by a * dt^2 / 2 every step.
+    enum class Integrator {
+        SemiImplicitEuler,
+        VelocityVerlet
+    };
+
+    constexpr static size_t kFieldsCount      = size_t(Field::Count);
+    constexpr static size_t kDefaultGrainSize = 64 * 1024;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit
+    ParticleStore(size_t capacity = 0)
+    {
+        Reserve(capacity);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Particles                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @returns The index of the particle - Only valid until the next
+    ///   RemoveDead().
+    inline size_t
+    Emit(
+        const Vec2 &position,
+        const Vec2 &velocity,
+        const Vec2 &acceleration,
+        float       lifetime)
+    {
+        const float values[kFieldsCount] = {
+            position    .x, position    .y,
+            velocity    .x, velocity    .y,
+            acceleration.x, acceleration.y,
+            lifetime
+        };
+        for(size_t f = 0; f < kFieldsCount; ++f) {
+            m_fields[f].push_back(values[f]);
+        }
+
+        return GetCount() - 1;
+    }
+
+    inline void
+    Reserve(size_t capacity)
+    {
+        for(auto &field : m_fields) {
+            field.reserve(capacity);
+        }
+    }
+
+    inline void
+    Clear() noexcept
+    {
+        for(auto &field : m_fields) {
+            field.clear();
+        }
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Removes the particles with lifetime <= 0 - The last particle
+    ///   takes the place of each removed one.
+    /// @returns How many were removed.
+    inline size_t
+    RemoveDead() noexcept
+    {
+        auto p_life = GetField(Field::Lifetime);
+        auto count  = GetCount();
+
+        size_t i = 0;
+        while(i < count) {
+            if(p_life[i] > 0.0f) {
+                ++i;
+                continue;
+            }
+
+            --count;
+            for(auto &field : m_fields) {
+                field[i] = field[count];
+            }
+        }
+
+        auto removed = GetCount() - count;
+        for(auto &field : m_fields) {
+            field.resize(count);
+        }
+        return removed;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Integration                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Moves every particle dt forward and takes dt of their lifetime.
+    inline void
+    Integrate(float dt, Integrator integrator = Integrator::SemiImplicitEuler) noexcept
+    {
+        IntegrateRange(0, GetCount(), dt, integrator);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as Integrate, in chunks of grainSize particles over the
+    ///   pool. Rounded up to whole cache lines - The fields start on a
+    ///   cache line, so no line is written by two threads.
+    inline void
+    IntegrateParallel(
+        float       dt,
+        Integrator  integrator = Integrator::SemiImplicitEuler,
+        size_t      grainSize  = kDefaultGrainSize,
+        ThreadPool &pool       = ThreadPool::GetDefault())
+    {
+        const size_t kAlignment = 64 / sizeof(float);
+        grainSize = (grainSize + kAlignment - 1) / kAlignment * kAlignment;
+
+        ParallelFor(0, GetCount(), grainSize, [=](size_t b, size_t e) {
+            IntegrateRange(b, e, dt, integrator);
+        }, pool);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Culling                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the lifetime of the particles outside of bounds to 0, so
+    ///   the next RemoveDead() takes them out. Same test as Rect::Contains.
+    inline void
+    KillOutside(const Rect &bounds) noexcept
+    {
+        auto p_x    = GetField(Field::PositionX);
+        auto p_y    = GetField(Field::PositionY);
+        auto p_life = GetField(Field::Lifetime);
+        auto count  = GetCount();
+
+        auto left  = simd::Set1(bounds.GetLeft ()); auto right  = simd::Set1(bounds.GetRight ());
+        auto top   = simd::Set1(bounds.GetTop  ()); auto bottom = simd::Set1(bounds.GetBottom());
+
+        size_t i = 0;
+        for(; i + simd::kWidth <= count; i += simd::kWidth) {
+            auto inside = InsideLanes(
+                simd::Load(p_x + i), simd::Load(p_y + i),
+                left, top, right, bottom
+            );
+            // Zero is 0.0f, so the mask keeps or kills the lifetime.
+            simd::Store(p_life + i, simd::And(inside, simd::Load(p_life + i)));
+        }
+        for(; i < count; ++i) {
+            if(!bounds.Contains(p_x[i], p_y[i])) {
+                p_life[i] = 0.0f;
+            }
+        }
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Indices of the particles inside of bounds, in order - For the
+    ///   rendering. pOut_Indices needs room for GetCount() indices.
+    /// @returns How many are inside.
+    inline size_t
+    GatherInside(const Rect &bounds, u32 *pOut_Indices) const noexcept
+    {
+        auto p_x   = GetField(Field::PositionX);
+        auto p_y   = GetField(Field::PositionY);
+        auto count = GetCount();
+
+        auto left  = simd::Set1(bounds.GetLeft ()); auto right  = simd::Set1(bounds.GetRight ());
+        auto top   = simd::Set1(bounds.GetTop  ()); auto bottom = simd::Set1(bounds.GetBottom());
+
+        size_t found = 0;
+        size_t i     = 0;
+        for(; i + simd::kWidth <= count; i += simd::kWidth) {
+            auto mask = u32(simd::MoveMask(InsideLanes(
+                simd::Load(p_x + i), simd::Load(p_y + i),
+                left, top, right, bottom
+            )));
+            while(mask != 0) {
+                pOut_Indices[found++] = u32(i) + u32(CountTrailingZeros(mask));
+                mask &= mask - 1;
+            }
+        }
+        for(; i < count; ++i) {
+            if(bounds.Contains(p_x[i], p_y[i])) {
+                pOut_Indices[found++] = u32(i);
+            }
+        }
+
+        return found;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    inline size_t GetCount() const noexcept { return m_fields[0].size(); }
+
+    ///-------------------------------------------------------------------------
+    /// @brief GetCount() floats - To apply forces or read the positions in
+    ///   bulk. Invalidated by Emit and RemoveDead.
+    inline float*       GetField(Field field)       noexcept { return m_fields[size_t(field)].data(); }
+    inline const float* GetField(Field field) const noexcept { return m_fields[size_t(field)].data(); }
+
+    inline Vec2
+    GetPosition(size_t index) const noexcept
+    {
+        return Vec2(At(Field::PositionX, index), At(Field::PositionY, index));
+    }
+
+    inline Vec2
+    GetVelocity(size_t index) const noexcept
+    {
+        return Vec2(At(Field::VelocityX, index), At(Field::VelocityY, index));
+    }
+
+    inline Vec2
+    GetAcceleration(size_t index) const noexcept
+    {
+        return Vec2(At(Field::AccelerationX, index), At(Field::AccelerationY, index));
+    }
+
+    inline float GetLifetime(size_t index) const noexcept { return At(Field::Lifetime, index); }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline float
+    At(Field field, size_t index) const noexcept
+    {
+        return m_fields[size_t(field)][index];
+    }
+
+    inline static simd::f32x
+    InsideLanes(
+        simd::f32x x,    simd::f32x y,
+        simd::f32x left, simd::f32x top, simd::f32x right, simd::f32x bottom) noexcept
+    {
+        return simd::And(
+            simd::And(simd::GreaterEqual(x, left), simd::Less(x, right)),
+            simd::And(simd::GreaterEqual(y, top),  simd::Less(y, bottom))
+        );
+    }
+
+    inline void
+    IntegrateRange(size_t begin, size_t end, float dt, Integrator integrator) noexcept
+    {
+        ACOW_MATH_TIME(ParticleIntegrate, end - begin);
+
+        auto p_px   = GetField(Field::PositionX);
+        auto p_py   = GetField(Field::PositionY);
+        auto p_vx   = GetField(Field::VelocityX);
+        auto p_vy   = GetField(Field::VelocityY);
+        auto p_ax   = GetField(Field::AccelerationX);
+        auto p_ay   = GetField(Field::AccelerationY);
+        auto p_life = GetField(Field::Lifetime);
+
+        // Euler moves with the new velocity, Verlet with the one in the
+        // middle of the step - v + a * half_dt.
+        auto half_dt = (integrator == Integrator::VelocityVerlet) ? dt * 0.5f : dt;
+
+        auto v_dt      = simd::Set1(dt);
+        auto v_half_dt = simd::Set1(half_dt);
+
+        size_t i = begin;
+        for(; i + simd::kWidth <= end; i += simd::kWidth) {
+            auto ax = simd::Load(p_ax + i);
+            auto ay = simd::Load(p_ay + i);
+            auto vx = simd::Load(p_vx + i);
+            auto vy = simd::Load(p_vy + i);
+
+            auto mx = simd::Add(vx, simd::Mul(ax, v_half_dt));
+            auto my = simd::Add(vy, simd::Mul(ay, v_half_dt));
+
+            simd::Store(p_px   + i, simd::Add(simd::Load(p_px + i), simd::Mul(mx, v_dt)));
+            simd::Store(p_py   + i, simd::Add(simd::Load(p_py + i), simd::Mul(my, v_dt)));
+            simd::Store(p_vx   + i, simd::Add(vx, simd::Mul(ax, v_dt)));
+            simd::Store(p_vy   + i, simd::Add(vy, simd::Mul(ay, v_dt)));
+            simd::Store(p_life + i, simd::Sub(simd::Load(p_life + i), v_dt));
+        }
+        for(; i < end; ++i) {
+            p_px  [i] += (p_vx[i] + p_ax[i] * half_dt) * dt;
+            p_py  [i] += (p_vy[i] + p_ay[i] * half_dt) * dt;
+            p_vx  [i] += p_ax[i] * dt;
+            p_vy  [i] += p_ay[i] * dt;
+            p_life[i] -= dt;
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<float, detail::CacheLineAllocator<float>> m_fields[kFieldsCount];
+
+}; // class ParticleStore
+
+} // namespace math
+} // namespace acow
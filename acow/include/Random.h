@@ -0,0 +1,643 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Random.h                                                      //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Small and fast PRNGs, plus a multi-lane stream that fills arrays in bulk//
+//    (the lanes are laid out so the compiler vectorizes the update).         //
+//                                                                            //
+//      SplitMix64     - Seeding only.                                        //
+//      Pcg32          - 64 bit state, arbitrary Advance(n).                  //
+//      Xoshiro128     - xoshiro128++, Jump() / LongJump() for sub streams.   //
+//      RandomStream   - 8 xoshiro128++ lanes, 2^64 calls apart from each     //
+//                       other; Give each thread its own streamIndex.         //
+//                                                                            //
+//    Thanks to Vigna and O'Neill:                                            //
+//      https://prng.di.unimi.it                                              //
+//      https://www.pcg-random.org                                            //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstring>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Constants.h"
+#include "Coord.h"
+#include "DeterministicMath.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+namespace detail {
+
+ACOW_CONSTEXPR_STRICT inline u32
+Rotl32(u32 x, i32 k) noexcept
+{
+    return (x << k) | (x >> (32 - k));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Top 24 bits to a float in [0, 1) - Every value is exact.
+ACOW_CONSTEXPR_STRICT inline float
+U32ToUnitFloat(u32 x) noexcept
+{
+    return float(x >> 8) * (1.0f / 16777216.0f);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Maps x to [0, range) with a multiply instead of a modulo.
+///   The bias is at most range / 2^32, way below what a game can notice.
+ACOW_CONSTEXPR_STRICT inline u32
+U32ToRange(u32 x, u32 range) noexcept
+{
+    return u32((u64(x) * u64(range)) >> 32);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief How many of the 4 values starting at index are still before count.
+ACOW_CONSTEXPR_STRICT inline size_t
+CountAt(size_t index, size_t count) noexcept
+{
+    return (index >= count    ) ? 0
+         : (count - index < 4) ? (count - index)
+         : 4;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// SplitMix64                                                                 //
+//----------------------------------------------------------------------------//
+class SplitMix64
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT explicit
+    SplitMix64(u64 seed) noexcept
+        : m_state(seed)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_LOOSE inline u64
+    Next() noexcept
+    {
+        auto z = (m_state += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    u64 m_state;
+
+}; // class SplitMix64
+
+
+//----------------------------------------------------------------------------//
+// Pcg32                                                                      //
+//----------------------------------------------------------------------------//
+class Pcg32
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static u64 kMultiplier    = 6364136223846793005ull;
+    constexpr static u64 kDefaultStream = 0xDA3E39CB94B95BDBull;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Generators with different streams never share a sequence,
+    ///   even with the same seed.
+    ACOW_CONSTEXPR_LOOSE explicit
+    Pcg32(u64 seed, u64 stream = kDefaultStream) noexcept
+        : m_state    (0)
+        , m_increment((stream << 1) | 1)
+    {
+        Next();
+        m_state += seed;
+        Next();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_LOOSE inline u32
+    Next() noexcept
+    {
+        auto old = m_state;
+        m_state = old * kMultiplier + m_increment;
+
+        auto xorshifted = u32(((old >> 18) ^ old) >> 27);
+        auto rot        = u32(old >> 59);
+        return (xorshifted >> rot) | (xorshifted << ((0u - rot) & 31));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform float in [0, 1).
+    ACOW_CONSTEXPR_LOOSE inline float
+    NextFloat() noexcept
+    {
+        return detail::U32ToUnitFloat(Next());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform integer in [0, range).
+    ACOW_CONSTEXPR_LOOSE inline u32
+    NextInRange(u32 range) noexcept
+    {
+        return detail::U32ToRange(Next(), range);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as calling Next() delta times, in O(log delta).
+    ACOW_CONSTEXPR_LOOSE inline void
+    Advance(u64 delta) noexcept
+    {
+        // Brown, "Random Number Generation with Arbitrary Strides".
+        u64 acc_mult = 1;
+        u64 acc_plus = 0;
+        u64 cur_mult = kMultiplier;
+        u64 cur_plus = m_increment;
+
+        while(delta > 0) {
+            if(delta & 1) {
+                acc_mult *= cur_mult;
+                acc_plus  = acc_plus * cur_mult + cur_plus;
+            }
+            cur_plus  = (cur_mult + 1) * cur_plus;
+            cur_mult *= cur_mult;
+            delta   >>= 1;
+        }
+        m_state = acc_mult * m_state + acc_plus;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    u64 m_state;
+    u64 m_increment;
+
+}; // class Pcg32
+
+
+//----------------------------------------------------------------------------//
+// Xoshiro128                                                                 //
+//----------------------------------------------------------------------------//
+class Xoshiro128
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_LOOSE explicit
+    Xoshiro128(u64 seed) noexcept
+        : m_s{0, 0, 0, 0}
+    {
+        // SplitMix64 never gives the all zeros state that xoshiro can't leave.
+        auto sm = SplitMix64(seed);
+        auto a  = sm.Next();
+        auto b  = sm.Next();
+
+        m_s[0] = u32(a); m_s[1] = u32(a >> 32);
+        m_s[2] = u32(b); m_s[3] = u32(b >> 32);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_LOOSE inline u32
+    Next() noexcept
+    {
+        auto result = detail::Rotl32(m_s[0] + m_s[3], 7) + m_s[0];
+        auto t      = m_s[1] << 9;
+
+        m_s[2] ^= m_s[0];
+        m_s[3] ^= m_s[1];
+        m_s[1] ^= m_s[2];
+        m_s[0] ^= m_s[3];
+        m_s[2] ^= t;
+        m_s[3]  = detail::Rotl32(m_s[3], 11);
+
+        return result;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform float in [0, 1).
+    ACOW_CONSTEXPR_LOOSE inline float
+    NextFloat() noexcept
+    {
+        return detail::U32ToUnitFloat(Next());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform integer in [0, range).
+    ACOW_CONSTEXPR_LOOSE inline u32
+    NextInRange(u32 range) noexcept
+    {
+        return detail::U32ToRange(Next(), range);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as 2^64 calls to Next() - Gives 2^64 non-overlapping
+    ///   sub sequences.
+    ACOW_CONSTEXPR_LOOSE inline void
+    Jump() noexcept
+    {
+        const u32 poly[4] = { 0x8764000Bu, 0xF542D2D3u, 0x6FA035C3u, 0x77F2DB5Bu };
+        ApplyJump(poly);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as 2^96 calls to Next() - Gives 2^32 starting points,
+    ///   each one with room for 2^32 Jump()s.
+    ACOW_CONSTEXPR_LOOSE inline void
+    LongJump() noexcept
+    {
+        const u32 poly[4] = { 0xB523952Eu, 0x0B6F099Fu, 0xCCF5A0EFu, 0x1C580662u };
+        ApplyJump(poly);
+    }
+
+    inline void
+    GetState(u32 *pOut_State) const noexcept
+    {
+        std::memcpy(pOut_State, m_s, sizeof(m_s));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @warning The state can't be all zeros.
+    inline void
+    SetState(const u32 *pState) noexcept
+    {
+        std::memcpy(m_s, pState, sizeof(m_s));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    ACOW_CONSTEXPR_LOOSE inline void
+    ApplyJump(const u32 *pPoly) noexcept
+    {
+        u32 s[4] = { 0, 0, 0, 0 };
+        for(i32 i = 0; i < 4; ++i) {
+            for(i32 b = 0; b < 32; ++b) {
+                if(pPoly[i] & (u32(1) << b)) {
+                    s[0] ^= m_s[0]; s[1] ^= m_s[1];
+                    s[2] ^= m_s[2]; s[3] ^= m_s[3];
+                }
+                Next();
+            }
+        }
+        m_s[0] = s[0]; m_s[1] = s[1];
+        m_s[2] = s[2]; m_s[3] = s[3];
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    u32 m_s[4];
+
+}; // class Xoshiro128
+
+
+//----------------------------------------------------------------------------//
+// BasicRandomStream                                                          //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Lanes independent xoshiro128++ generators stepped together.
+///   The state is stored per word (all the s0, then all the s1...) so a
+///   step is a plain loop over the lanes that becomes vector code.
+/// @note The Fill functions work in blocks of Lanes values; the unused
+///   part of the last block is dropped. Same calls give the same values.
+template <size_t Lanes>
+class BasicRandomStream
+{
+    static_assert(Lanes > 0 && Lanes % 4 == 0, "Lanes must be a multiple of 4.");
+
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static size_t kLanes = Lanes;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Streams with the same seed and different streamIndex (one per
+    ///   thread, for example) never overlap - Each is a LongJump() apart.
+    explicit
+    BasicRandomStream(u64 seed, u32 streamIndex = 0) noexcept
+    {
+        auto base = Xoshiro128(seed);
+        for(u32 i = 0; i < streamIndex; ++i) {
+            base.LongJump();
+        }
+
+        for(size_t lane = 0; lane < Lanes; ++lane) {
+            u32 state[4];
+            base.GetState(state);
+
+            m_s0[lane] = state[0]; m_s1[lane] = state[1];
+            m_s2[lane] = state[2]; m_s3[lane] = state[3];
+
+            base.Jump();
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Steps the lanes blockCount times and calls func(values, index)
+    ///   for every 4 values, where index is the position of values[0] in the
+    ///   output - The building block of everything else.
+    /// @note The state lives in simd::u32x4 locals for the whole run - Left
+    ///   to the auto-vectorizer the lanes loop stays scalar. The values go
+    ///   out 4 at a time, since reading a whole block back right after the
+    ///   two 16 byte stores defeats the store forwarding.
+    template <typename Func>
+    inline void
+    ForEachBlock(size_t blockCount, Func func) noexcept
+    {
+        constexpr auto kGroups = Lanes / 4;
+
+        simd::u32x4 s0[kGroups], s1[kGroups], s2[kGroups], s3[kGroups];
+        for(size_t g = 0; g < kGroups; ++g) {
+            s0[g] = simd::Load(m_s0 + g * 4);
+            s1[g] = simd::Load(m_s1 + g * 4);
+            s2[g] = simd::Load(m_s2 + g * 4);
+            s3[g] = simd::Load(m_s3 + g * 4);
+        }
+
+        u32 values[4];
+        for(size_t b = 0; b < blockCount; ++b) {
+            for(size_t g = 0; g < kGroups; ++g) {
+                auto result = simd::Add(simd::RotateLeft(simd::Add(s0[g], s3[g]), 7), s0[g]);
+                simd::Store(values, result);
+                func(static_cast<const u32*>(values), b * Lanes + g * 4);
+
+                auto t = simd::ShiftLeft(s1[g], 9);
+                s2[g] = simd::Xor(s2[g], s0[g]);
+                s3[g] = simd::Xor(s3[g], s1[g]);
+                s1[g] = simd::Xor(s1[g], s2[g]);
+                s0[g] = simd::Xor(s0[g], s3[g]);
+                s2[g] = simd::Xor(s2[g], t);
+                s3[g] = simd::RotateLeft(s3[g], 11);
+            }
+        }
+
+        for(size_t g = 0; g < kGroups; ++g) {
+            simd::Store(m_s0 + g * 4, s0[g]);
+            simd::Store(m_s1 + g * 4, s1[g]);
+            simd::Store(m_s2 + g * 4, s2[g]);
+            simd::Store(m_s3 + g * 4, s3[g]);
+        }
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes one value per lane.
+    inline void
+    NextBlock(u32 *pOut_Values) noexcept
+    {
+        ForEachBlock(1, [pOut_Values](const u32 *pValues, size_t i) {
+            std::memcpy(pOut_Values + i, pValues, 4 * sizeof(u32));
+        });
+    }
+
+    inline void
+    Fill(u32 *pOut_Values, size_t count) noexcept
+    {
+        ForEachBlock(BlockCount(count), [=](const u32 *pValues, size_t i) {
+            auto n = detail::CountAt(i, count);
+            std::memcpy(pOut_Values + i, pValues, n * sizeof(u32));
+        });
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform floats in [0, 1).
+    inline void
+    Fill(float *pOut_Values, size_t count) noexcept
+    {
+        ForEachBlock(BlockCount(count), [=](const u32 *pValues, size_t i) {
+            auto n = detail::CountAt(i, count);
+            for(size_t j = 0; j < n; ++j) {
+                pOut_Values[i + j] = detail::U32ToUnitFloat(pValues[j]);
+            }
+        });
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform floats in [lo, hi] - hi itself may show up by rounding.
+    inline void
+    Fill(float *pOut_Values, size_t count, float lo, float hi) noexcept
+    {
+        auto range = (hi - lo);
+        ForEachBlock(BlockCount(count), [=](const u32 *pValues, size_t i) {
+            auto n = detail::CountAt(i, count);
+            for(size_t j = 0; j < n; ++j) {
+                pOut_Values[i + j] = lo + detail::U32ToUnitFloat(pValues[j]) * range;
+            }
+        });
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform integers in [0, range).
+    inline void
+    FillInRange(u32 *pOut_Values, size_t count, u32 range) noexcept
+    {
+        ForEachBlock(BlockCount(count), [=](const u32 *pValues, size_t i) {
+            auto n = detail::CountAt(i, count);
+            for(size_t j = 0; j < n; ++j) {
+                pOut_Values[i + j] = detail::U32ToRange(pValues[j], range);
+            }
+        });
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Long jumps every lane - Same as the next streamIndex.
+    inline void
+    LongJump() noexcept
+    {
+        for(size_t lane = 0; lane < Lanes; ++lane) {
+            u32 state[4] = { m_s0[lane], m_s1[lane], m_s2[lane], m_s3[lane] };
+
+            auto x = Xoshiro128(0);
+            x.SetState(state);
+            x.LongJump();
+            x.GetState(state);
+
+            m_s0[lane] = state[0]; m_s1[lane] = state[1];
+            m_s2[lane] = state[2]; m_s3[lane] = state[3];
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    constexpr static size_t
+    BlockCount(size_t count) noexcept
+    {
+        return (count + Lanes - 1) / Lanes;
+    }
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    u32 m_s0[Lanes];
+    u32 m_s1[Lanes];
+    u32 m_s2[Lanes];
+    u32 m_s3[Lanes];
+
+}; // class BasicRandomStream
+
+
+//----------------------------------------------------------------------------//
+// Typedefs                                                                   //
+//----------------------------------------------------------------------------//
+typedef BasicRandomStream<8> RandomStream;
+
+
+//----------------------------------------------------------------------------//
+// Samplers                                                                   //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Uniform points inside of the rect.
+template <size_t Lanes>
+inline void
+SamplePointsInRect(
+    BasicRandomStream<Lanes> &rng,
+    const Rect               &rect,
+    Vec2                     *pOut_Points,
+    size_t                    count) noexcept
+{
+    static_assert(sizeof(Vec2) == sizeof(float) * 2, "Vec2 must be tightly packed.");
+
+    const float origin[2] = { rect.GetX    (), rect.GetY     () };
+    const float size  [2] = { rect.GetWidth(), rect.GetHeight() };
+
+    auto p_out = reinterpret_cast<float*>(pOut_Points);
+    auto n     = count * 2;
+    rng.Fill(p_out, n);
+
+    size_t i = 0;
+    if(simd::kWidth % 2 == 0) {
+        auto v_origin = simd::LoadPattern(origin, 2);
+        auto v_size   = simd::LoadPattern(size,   2);
+
+        for(; i + simd::kWidth <= n; i += simd::kWidth) {
+            auto v = simd::Load(p_out + i);
+            simd::Store(p_out + i, simd::MulAdd(v, v_size, v_origin));
+        }
+    }
+    for(; i < n; ++i) {
+        p_out[i] = p_out[i] * size[i & 1] + origin[i & 1];
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Uniform directions on the unit circle.
+/// @note Goes through math::SinCos, so it follows ACOW_MATH_DETERMINISTIC.
+template <size_t Lanes>
+inline void
+SampleDirections(
+    BasicRandomStream<Lanes> &rng,
+    Vec2                     *pOut_Directions,
+    size_t                    count) noexcept
+{
+    auto blocks = (count + Lanes - 1) / Lanes;
+    rng.ForEachBlock(blocks, [=](const u32 *pValues, size_t i) {
+        auto n = detail::CountAt(i, count);
+        for(size_t j = 0; j < n; ++j) {
+            auto  angle = (detail::U32ToUnitFloat(pValues[j]) * k2PI) - kPI;
+            auto &dir   = pOut_Directions[i + j];
+            SinCos(angle, &dir.y, &dir.x);
+        }
+    });
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Uniform coords of a rows x cols grid - y in [0, rows) and
+///   x in [0, cols).
+template <size_t Lanes>
+inline void
+SampleCoords(
+    BasicRandomStream<Lanes> &rng,
+    i32                       rows,
+    i32                       cols,
+    Coord                    *pOut_Coords,
+    size_t                    count) noexcept
+{
+    // Even blocks give the ys, odd blocks the xs.
+    auto blocks = ((count + Lanes - 1) / Lanes) * 2;
+    rng.ForEachBlock(blocks, [=](const u32 *pValues, size_t index) {
+        auto block = index / Lanes;
+        auto i     = (block / 2) * Lanes + (index % Lanes);
+        auto n     = detail::CountAt(i, count);
+        if((block & 1) == 0) {
+            for(size_t j = 0; j < n; ++j) {
+                pOut_Coords[i + j].y = i32(detail::U32ToRange(pValues[j], u32(rows)));
+            }
+        } else {
+            for(size_t j = 0; j < n; ++j) {
+                pOut_Coords[i + j].x = i32(detail::U32ToRange(pValues[j], u32(cols)));
+            }
+        }
+    });
+}
+
+} // namespace math
+} // namespace acow
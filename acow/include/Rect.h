@@ -23,6 +23,7 @@
 // AmazingCow Libs
 #include "acow/cpp_goodies.h"
 // acow_math_goodies
+#include "Instrumentation.h"
 #include "LibrarySupport.h"
 #include "Vec2.h"
 #include "Size.h"
@@ -243,7 +244,7 @@ Rect::Rect(float x, float y, float w, float h) noexcept
 #if (ACOW_MATH_HAS_SDL_SUPPORT)
 ACOW_CONSTEXPR_STRICT inline
 Rect::Rect(const SDL_Rect &sdlRect) noexcept
-    : Rect(sdlRect.x, sdlRect.y, sdlRect.w, sdlRect.w)
+    : Rect(float(sdlRect.x), float(sdlRect.y), float(sdlRect.w), float(sdlRect.h))
 {
     // Empty...
 }
@@ -299,7 +300,7 @@ Rect::SetBottom(float pos) noexcept { y = (pos - h); }
 ACOW_CONSTEXPR_STRICT inline Vec2
 Rect::GetCenter() const noexcept
 {
-    return Vec2(x * (0.5f + w), y + (h * 0.5f));
+    return Vec2(x + (w * 0.5f), y + (h * 0.5f));
 }
 
 inline void
@@ -440,29 +441,36 @@ Rect::IsEmpty() const
 ACOW_CONSTEXPR_STRICT inline bool
 Rect::Contains(const Rect &r) const
 {
-    // COWTODO(n2omatt): To implement...
-    return true;
+    ACOW_MATH_COUNT_CONSTEXPR(RectContains);
+
+    return r.GetLeft () >= GetLeft () && r.GetRight () <= GetRight ()
+        && r.GetTop  () >= GetTop  () && r.GetBottom() <= GetBottom();
 }
 
 ACOW_CONSTEXPR_STRICT inline bool
 Rect::Contains(const Vec2 &p) const
 {
-    // COWTODO(n2omatt): To implement...
-    return true;
+    return Contains(p.x, p.y);
 }
 
 ACOW_CONSTEXPR_STRICT inline bool
 Rect::Contains(float x, float y) const
 {
-    // COWTODO(n2omatt): To implement...
-    return true;
+    ACOW_MATH_COUNT_CONSTEXPR(RectContains);
+
+    // Half open, so a point is inside of exactly one of the tiled rects.
+    return x >= GetLeft() && x < GetRight()
+        && y >= GetTop () && y < GetBottom();
 }
 
 ACOW_CONSTEXPR_STRICT inline bool
 Rect::Intersects(const Rect &r) const noexcept
 {
-    // COWTODO(n2omatt): To implement...
-    return true;
+    ACOW_MATH_COUNT_CONSTEXPR(RectIntersects);
+
+    // Touching edges don't count.
+    return GetLeft() < r.GetRight () && r.GetLeft() < GetRight ()
+        && GetTop () < r.GetBottom() && r.GetTop () < GetBottom();
 }
 
 ACOW_CONSTEXPR_STRICT inline bool
@@ -614,5 +622,20 @@ Rect::operator SDL_Rect() noexcept
 }
 #endif // (ACOW_MATH_HAS_SDL_SUPPORT)
 
+
+//----------------------------------------------------------------------------//
+// Lerp                                                                       //
+//----------------------------------------------------------------------------//
+ACOW_CONSTEXPR_STRICT inline Rect
+Lerp(const Rect &s, const Rect &e, float t) noexcept
+{
+    return Rect(
+        Lerp(s.x, e.x, t),
+        Lerp(s.y, e.y, t),
+        Lerp(s.w, e.w, t),
+        Lerp(s.h, e.h, t)
+    );
+}
+
 } // namespace math
 } // namespace acow
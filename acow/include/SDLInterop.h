@@ -0,0 +1,240 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SDLInterop.h                                                  //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Bulk conversion of Rect / Vec2 arrays to and from SDL_Rect, SDL_FRect,  //
+//    SDL_Point and SDL_FPoint arrays, straight into the caller's buffers.    //
+//                                                                            //
+//    Templated on the SDL types, so it doesn't need SDL itself - Any struct  //
+//    with the same layout works (i32 or float x, y[, w, h], in order).       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "LibrarySupport.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+static_assert(sizeof(Vec2) == sizeof(float) * 2, "Vec2 must be tightly packed.");
+static_assert(sizeof(Rect) == sizeof(float) * 4, "Rect must be tightly packed.");
+
+///-----------------------------------------------------------------------------
+/// @brief How the floats become integers - Truncate is what the i32 casts
+///   (and Rect::operator SDL_Rect) do. Nearest rounds half to even.
+enum class Rounding
+{
+    Truncate,
+    Floor,
+    Nearest,
+}; // enum class Rounding
+
+
+namespace detail {
+
+//------------------------------------------------------------------------------
+// Layout checks - The arrays are converted as flat runs of fields.
+template <typename T, typename Field, size_t FieldsCount>
+struct IsPackedAs
+{
+    typedef typename std::remove_cv<decltype(T::x)>::type X;
+
+    constexpr static bool value =
+           std::is_standard_layout<T>::value
+        && std::is_same<X, Field>::value
+        && sizeof(T) == sizeof(Field) * FieldsCount
+        && offsetof(T, x) == 0
+        && offsetof(T, y) == sizeof(Field);
+};
+
+template <typename T, typename Field>
+struct IsRectPackedAs
+{
+    constexpr static bool value =
+           IsPackedAs<T, Field, 4>::value
+        && offsetof(T, w) == sizeof(Field) * 2
+        && offsetof(T, h) == sizeof(Field) * 3;
+};
+
+//------------------------------------------------------------------------------
+// Kernels
+inline void
+FloatsToInts(const float *pValues, size_t count, i32 *pOut_Values, Rounding rounding) noexcept
+{
+    size_t i = 0;
+    switch(rounding) {
+        case Rounding::Truncate: {
+            for(; i + simd::kWidth <= count; i += simd::kWidth) {
+                simd::StoreTruncated(pOut_Values + i, simd::Load(pValues + i));
+            }
+            for(; i < count; ++i) {
+                pOut_Values[i] = i32(pValues[i]);
+            }
+        } break;
+
+        case Rounding::Floor: {
+            for(; i + simd::kWidth <= count; i += simd::kWidth) {
+                simd::StoreTruncated(pOut_Values + i, simd::Floor(simd::Load(pValues + i)));
+            }
+            for(; i < count; ++i) {
+                pOut_Values[i] = i32(std::floor(pValues[i]));
+            }
+        } break;
+
+        case Rounding::Nearest: {
+            for(; i + simd::kWidth <= count; i += simd::kWidth) {
+                simd::StoreRounded(pOut_Values + i, simd::Load(pValues + i));
+            }
+            for(; i < count; ++i) {
+                pOut_Values[i] = i32(std::nearbyint(pValues[i]));
+            }
+        } break;
+    }
+}
+
+inline void
+IntsToFloats(const i32 *pValues, size_t count, float *pOut_Values) noexcept
+{
+    size_t i = 0;
+    for(; i + simd::kWidth <= count; i += simd::kWidth) {
+        simd::Store(pOut_Values + i, simd::LoadInts(pValues + i));
+    }
+    for(; i < count; ++i) {
+        pOut_Values[i] = float(pValues[i]);
+    }
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Rects                                                                      //
+//   IntRect as SDL_Rect, FloatRect as SDL_FRect.                             //
+//   The values must fit in i32.                                              //
+//----------------------------------------------------------------------------//
+template <typename IntRect>
+inline void
+ToIntRects(
+    const Rect *pRects,
+    size_t      count,
+    IntRect    *pOut_Rects,
+    Rounding    rounding = Rounding::Truncate) noexcept
+{
+    static_assert(detail::IsRectPackedAs<IntRect, i32>::value, "IntRect must be i32 x, y, w, h - As SDL_Rect");
+    detail::FloatsToInts(
+        reinterpret_cast<const float*>(pRects), count * 4,
+        reinterpret_cast<i32*>(pOut_Rects),
+        rounding
+    );
+}
+
+template <typename IntRect>
+inline void
+FromIntRects(const IntRect *pRects, size_t count, Rect *pOut_Rects) noexcept
+{
+    static_assert(detail::IsRectPackedAs<IntRect, i32>::value, "IntRect must be i32 x, y, w, h - As SDL_Rect");
+    detail::IntsToFloats(
+        reinterpret_cast<const i32*>(pRects), count * 4,
+        reinterpret_cast<float*>(pOut_Rects)
+    );
+}
+
+template <typename FloatRect>
+inline void
+ToFloatRects(const Rect *pRects, size_t count, FloatRect *pOut_Rects) noexcept
+{
+    static_assert(detail::IsRectPackedAs<FloatRect, float>::value, "FloatRect must be float x, y, w, h - As SDL_FRect");
+    if(count != 0) {
+        std::memcpy(static_cast<void*>(pOut_Rects), pRects, sizeof(Rect) * count);
+    }
+}
+
+template <typename FloatRect>
+inline void
+FromFloatRects(const FloatRect *pRects, size_t count, Rect *pOut_Rects) noexcept
+{
+    static_assert(detail::IsRectPackedAs<FloatRect, float>::value, "FloatRect must be float x, y, w, h - As SDL_FRect");
+    if(count != 0) {
+        std::memcpy(static_cast<void*>(pOut_Rects), pRects, sizeof(Rect) * count);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Points                                                                     //
+//   IntPoint as SDL_Point, FloatPoint as SDL_FPoint.                         //
+//----------------------------------------------------------------------------//
+template <typename IntPoint>
+inline void
+ToIntPoints(
+    const Vec2 *pPoints,
+    size_t      count,
+    IntPoint   *pOut_Points,
+    Rounding    rounding = Rounding::Truncate) noexcept
+{
+    static_assert(detail::IsPackedAs<IntPoint, i32, 2>::value, "IntPoint must be i32 x, y - As SDL_Point");
+    detail::FloatsToInts(
+        reinterpret_cast<const float*>(pPoints), count * 2,
+        reinterpret_cast<i32*>(pOut_Points),
+        rounding
+    );
+}
+
+template <typename IntPoint>
+inline void
+FromIntPoints(const IntPoint *pPoints, size_t count, Vec2 *pOut_Points) noexcept
+{
+    static_assert(detail::IsPackedAs<IntPoint, i32, 2>::value, "IntPoint must be i32 x, y - As SDL_Point");
+    detail::IntsToFloats(
+        reinterpret_cast<const i32*>(pPoints), count * 2,
+        reinterpret_cast<float*>(pOut_Points)
+    );
+}
+
+template <typename FloatPoint>
+inline void
+ToFloatPoints(const Vec2 *pPoints, size_t count, FloatPoint *pOut_Points) noexcept
+{
+    static_assert(detail::IsPackedAs<FloatPoint, float, 2>::value, "FloatPoint must be float x, y - As SDL_FPoint");
+    if(count != 0) {
+        std::memcpy(static_cast<void*>(pOut_Points), pPoints, sizeof(Vec2) * count);
+    }
+}
+
+template <typename FloatPoint>
+inline void
+FromFloatPoints(const FloatPoint *pPoints, size_t count, Vec2 *pOut_Points) noexcept
+{
+    static_assert(detail::IsPackedAs<FloatPoint, float, 2>::value, "FloatPoint must be float x, y - As SDL_FPoint");
+    if(count != 0) {
+        std::memcpy(static_cast<void*>(pOut_Points), pPoints, sizeof(Vec2) * count);
+    }
+}
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,282 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SIMD.h                                                        //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Thin wrapper over the widest float vector the target supports, so the   //
+//    batch kernels are written once. Falls back to a 1 lane "vector" so      //
+//    the same loop is also the scalar implementation.                        //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cmath>
+#include <cstring>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "LibrarySupport.h"
+
+
+namespace acow { namespace math { namespace simd {
+
+//----------------------------------------------------------------------------//
+// AVX                                                                        //
+//----------------------------------------------------------------------------//
+#if (ACOW_MATH_HAS_AVX)
+typedef __m256 f32x;
+constexpr static size_t kWidth = 8;
+
+inline f32x Zero()                       noexcept { return _mm256_setzero_ps();   }
+inline f32x Set1(float v)                noexcept { return _mm256_set1_ps(v);     }
+inline f32x Load(const float *p)         noexcept { return _mm256_loadu_ps(p);    }
+inline void Store(float *p, f32x v)      noexcept { _mm256_storeu_ps(p, v);       }
+
+// The raw bits of u32 lanes - For the float tricks over integers.
+inline f32x LoadBits (const u32 *p)      noexcept { return _mm256_loadu_ps(reinterpret_cast<const float*>(p)); }
+inline void StoreBits(u32 *p, f32x v)    noexcept { _mm256_storeu_ps(reinterpret_cast<float*>(p), v);        }
+
+// i32 lanes - Truncated or rounded to nearest even (the default rounding
+// mode). The values must fit in i32.
+inline void StoreTruncated(i32 *p, f32x v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvttps_epi32(v)); }
+inline void StoreRounded  (i32 *p, f32x v) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(p), _mm256_cvtps_epi32 (v)); }
+inline f32x LoadInts(const i32 *p)         noexcept { return _mm256_cvtepi32_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p))); }
+
+inline f32x Add(f32x a, f32x b)          noexcept { return _mm256_add_ps(a, b);   }
+inline f32x Sub(f32x a, f32x b)          noexcept { return _mm256_sub_ps(a, b);   }
+inline f32x Mul(f32x a, f32x b)          noexcept { return _mm256_mul_ps(a, b);   }
+inline f32x Div(f32x a, f32x b)          noexcept { return _mm256_div_ps(a, b);   }
+inline f32x Min(f32x a, f32x b)          noexcept { return _mm256_min_ps(a, b);   }
+inline f32x Max(f32x a, f32x b)          noexcept { return _mm256_max_ps(a, b);   }
+inline f32x Sqrt(f32x a)                 noexcept { return _mm256_sqrt_ps(a);     }
+inline f32x Floor(f32x a)                noexcept { return _mm256_floor_ps(a);    }
+
+inline f32x Less        (f32x a, f32x b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+inline f32x LessEqual   (f32x a, f32x b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+inline f32x Greater     (f32x a, f32x b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GT_OQ); }
+inline f32x GreaterEqual(f32x a, f32x b) noexcept { return _mm256_cmp_ps(a, b, _CMP_GE_OQ); }
+
+inline f32x And   (f32x a, f32x b)       noexcept { return _mm256_and_ps(a, b);    }
+inline f32x Or    (f32x a, f32x b)       noexcept { return _mm256_or_ps (a, b);    }
+inline f32x AndNot(f32x a, f32x b)       noexcept { return _mm256_andnot_ps(a, b); }
+inline i32  MoveMask(f32x m)             noexcept { return _mm256_movemask_ps(m);  }
+
+// Picks a where the mask is set, b otherwise.
+inline f32x Select(f32x m, f32x a, f32x b) noexcept { return _mm256_blendv_ps(b, a, m); }
+
+// Swaps lanes 0 and 1, 2 and 3... - The x and y of interleaved Vec2s.
+inline f32x SwapPairs(f32x a) noexcept { return _mm256_permute_ps(a, 0xB1); }
+
+
+//----------------------------------------------------------------------------//
+// SSE2                                                                       //
+//----------------------------------------------------------------------------//
+#elif (ACOW_MATH_HAS_SSE2)
+typedef __m128 f32x;
+constexpr static size_t kWidth = 4;
+
+inline f32x Zero()                       noexcept { return _mm_setzero_ps();   }
+inline f32x Set1(float v)                noexcept { return _mm_set1_ps(v);     }
+inline f32x Load(const float *p)         noexcept { return _mm_loadu_ps(p);    }
+inline void Store(float *p, f32x v)      noexcept { _mm_storeu_ps(p, v);       }
+
+// The raw bits of u32 lanes - For the float tricks over integers.
+inline f32x LoadBits (const u32 *p)      noexcept { return _mm_loadu_ps(reinterpret_cast<const float*>(p)); }
+inline void StoreBits(u32 *p, f32x v)    noexcept { _mm_storeu_ps(reinterpret_cast<float*>(p), v);        }
+
+// i32 lanes - Truncated or rounded to nearest even (the default rounding
+// mode). The values must fit in i32.
+inline void StoreTruncated(i32 *p, f32x v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_cvttps_epi32(v)); }
+inline void StoreRounded  (i32 *p, f32x v) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), _mm_cvtps_epi32 (v)); }
+inline f32x LoadInts(const i32 *p)         noexcept { return _mm_cvtepi32_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+
+inline f32x Add(f32x a, f32x b)          noexcept { return _mm_add_ps(a, b);   }
+inline f32x Sub(f32x a, f32x b)          noexcept { return _mm_sub_ps(a, b);   }
+inline f32x Mul(f32x a, f32x b)          noexcept { return _mm_mul_ps(a, b);   }
+inline f32x Div(f32x a, f32x b)          noexcept { return _mm_div_ps(a, b);   }
+inline f32x Min(f32x a, f32x b)          noexcept { return _mm_min_ps(a, b);   }
+inline f32x Max(f32x a, f32x b)          noexcept { return _mm_max_ps(a, b);   }
+inline f32x Sqrt(f32x a)                 noexcept { return _mm_sqrt_ps(a);     }
+
+inline f32x Less        (f32x a, f32x b) noexcept { return _mm_cmplt_ps(a, b); }
+inline f32x LessEqual   (f32x a, f32x b) noexcept { return _mm_cmple_ps(a, b); }
+inline f32x Greater     (f32x a, f32x b) noexcept { return _mm_cmpgt_ps(a, b); }
+inline f32x GreaterEqual(f32x a, f32x b) noexcept { return _mm_cmpge_ps(a, b); }
+
+inline f32x And   (f32x a, f32x b)       noexcept { return _mm_and_ps(a, b);    }
+inline f32x Or    (f32x a, f32x b)       noexcept { return _mm_or_ps (a, b);    }
+inline f32x AndNot(f32x a, f32x b)       noexcept { return _mm_andnot_ps(a, b); }
+inline i32  MoveMask(f32x m)             noexcept { return _mm_movemask_ps(m);  }
+
+inline f32x
+Select(f32x m, f32x a, f32x b) noexcept
+{
+    return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b));
+}
+
+inline f32x SwapPairs(f32x a) noexcept { return _mm_shuffle_ps(a, a, 0xB1); }
+
+inline f32x
+Floor(f32x a) noexcept
+{
+    // SSE2 has no round instruction - Truncate and fix the negatives.
+    //   Only valid for |a| < 2^31, which is all the kernels need.
+    auto t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a));
+    return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a), _mm_set1_ps(1.0f)));
+}
+
+
+//----------------------------------------------------------------------------//
+// Scalar                                                                     //
+//----------------------------------------------------------------------------//
+#else
+struct f32x { float v; };
+constexpr static size_t kWidth = 1;
+
+namespace detail {
+    inline u32   ToBits  (float f) noexcept { u32 b; std::memcpy(&b, &f, 4); return b; }
+    inline float FromBits(u32   b) noexcept { float f; std::memcpy(&f, &b, 4); return f; }
+    inline f32x  MakeMask(bool  c) noexcept { return f32x{FromBits(c ? 0xFFFFFFFFu : 0u)}; }
+} // namespace detail
+
+inline f32x Zero()                       noexcept { return f32x{0.0f}; }
+inline f32x Set1(float v)                noexcept { return f32x{v};    }
+inline f32x Load(const float *p)         noexcept { return f32x{*p};   }
+inline void Store(float *p, f32x v)      noexcept { *p = v.v;          }
+
+// The raw bits of u32 lanes - For the float tricks over integers.
+inline f32x LoadBits (const u32 *p)      noexcept { return f32x{detail::FromBits(*p)}; }
+inline void StoreBits(u32 *p, f32x v)    noexcept { *p = detail::ToBits(v.v);          }
+
+// i32 lanes - Truncated or rounded to nearest even (the default rounding
+// mode). The values must fit in i32.
+inline void StoreTruncated(i32 *p, f32x v) noexcept { *p = i32(v.v);                 }
+inline void StoreRounded  (i32 *p, f32x v) noexcept { *p = i32(std::nearbyint(v.v)); }
+inline f32x LoadInts(const i32 *p)         noexcept { return f32x{float(*p)};        }
+
+inline f32x Add(f32x a, f32x b)          noexcept { return f32x{a.v + b.v}; }
+inline f32x Sub(f32x a, f32x b)          noexcept { return f32x{a.v - b.v}; }
+inline f32x Mul(f32x a, f32x b)          noexcept { return f32x{a.v * b.v}; }
+inline f32x Div(f32x a, f32x b)          noexcept { return f32x{a.v / b.v}; }
+inline f32x Min(f32x a, f32x b)          noexcept { return f32x{(a.v < b.v) ? a.v : b.v}; }
+inline f32x Max(f32x a, f32x b)          noexcept { return f32x{(a.v > b.v) ? a.v : b.v}; }
+inline f32x Sqrt(f32x a)                 noexcept { return f32x{std::sqrt(a.v)};  }
+inline f32x Floor(f32x a)                noexcept { return f32x{std::floor(a.v)}; }
+
+inline f32x Less        (f32x a, f32x b) noexcept { return detail::MakeMask(a.v <  b.v); }
+inline f32x LessEqual   (f32x a, f32x b) noexcept { return detail::MakeMask(a.v <= b.v); }
+inline f32x Greater     (f32x a, f32x b) noexcept { return detail::MakeMask(a.v >  b.v); }
+inline f32x GreaterEqual(f32x a, f32x b) noexcept { return detail::MakeMask(a.v >= b.v); }
+
+inline f32x
+And(f32x a, f32x b) noexcept
+{
+    return f32x{detail::FromBits(detail::ToBits(a.v) & detail::ToBits(b.v))};
+}
+
+inline f32x
+Or(f32x a, f32x b) noexcept
+{
+    return f32x{detail::FromBits(detail::ToBits(a.v) | detail::ToBits(b.v))};
+}
+
+inline f32x
+AndNot(f32x a, f32x b) noexcept
+{
+    return f32x{detail::FromBits(~detail::ToBits(a.v) & detail::ToBits(b.v))};
+}
+
+inline i32
+MoveMask(f32x m) noexcept
+{
+    return i32(detail::ToBits(m.v) >> 31);
+}
+
+inline f32x
+Select(f32x m, f32x a, f32x b) noexcept
+{
+    return (detail::ToBits(m.v) >> 31) ? a : b;
+}
+
+// 1 lane has no pairs - Callers check kWidth % 2 first.
+inline f32x SwapPairs(f32x a) noexcept { return a; }
+
+#endif // (ACOW_MATH_HAS_AVX)
+
+
+//----------------------------------------------------------------------------//
+// Integer Lanes                                                              //
+//   Always 4 lanes - AVX without AVX2 has no 256 bit integer operations, so  //
+//   the widest integer vector that every SIMD target has is SSE2's.          //
+//----------------------------------------------------------------------------//
+#if (ACOW_MATH_HAS_SSE2)
+typedef __m128i u32x4;
+
+inline u32x4 Load (const u32 *p)          noexcept { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p)); }
+inline void  Store(u32 *p, u32x4 v)       noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v);         }
+
+inline u32x4 Add       (u32x4 a, u32x4 b) noexcept { return _mm_add_epi32(a, b); }
+inline u32x4 Xor       (u32x4 a, u32x4 b) noexcept { return _mm_xor_si128(a, b); }
+inline u32x4 ShiftLeft (u32x4 a, i32 n)   noexcept { return _mm_sll_epi32(a, _mm_cvtsi32_si128(n)); }
+inline u32x4 ShiftRight(u32x4 a, i32 n)   noexcept { return _mm_srl_epi32(a, _mm_cvtsi32_si128(n)); }
+
+#else
+struct u32x4 { u32 v[4]; };
+
+inline u32x4 Load (const u32 *p)          noexcept { u32x4 r; std::memcpy(r.v, p, sizeof(r.v)); return r; }
+inline void  Store(u32 *p, u32x4 v)       noexcept { std::memcpy(p, v.v, sizeof(v.v));                  }
+
+inline u32x4 Add       (u32x4 a, u32x4 b) noexcept { return {{a.v[0] + b.v[0], a.v[1] + b.v[1], a.v[2] + b.v[2], a.v[3] + b.v[3]}}; }
+inline u32x4 Xor       (u32x4 a, u32x4 b) noexcept { return {{a.v[0] ^ b.v[0], a.v[1] ^ b.v[1], a.v[2] ^ b.v[2], a.v[3] ^ b.v[3]}}; }
+inline u32x4 ShiftLeft (u32x4 a, i32 n)   noexcept { return {{a.v[0] << n, a.v[1] << n, a.v[2] << n, a.v[3] << n}}; }
+inline u32x4 ShiftRight(u32x4 a, i32 n)   noexcept { return {{a.v[0] >> n, a.v[1] >> n, a.v[2] >> n, a.v[3] >> n}}; }
+
+#endif // (ACOW_MATH_HAS_SSE2)
+
+inline u32x4
+RotateLeft(u32x4 a, i32 n) noexcept
+{
+    return Xor(ShiftLeft(a, n), ShiftRight(a, 32 - n));
+}
+
+
+//----------------------------------------------------------------------------//
+// Common                                                                     //
+//----------------------------------------------------------------------------//
+inline f32x
+MulAdd(f32x a, f32x b, f32x c) noexcept
+{
+    // Kept as two operations on purpose so every backend rounds the same.
+    return Add(Mul(a, b), c);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Loads a vector repeating the pattern [p[0] .. p[n-1]] across lanes.
+/// @note n must divide kWidth (or be larger than it).
+inline f32x
+LoadPattern(const float *p, size_t n) noexcept
+{
+    float lanes[kWidth];
+    for(size_t i = 0; i < kWidth; ++i) {
+        lanes[i] = p[i % n];
+    }
+    return Load(lanes);
+}
+
+} // namespace simd
+} // namespace math
+} // namespace acow
@@ -0,0 +1,515 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Spline.h                                                      //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Cubic Bezier curves and splines (chains of them) over Vec2.             //
+//                                                                            //
+//    Batches of evenly spaced t are evaluated with forward differencing -    //
+//    3 adds per point instead of the polynomial. Spline keeps an arc length  //
+//    table so positions at a distance along it (constant speed motion) are   //
+//    a binary search instead of integrating the curve again.                 //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Instrumentation.h"
+#include "Operations.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+static_assert(sizeof(Vec2) == sizeof(float) * 2, "Vec2 must be tightly packed.");
+
+//----------------------------------------------------------------------------//
+// Cubic Bezier                                                               //
+//----------------------------------------------------------------------------//
+struct CubicBezier
+{
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform Catmull-Rom segment from p1 to p2 - p0 and p3 are the
+    ///   points before and after, they only shape the tangents.
+    ACOW_CONSTEXPR_STRICT inline static CubicBezier
+    FromCatmullRom(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) noexcept
+    {
+        return CubicBezier(
+            p1,
+            p1 + (p2 - p0) * (1.0f / 6.0f),
+            p2 - (p3 - p1) * (1.0f / 6.0f),
+            p2
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ACOW_CONSTEXPR_STRICT
+    CubicBezier() noexcept
+        : p0(), p1(), p2(), p3()
+    {
+        // Empty...
+    }
+
+    ACOW_CONSTEXPR_STRICT
+    CubicBezier(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2, const Vec2 &p3) noexcept
+        : p0(p0), p1(p1), p2(p2), p3(p3)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Evaluation                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Point at t - [0, 1] goes from p0 to p3.
+    ACOW_CONSTEXPR_STRICT inline Vec2
+    Evaluate(float t) const noexcept
+    {
+        // Polynomial form - ((a*t + b)*t + c)*t + p0.
+        return ((GetA() * t + GetB()) * t + GetC()) * t + p0;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Tangent at t - Not normalized, its length is the speed.
+    ACOW_CONSTEXPR_STRICT inline Vec2
+    EvaluateDerivative(float t) const noexcept
+    {
+        return (GetA() * (3.0f * t) + GetB() * 2.0f) * t + GetC();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief count points at evenly spaced t, from p0 to p3 (both included)
+    ///   with forward differencing. The error grows with count, it stays
+    ///   below 1e-5 of the curve size for the low thousands.
+    inline void
+    Evaluate(size_t count, Vec2 *pOut_Points) const noexcept
+    {
+        ACOW_MATH_TIME(SplineEvaluate, count);
+
+        if(count == 1) {
+            pOut_Points[0] = p0;
+        }
+        if(count <= 1) {
+            return;
+        }
+
+        // kChains interleaved chains - Chain j makes the points j, j + kChains,
+        // j + 2 * kChains... So each step stores kChains consecutive points,
+        // and the adds of a chain don't wait on the other chains.
+        constexpr size_t kChains = 8;
+        constexpr size_t kFloats = kChains * 2;
+        constexpr size_t kVecs   = kFloats / simd::kWidth;
+        static_assert(kFloats % simd::kWidth == 0, "Chains must fill whole vectors.");
+
+        auto h    = 1.0f / float(count - 1);
+        auto step = h * float(kChains);
+
+        float f[kFloats], df[kFloats], d2f[kFloats], d3f[kFloats];
+        for(size_t j = 0; j < kChains; ++j) {
+            Vec2 values[4];
+            InitDifferences(float(j) * h, step, values);
+            for(size_t k = 0; k < 2; ++k) {
+                f  [j * 2 + k] = values[0].data[k];
+                df [j * 2 + k] = values[1].data[k];
+                d2f[j * 2 + k] = values[2].data[k];
+                d3f[j * 2 + k] = values[3].data[k];
+            }
+        }
+
+        simd::f32x v_f[kVecs], v_df[kVecs], v_d2f[kVecs], v_d3f[kVecs];
+        for(size_t v = 0; v < kVecs; ++v) {
+            v_f  [v] = simd::Load(f   + v * simd::kWidth);
+            v_df [v] = simd::Load(df  + v * simd::kWidth);
+            v_d2f[v] = simd::Load(d2f + v * simd::kWidth);
+            v_d3f[v] = simd::Load(d3f + v * simd::kWidth);
+        }
+
+        auto p_out = reinterpret_cast<float*>(pOut_Points);
+        size_t i = 0;
+        for(; i + kChains < count; i += kChains) {
+            for(size_t v = 0; v < kVecs; ++v) {
+                simd::Store(p_out + i * 2 + v * simd::kWidth, v_f[v]);
+                v_f  [v] = simd::Add(v_f  [v], v_df [v]);
+                v_df [v] = simd::Add(v_df [v], v_d2f[v]);
+                v_d2f[v] = simd::Add(v_d2f[v], v_d3f[v]);
+            }
+        }
+        // The ones that don't fill all the chains, and the end exactly.
+        for(; i + 1 < count; ++i) {
+            pOut_Points[i] = Evaluate(float(i) * h);
+        }
+        pOut_Points[count - 1] = p3;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Helper Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief De Casteljau split at t - Both halves trace the same curve.
+    ACOW_CONSTEXPR_LOOSE inline void
+    Split(float t, CubicBezier *pOut_Left, CubicBezier *pOut_Right) const noexcept
+    {
+        auto p01  = Lerp(p0,   p1,   t);
+        auto p12  = Lerp(p1,   p2,   t);
+        auto p23  = Lerp(p2,   p3,   t);
+        auto p012 = Lerp(p01,  p12,  t);
+        auto p123 = Lerp(p12,  p23,  t);
+        auto mid  = Lerp(p012, p123, t);
+
+        *pOut_Left  = CubicBezier(p0,  p01,  p012, mid);
+        *pOut_Right = CubicBezier(mid, p123, p23,  p3);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Line segments within tolerance of the curve - Splits more where
+    ///   it bends more and not at all where it's straight.
+    ///   pOut_Points is cleared and gets p0 to p3.
+    inline void
+    Flatten(float tolerance, std::vector<Vec2> *pOut_Points) const
+    {
+        pOut_Points->clear();
+        pOut_Points->push_back(p0);
+        FlattenTo(tolerance, pOut_Points);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Same as Flatten but appends, and without p0 - So the curves of
+    ///   a chain don't repeat the points they share.
+    inline void
+    FlattenTo(float tolerance, std::vector<Vec2> *pOut_Points) const
+    {
+        // Explicit stack of the curves still to test, right halves on top.
+        constexpr i32 kMaxDepth = 16;
+
+        CubicBezier stack[kMaxDepth + 1];
+        i32         depths[kMaxDepth + 1];
+        i32         top = 0;
+
+        stack [0] = *this;
+        depths[0] = 0;
+        while(top >= 0) {
+            auto curve = stack [top];
+            auto depth = depths[top];
+            --top;
+
+            if(depth == kMaxDepth || curve.IsFlat(tolerance)) {
+                pOut_Points->push_back(curve.p3);
+                continue;
+            }
+
+            CubicBezier left, right;
+            curve.Split(0.5f, &left, &right);
+
+            stack[++top] = right; depths[top] = depth + 1;
+            stack[++top] = left;  depths[top] = depth + 1;
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    ACOW_CONSTEXPR_STRICT inline Vec2 GetA() const noexcept { return (p1 - p2) * 3.0f + p3 - p0;        }
+    ACOW_CONSTEXPR_STRICT inline Vec2 GetB() const noexcept { return (p0 - p1 * 2.0f + p2) * 3.0f;      }
+    ACOW_CONSTEXPR_STRICT inline Vec2 GetC() const noexcept { return (p1 - p0) * 3.0f;                  }
+
+    ///-------------------------------------------------------------------------
+    /// @brief f(t) and its 3 forward differences with step h.
+    ACOW_CONSTEXPR_LOOSE inline void
+    InitDifferences(float t, float h, Vec2 *pOut_Values) const noexcept
+    {
+        auto a = GetA();
+        auto b = GetB();
+
+        pOut_Values[0] = Evaluate(t);
+        pOut_Values[1] = a * (h * (3.0f * t * t + 3.0f * t * h + h * h))
+                       + b * (h * (2.0f * t + h))
+                       + GetC() * h;
+        pOut_Values[2] = a * (6.0f * h * h * (t + h))
+                       + b * (2.0f * h * h);
+        pOut_Values[3] = a * (6.0f * h * h * h);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief How far the curve can be from the chord p0 p3 is bounded by
+    ///   3/4 of the largest second difference of the control points
+    ///   (Wang's formula) - No square roots.
+    ACOW_CONSTEXPR_LOOSE inline bool
+    IsFlat(float tolerance) const noexcept
+    {
+        auto d0 = (p0 - p1 * 2.0f + p2).MagnitudeSqr();
+        auto d1 = (p1 - p2 * 2.0f + p3).MagnitudeSqr();
+        return ((d0 > d1) ? d0 : d1) * (9.0f / 16.0f) <= tolerance * tolerance;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    Vec2 p0, p1, p2, p3;
+
+}; // struct CubicBezier
+
+
+//----------------------------------------------------------------------------//
+// Spline                                                                     //
+//   Chain of CubicBeziers - Segment i goes over u in [i, i + 1].             //
+//----------------------------------------------------------------------------//
+class Spline
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Arc length samples of each segment - The lengths are chords
+    ///   between them, so the distances are a bit short on tight bends.
+    constexpr static size_t kDefaultSamplesPerSegment = 32;
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Uniform Catmull-Rom through all the points - The ends are
+    ///   repeated to make the tangents of the first and last segments.
+    inline static Spline
+    FromCatmullRom(
+        const Vec2 *pPoints,
+        size_t      count,
+        size_t      samplesPerSegment = kDefaultSamplesPerSegment)
+    {
+        std::vector<CubicBezier> segments;
+        if(count == 1) {
+            segments.push_back(CubicBezier(pPoints[0], pPoints[0], pPoints[0], pPoints[0]));
+        }
+        for(size_t i = 0; i + 1 < count; ++i) {
+            segments.push_back(CubicBezier::FromCatmullRom(
+                pPoints[(i == 0) ? 0 : i - 1],
+                pPoints[i],
+                pPoints[i + 1],
+                pPoints[(i + 2 < count) ? i + 2 : count - 1]
+            ));
+        }
+
+        return Spline(segments.data(), segments.size(), samplesPerSegment);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    Spline(
+        const CubicBezier *pSegments,
+        size_t             count,
+        size_t             samplesPerSegment = kDefaultSamplesPerSegment)
+        : m_segments         (pSegments, pSegments + count)
+        , m_samplesPerSegment((samplesPerSegment < 1) ? 1 : samplesPerSegment)
+    {
+        BuildArcLengths();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Evaluation                                                             //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Point at u - Clamped to [0, GetSegmentsCount()].
+    inline Vec2
+    Evaluate(float u) const noexcept
+    {
+        if(m_segments.empty()) {
+            return Vec2::Zero();
+        }
+
+        size_t segment;
+        auto   t = ToSegment(u, &segment);
+        return m_segments[segment].Evaluate(t);
+    }
+
+    inline Vec2
+    EvaluateDerivative(float u) const noexcept
+    {
+        if(m_segments.empty()) {
+            return Vec2::Zero();
+        }
+
+        size_t segment;
+        auto   t = ToSegment(u, &segment);
+        return m_segments[segment].EvaluateDerivative(t);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief u of the point at distance along the spline - O(log n) on the
+    ///   arc length table. distance is clamped to [0, GetLength()].
+    inline float
+    GetParameterAtDistance(float distance) const noexcept
+    {
+        if(m_segments.empty()) {
+            return 0.0f;
+        }
+
+        auto begin = m_lengths.begin();
+        auto it    = std::upper_bound(begin + 1, m_lengths.end() - 1, distance);
+
+        return ParameterInSample(size_t(it - begin) - 1, distance);
+    }
+
+    inline Vec2
+    EvaluateAtDistance(float distance) const noexcept
+    {
+        return Evaluate(GetParameterAtDistance(distance));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief count points evenly spaced by distance, from start to end
+    ///   (both included) - Walks the table once instead of a search for
+    ///   each point.
+    inline void
+    SampleEvenly(size_t count, Vec2 *pOut_Points) const noexcept
+    {
+        if(m_segments.empty()) {
+            std::fill(pOut_Points, pOut_Points + count, Vec2::Zero());
+            return;
+        }
+
+        auto step = (count > 1) ? GetLength() / float(count - 1) : 0.0f;
+        auto last = m_lengths.size() - 2;
+
+        size_t sample = 0;
+        for(size_t i = 0; i < count; ++i) {
+            auto distance = step * float(i);
+            while(sample < last && m_lengths[sample + 1] <= distance) {
+                ++sample;
+            }
+            pOut_Points[i] = Evaluate(ParameterInSample(sample, distance));
+        }
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Line segments within tolerance of the spline, start to end.
+    inline void
+    Flatten(float tolerance, std::vector<Vec2> *pOut_Points) const
+    {
+        pOut_Points->clear();
+        if(m_segments.empty()) {
+            return;
+        }
+
+        pOut_Points->push_back(m_segments.front().p0);
+        for(const auto &segment : m_segments) {
+            segment.FlattenTo(tolerance, pOut_Points);
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    inline float  GetLength       () const noexcept { return m_lengths.back();  }
+    inline size_t GetSegmentsCount() const noexcept { return m_segments.size(); }
+
+    inline const CubicBezier&
+    GetSegment(size_t index) const noexcept
+    {
+        return m_segments[index];
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline float
+    ToSegment(float u, size_t *pOut_Segment) const noexcept
+    {
+        auto last = m_segments.size() - 1;
+
+        u = Clamp(u, 0.0f, float(m_segments.size()));
+        auto segment = std::min(size_t(u), last);
+
+        *pOut_Segment = segment;
+        return u - float(segment);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief u at distance, linear between the table sample and the next.
+    inline float
+    ParameterInSample(size_t sample, float distance) const noexcept
+    {
+        auto a = m_lengths[sample];
+        auto b = m_lengths[sample + 1];
+        auto t = (b > a) ? Clamp((distance - a) / (b - a), 0.0f, 1.0f) : 0.0f;
+
+        return (float(sample) + t) / float(m_samplesPerSegment);
+    }
+
+    inline void
+    BuildArcLengths()
+    {
+        // m_lengths[k] is the length up to u = k / m_samplesPerSegment.
+        m_lengths.assign(1, 0.0f);
+        m_lengths.reserve(m_segments.size() * m_samplesPerSegment + 1);
+
+        std::vector<Vec2> points(m_samplesPerSegment + 1);
+        for(const auto &segment : m_segments) {
+            segment.Evaluate(points.size(), points.data());
+
+            auto length = m_lengths.back();
+            for(size_t i = 1; i < points.size(); ++i) {
+                length += points[i].Distance(points[i - 1]);
+                m_lengths.push_back(length);
+            }
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<CubicBezier> m_segments;
+    std::vector<float>       m_lengths;
+    size_t                   m_samplesPerSegment;
+
+}; // class Spline
+
+} // namespace math
+} // namespace acow
@@ -0,0 +1,354 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ThreadPool.h                                                  //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Small work stealing thread pool, plus ParallelFor / ParallelReduce      //
+//    over index ranges for the batch kernels.                                //
+//                                                                            //
+//    Each worker has its own queue - It takes its newest task first and,     //
+//    when it runs out, the oldest task of the other queues. The threads      //
+//    that wait on a ParallelFor run the queued tasks meanwhile, so nested    //
+//    calls from inside of tasks don't deadlock.                              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Instrumentation.h"
+
+
+namespace acow { namespace math {
+
+class ThreadPool
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef std::function<void()> Task;
+
+    ///-------------------------------------------------------------------------
+    /// @brief One less than the hardware threads - The thread waiting on the
+    ///   work runs it too.
+    constexpr static size_t kAutoWorkersCount = ~size_t(0);
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Pool used when none is given - Created on the first use.
+    inline static ThreadPool&
+    GetDefault()
+    {
+        static ThreadPool s_pool;
+        return s_pool;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief 0 workers is valid - Everything runs on the waiting threads.
+    explicit
+    ThreadPool(size_t workersCount = kAutoWorkersCount)
+        : m_pending  (0)
+        , m_nextQueue(0)
+        , m_stop     (false)
+    {
+        if(workersCount == kAutoWorkersCount) {
+            auto hardware = size_t(std::thread::hardware_concurrency());
+            workersCount  = (hardware > 1) ? hardware - 1 : 0;
+        }
+
+        // One queue for each worker and one for the threads outside.
+        for(size_t i = 0; i <= workersCount; ++i) {
+            m_queues.emplace_back(new Queue());
+        }
+        for(size_t i = 0; i < workersCount; ++i) {
+            m_workers.emplace_back([this, i]() { WorkerLoop(i); });
+        }
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Runs the tasks still queued, then joins the workers.
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_sleepMutex);
+            m_stop = true;
+        }
+        m_wakeUp.notify_all();
+
+        for(auto &worker : m_workers) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool& operator=(const ThreadPool &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Tasks                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Queues the task - Tasks must not throw.
+    inline void
+    Submit(Task task)
+    {
+        // Workers keep their tasks, the others spread them.
+        auto index = (GetCurrentPool() == this)
+            ? GetCurrentIndex()
+            : m_nextQueue.fetch_add(1) % m_queues.size();
+
+        {
+            auto &queue = *m_queues[index];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        ++m_pending;
+
+        // Empty lock - A worker between checking m_pending and sleeping
+        // would miss the notification otherwise.
+        { std::lock_guard<std::mutex> lock(m_sleepMutex); }
+        m_wakeUp.notify_one();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Runs one queued task on the calling thread.
+    /// @returns false if there was none.
+    inline bool
+    TryRunOne()
+    {
+        auto home = (GetCurrentPool() == this) ? GetCurrentIndex() : m_queues.size() - 1;
+
+        Task task;
+        if(!PopOrSteal(home, &task)) {
+            return false;
+        }
+
+        task();
+        return true;
+    }
+
+    inline size_t GetWorkersCount() const noexcept { return m_workers.size(); }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    struct Queue
+    {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+    };
+
+    inline static ThreadPool*&
+    GetCurrentPool() noexcept
+    {
+        static thread_local ThreadPool *s_pool = nullptr;
+        return s_pool;
+    }
+
+    inline static size_t&
+    GetCurrentIndex() noexcept
+    {
+        static thread_local size_t s_index = 0;
+        return s_index;
+    }
+
+    inline bool
+    PopOrSteal(size_t home, Task *pOut_Task)
+    {
+        // Newest of our own queue - Its data is likely still in the cache.
+        {
+            auto &queue = *m_queues[home];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(!queue.tasks.empty()) {
+                *pOut_Task = std::move(queue.tasks.back());
+                queue.tasks.pop_back();
+                --m_pending;
+                return true;
+            }
+        }
+
+        // Oldest of the others - Usually the biggest piece of work left.
+        for(size_t i = 1; i < m_queues.size(); ++i) {
+            auto &queue = *m_queues[(home + i) % m_queues.size()];
+            std::lock_guard<std::mutex> lock(queue.mutex);
+            if(!queue.tasks.empty()) {
+                *pOut_Task = std::move(queue.tasks.front());
+                queue.tasks.pop_front();
+                --m_pending;
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    inline void
+    WorkerLoop(size_t index)
+    {
+        GetCurrentPool () = this;
+        GetCurrentIndex() = index;
+
+        while(true) {
+            Task task;
+            if(PopOrSteal(index, &task)) {
+                task();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_sleepMutex);
+            m_wakeUp.wait(lock, [this]() { return m_stop || m_pending > 0; });
+            if(m_stop && m_pending == 0) {
+                return;
+            }
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<std::unique_ptr<Queue>> m_queues;
+    std::vector<std::thread>            m_workers;
+
+    std::atomic<size_t>     m_pending;
+    std::atomic<size_t>     m_nextQueue;
+    std::mutex              m_sleepMutex;
+    std::condition_variable m_wakeUp;
+    bool                    m_stop;
+
+}; // class ThreadPool
+
+
+//----------------------------------------------------------------------------//
+// Parallel Algorithms                                                        //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Calls func(chunkBegin, chunkEnd) for chunks of grainSize indices
+///   covering [begin, end) - In any order and at the same time, so func
+///   must be safe for that, and must not throw.
+///   A single chunk (or a pool without workers) runs on the calling thread,
+///   so grainSize is also the threshold below which nothing is parallel.
+template <typename Func>
+inline void
+ParallelFor(
+    size_t      begin,
+    size_t      end,
+    size_t      grainSize,
+    Func        func,
+    ThreadPool &pool = ThreadPool::GetDefault())
+{
+    ACOW_MATH_TIME(ParallelFor, (end > begin) ? end - begin : 0);
+
+    if(end <= begin) {
+        return;
+    }
+
+    grainSize = std::max(grainSize, size_t(1));
+    auto chunks = (end - begin + grainSize - 1) / grainSize;
+    if(chunks < 2 || pool.GetWorkersCount() == 0) {
+        func(begin, end);
+        return;
+    }
+
+    // Chunks are claimed one by one, so the faster threads take more.
+    std::atomic<size_t> next    (0);
+    std::atomic<size_t> finished(0);
+    auto run = [&]() {
+        for(auto chunk = next++; chunk < chunks; chunk = next++) {
+            auto chunk_begin = begin + chunk * grainSize;
+            func(chunk_begin, std::min(chunk_begin + grainSize, end));
+        }
+    };
+
+    auto helpers = std::min(pool.GetWorkersCount(), chunks - 1);
+    for(size_t i = 0; i < helpers; ++i) {
+        pool.Submit([&]() { run(); ++finished; });
+    }
+    run();
+
+    // The helpers reference this frame - Wait for all, not only the chunks.
+    while(finished != helpers) {
+        if(!pool.TryRunOne()) {
+            std::this_thread::yield();
+        }
+    }
+}
+
+///-----------------------------------------------------------------------------
+/// @brief reduce(...reduce(reduce(identity, map(chunk0)), map(chunk1))...)
+///   with map(chunkBegin, chunkEnd) running as in ParallelFor. The partial
+///   results are reduced in order, so the result only depends on grainSize,
+///   never on the number of threads.
+template <typename T, typename Map, typename Reduce>
+inline T
+ParallelReduce(
+    size_t      begin,
+    size_t      end,
+    size_t      grainSize,
+    const T    &identity,
+    Map         map,
+    Reduce      reduce,
+    ThreadPool &pool = ThreadPool::GetDefault())
+{
+    if(end <= begin) {
+        return identity;
+    }
+
+    grainSize = std::max(grainSize, size_t(1));
+    auto chunks = (end - begin + grainSize - 1) / grainSize;
+
+    std::vector<T> partials(chunks, identity);
+    ParallelFor(0, chunks, 1, [&](size_t first, size_t last) {
+        for(auto chunk = first; chunk < last; ++chunk) {
+            auto chunk_begin = begin + chunk * grainSize;
+            partials[chunk] = map(chunk_begin, std::min(chunk_begin + grainSize, end));
+        }
+    }, pool);
+
+    auto result = identity;
+    for(const auto &partial : partials) {
+        result = reduce(result, partial);
+    }
+    return result;
+}
+
+} // namespace math
+} // namespace acow
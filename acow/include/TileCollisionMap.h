@@ -0,0 +1,674 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TileCollisionMap.h                                            //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Solid / empty tiles of a fixed size map, one bit each, packed in        //
+//    u64 words per row and addressed by Coord.                               //
+//                                                                            //
+//    Rect overlap, raycast (grid DDA) and move and slide work on whole       //
+//    words of a row, so a query costs a few bit ops per covered row.         //
+//    Tiles outside of the map are empty.                                     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Bits.h"
+#include "Coord.h"
+#include "Operations.h"
+#include "Rect.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+class TileCollisionMap
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static i32 kBitsPerWord = 64;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sides of the box that MoveAndSlide stopped against.
+    constexpr static u32 kContactNone   = 0;
+    constexpr static u32 kContactLeft   = (1u << 0);
+    constexpr static u32 kContactRight  = (1u << 1);
+    constexpr static u32 kContactTop    = (1u << 2);
+    constexpr static u32 kContactBottom = (1u << 3);
+
+    ///-------------------------------------------------------------------------
+    /// @brief First solid tile along a ray.
+    ///   t is the fraction of start -> end where it entered the tile and
+    ///   normal the side it entered by - Zero when it starts inside.
+    struct TileHit
+    {
+        Coord tile;
+        Vec2  point;
+        Vec2  normal;
+        float t;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a map with every tile empty.
+    ///   Tile (y, x) covers the world Rect(origin.x + x * tileSize,
+    ///   origin.y + y * tileSize, tileSize, tileSize). A power of two
+    ///   tileSize keeps the world <-> tile math exact.
+    TileCollisionMap(
+        i32         width,
+        i32         height,
+        float       tileSize = 1.0f,
+        const Vec2 &origin   = Vec2::Zero())
+        : m_width       (Max(width,  0))
+        , m_height      (Max(height, 0))
+        , m_wordsPerRow ((m_width + kBitsPerWord - 1) / kBitsPerWord)
+        , m_tileSize    (tileSize)
+        , m_invTileSize (1.0f / tileSize)
+        , m_origin      (origin)
+        , m_words       (size_t(m_wordsPerRow) * size_t(m_height), 0)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    inline i32         GetWidth      () const noexcept { return m_width;       }
+    inline i32         GetHeight     () const noexcept { return m_height;      }
+    inline i32         GetWordsPerRow() const noexcept { return m_wordsPerRow; }
+    inline float       GetTileSize   () const noexcept { return m_tileSize;    }
+    inline const Vec2& GetOrigin     () const noexcept { return m_origin;      }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The GetWordsPerRow() words of the row - Bit x % 64 of word
+    ///   x / 64 is the tile x. Bits past the width are always 0.
+    inline const u64*
+    GetRowWords(i32 y) const noexcept
+    {
+        return m_words.data() + size_t(y) * size_t(m_wordsPerRow);
+    }
+
+    inline bool
+    IsInside(const Coord &tile) const noexcept
+    {
+        return tile.y >= 0 && tile.y < m_height
+            && tile.x >= 0 && tile.x < m_width;
+    }
+
+    inline Rect
+    GetTileRect(const Coord &tile) const noexcept
+    {
+        return Rect(GetTileLeft(tile.x), GetTileTop(tile.y), m_tileSize, m_tileSize);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Tile that holds the world point.
+    inline Coord
+    GetTileAt(const Vec2 &point) const noexcept
+    {
+        return Coord(
+            ToTile(std::floor((point.y - m_origin.y) * m_invTileSize), m_height),
+            ToTile(std::floor((point.x - m_origin.x) * m_invTileSize), m_width)
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief First and last tiles (inclusive) that the Rect overlaps -
+    ///   Half open like Rect, so a Rect ending on a tile edge doesn't
+    ///   cover the next tile. Clipped to one tile past each side.
+    inline void
+    GetTileRange(const Rect &rect, Coord *pOut_First, Coord *pOut_Last) const noexcept
+    {
+        *pOut_First = Coord(FirstRow(rect.GetTop()), FirstColumn(rect.GetLeft()));
+        *pOut_Last  = Coord(LastRow (rect.GetBottom()), LastColumn(rect.GetRight()));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Tiles                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    inline bool
+    IsSolid(const Coord &tile) const noexcept
+    {
+        if(!IsInside(tile)) {
+            return false;
+        }
+        return (GetRowWords(tile.y)[tile.x / kBitsPerWord] >> (tile.x % kBitsPerWord)) & 1u;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Tiles outside of the map are ignored.
+    inline void
+    SetSolid(const Coord &tile, bool solid) noexcept
+    {
+        if(!IsInside(tile)) {
+            return;
+        }
+
+        auto &word = GetRowWordsMutable(tile.y)[tile.x / kBitsPerWord];
+        auto  bit  = u64(1) << (tile.x % kBitsPerWord);
+        word = (solid) ? (word | bit) : (word & ~bit);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets every tile from first to last (inclusive) - A word at a
+    ///   time. Clipped to the map.
+    inline void
+    Fill(const Coord &first, const Coord &last, bool solid) noexcept
+    {
+        auto x0 = Max(first.x, 0);
+        auto x1 = Min(last .x, m_width - 1);
+        auto y0 = Max(first.y, 0);
+        auto y1 = Min(last .y, m_height - 1);
+
+        for(auto y = y0; y <= y1 && x0 <= x1; ++y) {
+            auto p_words = GetRowWordsMutable(y);
+            for(auto w = x0 / kBitsPerWord; w <= x1 / kBitsPerWord; ++w) {
+                auto mask = SpanMask(w, x0, x1);
+                p_words[w] = (solid) ? (p_words[w] | mask) : (p_words[w] & ~mask);
+            }
+        }
+    }
+
+    inline void
+    Clear() noexcept
+    {
+        std::fill(m_words.begin(), m_words.end(), u64(0));
+    }
+
+    inline size_t
+    GetSolidCount() const noexcept
+    {
+        size_t count = 0;
+        for(auto word : m_words) {
+            count += size_t(PopCount(word));
+        }
+        return count;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Overlap                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief If any tile from first to last (inclusive) is solid.
+    inline bool
+    AnySolid(const Coord &first, const Coord &last) const noexcept
+    {
+        return AnySolidClipped(
+            Max(first.x, 0), Max(first.y, 0),
+            Min(last .x, m_width - 1), Min(last.y, m_height - 1)
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief If the Rect overlaps any solid tile - Touching edges don't
+    ///   count, same as Rect::Intersects.
+    inline bool
+    Overlaps(const Rect &rect) const noexcept
+    {
+        // Clipped while still in float, so the conversions are plain
+        // truncations - Written so NaNs fail the tests.
+        auto left   = (rect.GetLeft  () - m_origin.x) * m_invTileSize;
+        auto right  = (rect.GetRight () - m_origin.x) * m_invTileSize;
+        auto top    = (rect.GetTop   () - m_origin.y) * m_invTileSize;
+        auto bottom = (rect.GetBottom() - m_origin.y) * m_invTileSize;
+        if(!(right  > 0.0f) || !(left < float(m_width )) ||
+           !(bottom > 0.0f) || !(top  < float(m_height)))
+        {
+            return false;
+        }
+
+        // ceil(v) - 1 is the last tile, v itself when it isn't whole.
+        auto x0 = (left > 0.0f) ? i32(left) : 0;
+        auto y0 = (top  > 0.0f) ? i32(top)  : 0;
+        auto x1 = (right  < float(m_width )) ? i32(right)  : m_width;
+        auto y1 = (bottom < float(m_height)) ? i32(bottom) : m_height;
+        x1 -= (float(x1) == right ) ? 1 : 0;
+        y1 -= (float(y1) == bottom) ? 1 : 0;
+
+        return AnySolidClipped(x0, y0, Min(x1, m_width - 1), Min(y1, m_height - 1));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Raycast                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Walks the tiles from start to end (Amanatides & Woo DDA) and
+    ///   stops on the first solid one. pOut_Hit can be nullptr.
+    /// @returns If a solid tile was hit.
+    inline bool
+    Raycast(const Vec2 &start, const Vec2 &end, TileHit *pOut_Hit) const noexcept
+    {
+        // In tile units from here on.
+        auto px = (start.x - m_origin.x) * m_invTileSize;
+        auto py = (start.y - m_origin.y) * m_invTileSize;
+        auto dx = (end.x - start.x) * m_invTileSize;
+        auto dy = (end.y - start.y) * m_invTileSize;
+
+        // Clips the segment to the map first (Liang-Barsky), so the walk
+        // only visits tiles of the map however far the ends are.
+        auto t0     = 0.0f;
+        auto t1     = 1.0f;
+        auto normal = Vec2::Zero();
+        if(!ClipAxis(px, dx, float(m_width),  Vec2(1.0f, 0.0f), &t0, &t1, &normal) ||
+           !ClipAxis(py, dy, float(m_height), Vec2(0.0f, 1.0f), &t0, &t1, &normal))
+        {
+            return false;
+        }
+
+        auto x      = Clamp(i32(std::floor(px + dx * t0)), 0, m_width  - 1);
+        auto y      = Clamp(i32(std::floor(py + dy * t0)), 0, m_height - 1);
+        auto x_end  = Clamp(i32(std::floor(px + dx * t1)), 0, m_width  - 1);
+        auto y_end  = Clamp(i32(std::floor(py + dy * t1)), 0, m_height - 1);
+        auto step_x = (dx > 0.0f) ? 1 : -1;
+        auto step_y = (dy > 0.0f) ? 1 : -1;
+
+        // t of the next vertical / horizontal edge, and between edges.
+        auto inf       = std::numeric_limits<float>::infinity();
+        auto t_delta_x = (dx != 0.0f) ? std::fabs(1.0f / dx) : inf;
+        auto t_delta_y = (dy != 0.0f) ? std::fabs(1.0f / dy) : inf;
+        auto t_max_x   = (dx != 0.0f) ? (float(x + (step_x > 0)) - px) / dx : inf;
+        auto t_max_y   = (dy != 0.0f) ? (float(y + (step_y > 0)) - py) / dy : inf;
+
+        auto t     = t0;
+        auto steps = std::abs(x_end - x) + std::abs(y_end - y);
+        for(auto i = 0; ; ++i) {
+            if(IsSolid(Coord(y, x))) {
+                if(pOut_Hit) {
+                    pOut_Hit->tile   = Coord(y, x);
+                    pOut_Hit->point  = start + (end - start) * t;
+                    pOut_Hit->normal = normal;
+                    pOut_Hit->t      = t;
+                }
+                return true;
+            }
+            if(i >= steps) {
+                return false;
+            }
+
+            if(t_max_x < t_max_y) {
+                t        = t_max_x;
+                x       += step_x;
+                t_max_x += t_delta_x;
+                normal   = Vec2(float(-step_x), 0.0f);
+            } else {
+                t        = t_max_y;
+                y       += step_y;
+                t_max_y += t_delta_y;
+                normal   = Vec2(0.0f, float(-step_y));
+            }
+
+            if(x < 0 || x >= m_width || y < 0 || y >= m_height) {
+                return false;
+            }
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Move and Slide                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Moves the box by delta, x first and then y, stopping each
+    ///   axis at the first solid tile in the swept range - So it slides
+    ///   along walls and floors, and fast boxes don't tunnel.
+    ///   Only the tiles that the box enters are tested: a box that is
+    ///   already inside of solid tiles can still move out of them.
+    /// @returns The moved box. pOut_Contacts (can be nullptr) gets the
+    ///   kContact flags of the sides that were stopped.
+    inline Rect
+    MoveAndSlide(const Rect &box, const Vec2 &delta, u32 *pOut_Contacts = nullptr) const noexcept
+    {
+        auto moved    = box;
+        auto contacts = kContactNone;
+
+        // x - The rows the box covers, the columns it enters.
+        if(delta.x != 0.0f) {
+            auto y0 = FirstRow(moved.GetTop   ());
+            auto y1 = LastRow (moved.GetBottom());
+            auto x  = moved.x + delta.x;
+
+            if(delta.x > 0.0f) {
+                auto c0  = LastColumn(moved.GetRight()) + 1;
+                auto c1  = LastColumn(x + moved.w);
+                auto hit = FindFirstInRows(y0, y1, c0, c1);
+                if(hit >= 0) {
+                    auto edge = GetTileLeft(hit);
+                    auto step = GetEdgeStep(edge, moved.w, m_origin.x);
+                    for(x = edge - moved.w; LastColumn(x + moved.w) >= hit; step *= 2.0f) {
+                        x -= step;
+                    }
+                    contacts |= kContactRight;
+                }
+            } else {
+                auto c0  = FirstColumn(moved.GetLeft()) - 1;
+                auto c1  = FirstColumn(x);
+                auto hit = FindLastInRows(y0, y1, c1, c0);
+                if(hit >= 0) {
+                    auto edge = GetTileLeft(hit + 1);
+                    auto step = GetEdgeStep(edge, 0.0f, m_origin.x);
+                    for(x = edge; FirstColumn(x) <= hit; step *= 2.0f) {
+                        x += step;
+                    }
+                    contacts |= kContactLeft;
+                }
+            }
+            moved.x = x;
+        }
+
+        // y - Same, with the columns of the already moved box.
+        if(delta.y != 0.0f) {
+            auto x0 = FirstColumn(moved.GetLeft ());
+            auto x1 = LastColumn (moved.GetRight());
+            auto y  = moved.y + delta.y;
+
+            if(delta.y > 0.0f) {
+                auto r0  = LastRow(moved.GetBottom()) + 1;
+                auto r1  = LastRow(y + moved.h);
+                auto hit = FindFirstRow(r0, r1, x0, x1);
+                if(hit >= 0) {
+                    auto edge = GetTileTop(hit);
+                    auto step = GetEdgeStep(edge, moved.h, m_origin.y);
+                    for(y = edge - moved.h; LastRow(y + moved.h) >= hit; step *= 2.0f) {
+                        y -= step;
+                    }
+                    contacts |= kContactBottom;
+                }
+            } else {
+                auto r0  = FirstRow(moved.GetTop()) - 1;
+                auto r1  = FirstRow(y);
+                auto hit = FindLastRow(r1, r0, x0, x1);
+                if(hit >= 0) {
+                    auto edge = GetTileTop(hit + 1);
+                    auto step = GetEdgeStep(edge, 0.0f, m_origin.y);
+                    for(y = edge; FirstRow(y) <= hit; step *= 2.0f) {
+                        y += step;
+                    }
+                    contacts |= kContactTop;
+                }
+            }
+            moved.y = y;
+        }
+
+        if(pOut_Contacts) {
+            *pOut_Contacts = contacts;
+        }
+        return moved;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline u64*
+    GetRowWordsMutable(i32 y) noexcept
+    {
+        return m_words.data() + size_t(y) * size_t(m_wordsPerRow);
+    }
+
+    inline float GetTileLeft(i32 x) const noexcept { return m_origin.x + float(x) * m_tileSize; }
+    inline float GetTileTop (i32 y) const noexcept { return m_origin.y + float(y) * m_tileSize; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief One ulp of the largest value that goes into an edge test.
+    ///   The stop position is the tile edge (minus the box size) and
+    ///   only the rounding of those sums can put it back on the tile,
+    ///   so a step of this size (doubled on each retry) settles it in
+    ///   one or two tries - Instead of walking the ulps of a position
+    ///   that can be close to zero.
+    inline static float
+    GetEdgeStep(float edge, float size, float origin) noexcept
+    {
+        auto v = std::max(std::fabs(edge), std::max(std::fabs(size), std::fabs(origin)));
+        return std::nextafter(v, std::numeric_limits<float>::infinity()) - v;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Clamps to [-1, size] before converting - Far away (and
+    ///   infinite) coordinates stay one tile outside of the map.
+    inline static i32
+    ToTile(float tile, i32 size) noexcept
+    {
+        return (tile <  0.0f)        ? -1
+             : (tile >= float(size)) ? size
+             : i32(tile);
+    }
+
+    inline i32 FirstColumn(float left  ) const noexcept { return ToTile(std::floor((left   - m_origin.x) * m_invTileSize), m_width);      }
+    inline i32 LastColumn (float right ) const noexcept { return ToTile(std::ceil ((right  - m_origin.x) * m_invTileSize), m_width) - 1;  }
+    inline i32 FirstRow   (float top   ) const noexcept { return ToTile(std::floor((top    - m_origin.y) * m_invTileSize), m_height);     }
+    inline i32 LastRow    (float bottom) const noexcept { return ToTile(std::ceil ((bottom - m_origin.y) * m_invTileSize), m_height) - 1; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Shrinks [t0, t1] to where p + d * t is in [0, size] - The
+    ///   coordinate on axis. pNormal becomes the entering side when t0
+    ///   moves.
+    /// @returns false if nothing is left.
+    inline static bool
+    ClipAxis(
+        float       p,
+        float       d,
+        float       size,
+        const Vec2 &axis,
+        float      *pT0,
+        float      *pT1,
+        Vec2       *pNormal) noexcept
+    {
+        if(d == 0.0f) {
+            return p >= 0.0f && p < size;
+        }
+
+        auto enter = ((d > 0.0f) ? 0.0f : size) - p;
+        auto leave = ((d > 0.0f) ? size : 0.0f) - p;
+        auto t_in  = enter / d;
+        auto t_out = leave / d;
+        if(t_in > *pT0) {
+            *pT0     = t_in;
+            *pNormal = axis * ((d > 0.0f) ? -1.0f : 1.0f);
+        }
+        *pT1 = Min(*pT1, t_out);
+
+        return *pT0 <= *pT1;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Bits x0 to x1 (inclusive) that fall in the word w.
+    inline static u64
+    SpanMask(i32 w, i32 x0, i32 x1) noexcept
+    {
+        auto lo = (w == x0 / kBitsPerWord) ? (~u64(0) << (x0 % kBitsPerWord))                  : ~u64(0);
+        auto hi = (w == x1 / kBitsPerWord) ? (~u64(0) >> (kBitsPerWord - 1 - x1 % kBitsPerWord)) : ~u64(0);
+        return lo & hi;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief AnySolid with the range already inside of the map.
+    inline bool
+    AnySolidClipped(i32 x0, i32 y0, i32 x1, i32 y1) const noexcept
+    {
+        if(x0 > x1) {
+            return false;
+        }
+
+        // The masks of the first and last words are the same on every row.
+        auto w0      = x0 / kBitsPerWord;
+        auto w1      = x1 / kBitsPerWord;
+        auto mask0   = SpanMask(w0, x0, x1);
+        auto mask1   = SpanMask(w1, x0, x1);
+        auto p_words = m_words.data() + size_t(y0) * size_t(m_wordsPerRow);
+
+        // Most boxes are within a single word of each row.
+        if(w0 == w1) {
+            for(auto y = y0; y <= y1; ++y, p_words += m_wordsPerRow) {
+                if(p_words[w0] & mask0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        for(auto y = y0; y <= y1; ++y, p_words += m_wordsPerRow) {
+            auto bits = (p_words[w0] & mask0) | (p_words[w1] & mask1);
+            for(auto w = w0 + 1; w < w1; ++w) {
+                bits |= p_words[w];
+            }
+            if(bits != 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Lowest / highest solid x in [x0, x1] of the row.
+    /// @returns -1 if none.
+    inline i32
+    FindFirstInRow(i32 y, i32 x0, i32 x1) const noexcept
+    {
+        x0 = Max(x0, 0);
+        x1 = Min(x1, m_width - 1);
+        if(y < 0 || y >= m_height || x0 > x1) {
+            return -1;
+        }
+
+        auto p_words = GetRowWords(y);
+        for(auto w = x0 / kBitsPerWord; w <= x1 / kBitsPerWord; ++w) {
+            auto bits = p_words[w] & SpanMask(w, x0, x1);
+            if(bits != 0) {
+                return w * kBitsPerWord + CountTrailingZeros(bits);
+            }
+        }
+        return -1;
+    }
+
+    inline i32
+    FindLastInRow(i32 y, i32 x0, i32 x1) const noexcept
+    {
+        x0 = Max(x0, 0);
+        x1 = Min(x1, m_width - 1);
+        if(y < 0 || y >= m_height || x0 > x1) {
+            return -1;
+        }
+
+        auto p_words = GetRowWords(y);
+        for(auto w = x1 / kBitsPerWord; w >= x0 / kBitsPerWord; --w) {
+            auto bits = p_words[w] & SpanMask(w, x0, x1);
+            if(bits != 0) {
+                return w * kBitsPerWord + (kBitsPerWord - 1 - CountLeadingZeros(bits));
+            }
+        }
+        return -1;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Lowest / highest solid column in [x0, x1] over the rows
+    ///   y0 to y1 - The span shrinks to the best found so far.
+    /// @returns -1 if none.
+    inline i32
+    FindFirstInRows(i32 y0, i32 y1, i32 x0, i32 x1) const noexcept
+    {
+        auto best = -1;
+        for(auto y = Max(y0, 0); y <= Min(y1, m_height - 1); ++y) {
+            auto x = FindFirstInRow(y, x0, x1);
+            if(x >= 0) {
+                best = x;
+                x1   = x - 1;
+            }
+        }
+        return best;
+    }
+
+    inline i32
+    FindLastInRows(i32 y0, i32 y1, i32 x0, i32 x1) const noexcept
+    {
+        auto best = -1;
+        for(auto y = Max(y0, 0); y <= Min(y1, m_height - 1); ++y) {
+            auto x = FindLastInRow(y, x0, x1);
+            if(x >= 0) {
+                best = x;
+                x0   = x + 1;
+            }
+        }
+        return best;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Lowest / highest row in [y0, y1] with a solid tile in the
+    ///   columns x0 to x1.
+    /// @returns -1 if none.
+    inline i32
+    FindFirstRow(i32 y0, i32 y1, i32 x0, i32 x1) const noexcept
+    {
+        for(auto y = Max(y0, 0); y <= Min(y1, m_height - 1); ++y) {
+            if(FindFirstInRow(y, x0, x1) >= 0) {
+                return y;
+            }
+        }
+        return -1;
+    }
+
+    inline i32
+    FindLastRow(i32 y0, i32 y1, i32 x0, i32 x1) const noexcept
+    {
+        for(auto y = Min(y1, m_height - 1); y >= Max(y0, 0); --y) {
+            if(FindFirstInRow(y, x0, x1) >= 0) {
+                return y;
+            }
+        }
+        return -1;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    i32   m_width;
+    i32   m_height;
+    i32   m_wordsPerRow;
+    float m_tileSize;
+    float m_invTileSize;
+    Vec2  m_origin;
+
+    std::vector<u64> m_words;
+
+}; // class TileCollisionMap
+
+} // namespace math
+} // namespace acow
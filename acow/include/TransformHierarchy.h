@@ -0,0 +1,286 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TransformHierarchy.h                                          //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Flat 2D transform hierarchy with lazy world transforms and bounds.      //
+//                                                                            //
+//    Nodes live in parallel arrays, each parent before its children, so      //
+//    Update is one linear pass - A node is recomputed when it or any of      //
+//    its ancestors changed since the last Update, and the pass starts at     //
+//    the first changed node. The rotations keep their cos / sin, so the      //
+//    pass does no trigonometry.                                              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <algorithm>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Affine2.h"
+#include "DeterministicMath.h"
+#include "Instrumentation.h"
+#include "Rect.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+class TransformHierarchy
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    constexpr static u32 kNoParent = ~u32(0);
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    TransformHierarchy() noexcept
+        : m_firstDirty(0)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Nodes                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief parent must be kNoParent or a node already added - That keeps
+    ///   the parents before their children.
+    ///   localBounds is in the node space, its world bounds follow it.
+    /// @returns The node index.
+    inline u32
+    AddNode(
+        u32         parent,
+        const Vec2 &position,
+        float       degrees     = 0.0f,
+        const Vec2 &scale       = Vec2(1.0f, 1.0f),
+        const Rect &localBounds = Rect())
+    {
+        auto index = u32(m_parents.size());
+
+        auto s = 0.0f;
+        auto c = 0.0f;
+        SinCos(ToRadians(degrees), &s, &c);
+
+        m_parents    .push_back(parent);
+        m_positions  .push_back(position);
+        m_rotations  .push_back(degrees);
+        m_cosSin     .push_back(Vec2(c, s));
+        m_scales     .push_back(scale);
+        m_localBounds.push_back(localBounds);
+        m_worlds     .push_back(Affine2::Identity());
+        m_worldBounds.push_back(Rect());
+        m_dirty      .push_back(0);
+
+        MarkDirty(index);
+        return index;
+    }
+
+    inline void
+    Reserve(size_t count)
+    {
+        m_parents    .reserve(count);
+        m_positions  .reserve(count);
+        m_rotations  .reserve(count);
+        m_cosSin     .reserve(count);
+        m_scales     .reserve(count);
+        m_localBounds.reserve(count);
+        m_worlds     .reserve(count);
+        m_worldBounds.reserve(count);
+        m_dirty      .reserve(count);
+    }
+
+    inline void
+    Clear() noexcept
+    {
+        m_parents    .clear();
+        m_positions  .clear();
+        m_rotations  .clear();
+        m_cosSin     .clear();
+        m_scales     .clear();
+        m_localBounds.clear();
+        m_worlds     .clear();
+        m_worldBounds.clear();
+        m_dirty      .clear();
+        m_firstDirty = 0;
+    }
+
+    inline size_t GetNodesCount() const noexcept { return m_parents.size(); }
+    inline u32    GetParent(u32 node) const noexcept { return m_parents[node]; }
+
+
+    //------------------------------------------------------------------------//
+    // Local Transform                                                        //
+    //   The setters only mark the node - The world values change on Update.  //
+    //------------------------------------------------------------------------//
+public:
+    inline const Vec2& GetPosition   (u32 node) const noexcept { return m_positions  [node]; }
+    inline float       GetRotation   (u32 node) const noexcept { return m_rotations  [node]; }
+    inline const Vec2& GetScale      (u32 node) const noexcept { return m_scales     [node]; }
+    inline const Rect& GetLocalBounds(u32 node) const noexcept { return m_localBounds[node]; }
+
+    inline void
+    SetPosition(u32 node, const Vec2 &position) noexcept
+    {
+        m_positions[node] = position;
+        MarkDirty(node);
+    }
+
+    inline void
+    SetRotation(u32 node, float degrees) noexcept
+    {
+        auto s = 0.0f;
+        auto c = 0.0f;
+        SinCos(ToRadians(degrees), &s, &c);
+
+        m_rotations[node] = degrees;
+        m_cosSin   [node] = Vec2(c, s);
+        MarkDirty(node);
+    }
+
+    inline void
+    SetScale(u32 node, const Vec2 &scale) noexcept
+    {
+        m_scales[node] = scale;
+        MarkDirty(node);
+    }
+
+    inline void
+    SetLocalBounds(u32 node, const Rect &localBounds) noexcept
+    {
+        m_localBounds[node] = localBounds;
+        MarkDirty(node);
+    }
+
+    inline void
+    Translate(u32 node, const Vec2 &delta) noexcept
+    {
+        m_positions[node] += delta;
+        MarkDirty(node);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // World Transform                                                        //
+    //   As of the last Update.                                               //
+    //------------------------------------------------------------------------//
+public:
+    inline const Affine2& GetWorld        (u32 node) const noexcept { return m_worlds[node]; }
+    inline Vec2           GetWorldPosition(u32 node) const noexcept { return m_worlds[node].GetTranslation(); }
+    inline const Rect&    GetWorldBounds  (u32 node) const noexcept { return m_worldBounds[node]; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief All the world bounds, in node order - For the batch queries.
+    inline const Rect* GetWorldBoundsData() const noexcept { return m_worldBounds.data(); }
+
+    inline bool
+    IsDirty() const noexcept
+    {
+        return m_firstDirty < m_parents.size();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Update                                                                 //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Recomputes the world transforms and bounds of the changed
+    ///   nodes and their descendants.
+    /// @returns How many nodes were recomputed.
+    inline size_t
+    Update() noexcept
+    {
+        auto count = m_parents.size();
+        if(m_firstDirty >= count) {
+            return 0;
+        }
+
+        ACOW_MATH_TIME(TransformUpdate, count - m_firstDirty);
+
+        auto p_parents = m_parents.data();
+        auto p_dirty   = m_dirty  .data();
+        auto p_worlds  = m_worlds .data();
+
+        size_t updated = 0;
+        for(size_t i = m_firstDirty; i < count; ++i) {
+            auto parent = p_parents[i];
+
+            // Parents come first, so their flag is already final here.
+            if(parent != kNoParent && p_dirty[parent]) {
+                p_dirty[i] = 1;
+            }
+            if(!p_dirty[i]) {
+                continue;
+            }
+
+            const auto &cos_sin = m_cosSin[i];
+            auto local = Affine2::FromTRS(m_positions[i], cos_sin.x, cos_sin.y, m_scales[i]);
+
+            p_worlds[i]      = (parent == kNoParent) ? local : p_worlds[parent] * local;
+            m_worldBounds[i] = p_worlds[i].TransformRect(m_localBounds[i]);
+            ++updated;
+        }
+
+        // Only cleared now - The children read their parents' flags above.
+        std::fill(m_dirty.begin() + m_firstDirty, m_dirty.end(), u8(0));
+        m_firstDirty = count;
+
+        return updated;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline void
+    MarkDirty(u32 node) noexcept
+    {
+        m_dirty[node] = 1;
+        m_firstDirty  = std::min(m_firstDirty, size_t(node));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<u32>     m_parents;
+    std::vector<Vec2>    m_positions;
+    std::vector<float>   m_rotations;
+    std::vector<Vec2>    m_cosSin;
+    std::vector<Vec2>    m_scales;
+    std::vector<Rect>    m_localBounds;
+    std::vector<Affine2> m_worlds;
+    std::vector<Rect>    m_worldBounds;
+    std::vector<u8>      m_dirty;
+    size_t               m_firstDirty;
+
+}; // class TransformHierarchy
+
+} // namespace math
+} // namespace acow
@@ -26,6 +26,9 @@
 #include "acow/cpp_goodies.h"
 // acow_math_goodies
 #include "Constants.h"
+#include "DeterministicMath.h"
+#include "Instrumentation.h"
+#include "Operations.h"
 
 
 namespace acow { namespace math {
@@ -85,7 +88,7 @@ public:
     ACOW_CONSTEXPR_LOOSE float
     Magnitude() const noexcept
     {
-        return sqrtf(x*x + y*y);
+        return math::Sqrt(x*x + y*y);
     }
 
     ACOW_CONSTEXPR_STRICT float
@@ -102,7 +105,7 @@ public:
     ACOW_CONSTEXPR_LOOSE inline float
     Distance(const Vec2 v2) const noexcept
     {
-        return sqrtf(
+        return math::Sqrt(
             (x - v2.x) * (x - v2.x) +
             (y - v2.y) * (y - v2.y)
         );
@@ -123,6 +126,8 @@ public:
     ACOW_CONSTEXPR_LOOSE inline
     void Normalize() noexcept
     {
+        ACOW_MATH_COUNT_CONSTEXPR(Vec2Normalize);
+
         auto magnitude = Magnitude();
         x /= magnitude; y /= magnitude;
     }
@@ -144,12 +149,16 @@ public:
     ACOW_CONSTEXPR_LOOSE inline void
     Rotate(float degrees) noexcept
     {
-        auto r = (degrees * math::kDegrees2Radians);
-        auto s = sinf(r);
-        auto c = cosf(r);
+        ACOW_MATH_COUNT_CONSTEXPR(Vec2Rotate);
+
+        auto r = math::ToRadians(degrees);
+        auto s = 0.0f;
+        auto c = 0.0f;
+        math::SinCos(r, &s, &c);
 
-        x = (x * c - y * s);
-        y = (x * s + y * c);
+        auto rx = (x * c - y * s);
+        auto ry = (x * s + y * c);
+        x = rx; y = ry;
     }
 
     ACOW_CONSTEXPR_LOOSE inline Vec2
@@ -270,5 +279,34 @@ operator*(float scalar, const Vec2 &rhs) noexcept
     return rhs * scalar;
 }
 
+
+//----------------------------------------------------------------------------//
+// Lerp                                                                       //
+//----------------------------------------------------------------------------//
+ACOW_CONSTEXPR_STRICT inline Vec2
+Lerp(const Vec2 &s, const Vec2 &e, float t) noexcept
+{
+    return Vec2(Lerp(s.x, e.x, t), Lerp(s.y, e.y, t));
+}
+
+
+//----------------------------------------------------------------------------//
+// Products                                                                   //
+//----------------------------------------------------------------------------//
+ACOW_CONSTEXPR_STRICT inline float
+Dot(const Vec2 &a, const Vec2 &b) noexcept
+{
+    return (a.x * b.x) + (a.y * b.y);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief z of the 3D cross product - Positive when b is counter clockwise
+///   from a (with y up).
+ACOW_CONSTEXPR_STRICT inline float
+Cross(const Vec2 &a, const Vec2 &b) noexcept
+{
+    return (a.x * b.y) - (a.y * b.x);
+}
+
 } // namespace math
 } // namespace acow
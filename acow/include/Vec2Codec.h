@@ -0,0 +1,541 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Vec2Codec.h                                                   //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Streaming codec for Vec2 positions (replays / network snapshots).       //
+//                                                                            //
+//    Each frame is quantized to a grid inside of a bounding Rect, delta      //
+//    encoded against the previous frame (same index is the same object),     //
+//    zigzagged and bit packed in blocks of 16 values, each block with the    //
+//    bits of its largest value - Still objects cost 1 byte every 8.          //
+//                                                                            //
+//    Frame:                                                                  //
+//      varint count | u8 flags | blocks: u8 bits, 2 * bits bytes (LE)        //
+//    Keyframes (first frame, Reset or other count) delta against zero.       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <cstring>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// acow_math_goodies
+#include "Bits.h"
+#include "Instrumentation.h"
+#include "Rect.h"
+#include "SIMD.h"
+#include "Vec2.h"
+
+
+namespace acow { namespace math {
+
+static_assert(sizeof(Vec2) == sizeof(float) * 2, "Codec reads Vec2 arrays as interleaved floats");
+
+//----------------------------------------------------------------------------//
+// Vec2Quantizer                                                              //
+//----------------------------------------------------------------------------//
+class Vec2Quantizer
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The cells are turned into integers by the float mantissa, so
+    ///   they must fit on it.
+    constexpr static u32 kMaxBitsPerAxis = 23;
+
+private:
+    // Adding 2^23 puts the rounded integer in the mantissa bits.
+    constexpr static float kMagic    = 8388608.0f;
+    constexpr static u32   kMantissa = 0x007FFFFFu;
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The fewest bits that keep the cells at most precision wide.
+    inline static Vec2Quantizer
+    FromPrecision(const Rect &bounds, float precision) noexcept
+    {
+        auto extent = (bounds.w > bounds.h) ? bounds.w : bounds.h;
+        auto bits   = u32(1);
+        while(bits < kMaxBitsPerAxis && extent / float((u32(1) << bits) - 1) > precision) {
+            ++bits;
+        }
+        return Vec2Quantizer(bounds, bits);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief bitsPerAxis is clamped to [1, kMaxBitsPerAxis].
+    Vec2Quantizer(const Rect &bounds, u32 bitsPerAxis) noexcept
+        : m_bounds     (bounds)
+        , m_bitsPerAxis(
+            (bitsPerAxis < 1              ) ? 1
+          : (bitsPerAxis > kMaxBitsPerAxis) ? kMaxBitsPerAxis
+          : bitsPerAxis
+        )
+    {
+        auto max_cell = float((u32(1) << m_bitsPerAxis) - 1);
+
+        m_mins  [0] = bounds.x;
+        m_mins  [1] = bounds.y;
+        m_scales[0] = (bounds.w > 0.0f) ? max_cell / bounds.w : 0.0f;
+        m_scales[1] = (bounds.h > 0.0f) ? max_cell / bounds.h : 0.0f;
+        m_cells [0] = bounds.w / max_cell;
+        m_cells [1] = bounds.h / max_cell;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Getters                                                                //
+    //------------------------------------------------------------------------//
+public:
+    inline const Rect& GetBounds     () const noexcept { return m_bounds;      }
+    inline u32         GetBitsPerAxis() const noexcept { return m_bitsPerAxis; }
+    inline u32         GetMaxCell    () const noexcept { return (u32(1) << m_bitsPerAxis) - 1; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Size of the grid cells - Decoded values are off by at most
+    ///   half of it (inside of the bounds).
+    inline Vec2 GetCellSize() const noexcept { return Vec2(m_cells[0], m_cells[1]); }
+
+
+    //------------------------------------------------------------------------//
+    // Quantization                                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief 2 cells (x, y) for each point - Rounded to the nearest cell,
+    ///   points outside of the bounds (and NaNs) are clamped to them.
+    inline void
+    Quantize(const Vec2 *pPoints, size_t count, u32 *pOut_Cells) const noexcept
+    {
+        const float max_cells[2] = { float(GetMaxCell()), float(GetMaxCell()) };
+
+        auto p_in = reinterpret_cast<const float*>(pPoints);
+        auto n    = count * 2;
+
+        size_t i = 0;
+        if(simd::kWidth % 2 == 0) {
+            auto v_min      = simd::LoadPattern(m_mins,   2);
+            auto v_scale    = simd::LoadPattern(m_scales, 2);
+            auto v_max_cell = simd::LoadPattern(max_cells, 2);
+            auto v_zero     = simd::Zero();
+            auto v_magic    = simd::Set1(kMagic);
+            auto v_mantissa = MakeMantissaMask();
+
+            for(; i + simd::kWidth <= n; i += simd::kWidth) {
+                auto q = simd::Mul(simd::Sub(simd::Load(p_in + i), v_min), v_scale);
+                q = simd::Min(v_max_cell, simd::Max(q, v_zero));
+                simd::StoreBits(pOut_Cells + i, simd::And(simd::Add(q, v_magic), v_mantissa));
+            }
+        }
+        for(; i < n; ++i) {
+            auto q = (p_in[i] - m_mins[i & 1]) * m_scales[i & 1];
+            q = (q > 0.0f        ) ? q : 0.0f;
+            q = (q < max_cells[0]) ? q : max_cells[0];
+            q += kMagic;
+
+            u32 bits;
+            std::memcpy(&bits, &q, sizeof(bits));
+            pOut_Cells[i] = bits & kMantissa;
+        }
+    }
+
+    inline void
+    Dequantize(const u32 *pCells, size_t count, Vec2 *pOut_Points) const noexcept
+    {
+        auto p_out = reinterpret_cast<float*>(pOut_Points);
+        auto n     = count * 2;
+
+        size_t i = 0;
+        if(simd::kWidth % 2 == 0) {
+            auto v_min  = simd::LoadPattern(m_mins,  2);
+            auto v_cell = simd::LoadPattern(m_cells, 2);
+
+            auto v_magic    = simd::Set1(kMagic);
+            auto v_mantissa = MakeMantissaMask();
+
+            for(; i + simd::kWidth <= n; i += simd::kWidth) {
+                // The cell in the mantissa of 2^23, then 2^23 taken out.
+                auto bits = simd::And(simd::LoadBits(pCells + i), v_mantissa);
+                auto q    = simd::Sub(simd::Or(bits, v_magic), v_magic);
+                simd::Store(p_out + i, simd::MulAdd(q, v_cell, v_min));
+            }
+        }
+        for(; i < n; ++i) {
+            p_out[i] = float(pCells[i] & kMantissa) * m_cells[i & 1] + m_mins[i & 1];
+        }
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline static simd::f32x
+    MakeMantissaMask() noexcept
+    {
+        u32 lanes[simd::kWidth];
+        for(auto &lane : lanes) {
+            lane = kMantissa;
+        }
+        return simd::LoadBits(lanes);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Rect  m_bounds;
+    u32   m_bitsPerAxis;
+    float m_mins  [2];
+    float m_scales[2];
+    float m_cells [2];
+
+}; // class Vec2Quantizer
+
+
+namespace detail {
+
+constexpr static size_t kCodecBlockSize = 16;
+
+enum CodecFlags : u8
+{
+    kCodecFlagKeyframe = 1,
+}; // enum CodecFlags
+
+///-----------------------------------------------------------------------------
+/// @brief Signed deltas to small unsigned (0, -1, 1, -2... to 0, 1, 2, 3...).
+ACOW_CONSTEXPR_STRICT inline u32 ZigZag  (u32 delta) noexcept { return (delta << 1) ^ (0u - (delta >> 31)); }
+ACOW_CONSTEXPR_STRICT inline u32 UnZigZag(u32 value) noexcept { return (value >> 1) ^ (0u - (value &  1)); }
+
+inline u8*
+WriteVarint(u64 value, u8 *pOut) noexcept
+{
+    while(value >= 0x80) {
+        *pOut++ = u8(value | 0x80);
+        value >>= 7;
+    }
+    *pOut++ = u8(value);
+    return pOut;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief nullptr when the varint doesn't end before pEnd (or is too long).
+inline const u8*
+ReadVarint(const u8 *pBytes, const u8 *pEnd, u64 *pOut_Value) noexcept
+{
+    u64 value = 0;
+    for(u32 shift = 0; pBytes < pEnd && shift < 64; shift += 7) {
+        auto byte = *pBytes++;
+        value |= u64(byte & 0x7F) << shift;
+        if((byte & 0x80) == 0) {
+            *pOut_Value = value;
+            return pBytes;
+        }
+    }
+    return nullptr;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Writes the bits count then kCodecBlockSize values of that many
+///   bits, little endian - 1 + 2 * bits bytes.
+inline u8*
+PackBlock(const u32 *pValues, u8 *pOut) noexcept
+{
+    u32 any = 0;
+    for(size_t i = 0; i < kCodecBlockSize; ++i) {
+        any |= pValues[i];
+    }
+
+    auto bits = u32(32 - Clz32(any));
+    *pOut++ = u8(bits);
+
+    u64 acc    = 0;
+    u32 filled = 0;
+    for(size_t i = 0; i < kCodecBlockSize; ++i) {
+        acc    |= u64(pValues[i]) << filled;
+        filled += bits;
+        if(filled >= 32) {
+            pOut[0] = u8(acc      ); pOut[1] = u8(acc >>  8);
+            pOut[2] = u8(acc >> 16); pOut[3] = u8(acc >> 24);
+            pOut   += 4;
+            acc   >>= 32;
+            filled -= 32;
+        }
+    }
+    // 16 * bits is always a whole number of 16 bits.
+    if(filled != 0) {
+        pOut[0] = u8(acc); pOut[1] = u8(acc >> 8);
+        pOut   += 2;
+    }
+    return pOut;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief nullptr when the block doesn't end before pEnd.
+inline const u8*
+UnpackBlock(const u8 *pBytes, const u8 *pEnd, u32 *pOut_Values) noexcept
+{
+    if(pBytes >= pEnd || *pBytes > 32) {
+        return nullptr;
+    }
+
+    auto bits = u32(*pBytes++);
+    if(size_t(pEnd - pBytes) < size_t(bits) * 2) {
+        return nullptr;
+    }
+
+    auto mask      = (u64(1) << bits) - 1;
+    auto remaining = size_t(bits) * 2;
+
+    u64 acc    = 0;
+    u32 filled = 0;
+    for(size_t i = 0; i < kCodecBlockSize; ++i) {
+        if(filled < bits) {
+            if(remaining >= 4) {
+                acc |= (u64(pBytes[0])       | u64(pBytes[1]) <<  8
+                     |  u64(pBytes[2]) << 16 | u64(pBytes[3]) << 24) << filled;
+                pBytes += 4; remaining -= 4; filled += 32;
+            } else {
+                acc |= (u64(pBytes[0]) | u64(pBytes[1]) << 8) << filled;
+                pBytes += 2; remaining -= 2; filled += 16;
+            }
+        }
+        pOut_Values[i] = u32(acc & mask);
+        acc   >>= bits;
+        filled -= bits;
+    }
+    return pBytes;
+}
+
+} // namespace detail
+
+
+//----------------------------------------------------------------------------//
+// Vec2StreamEncoder                                                          //
+//----------------------------------------------------------------------------//
+class Vec2StreamEncoder
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    explicit
+    Vec2StreamEncoder(const Vec2Quantizer &quantizer) noexcept
+        : m_quantizer  (quantizer)
+        , m_hasPrevious(false)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline const Vec2Quantizer& GetQuantizer() const noexcept { return m_quantizer; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the next frame a keyframe - e.g. for new receivers.
+    inline void Reset() noexcept { m_hasPrevious = false; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Appends the frame to pOut_Bytes.
+    /// @returns The bytes appended.
+    inline size_t
+    EncodeFrame(const Vec2 *pPoints, size_t count, std::vector<u8> *pOut_Bytes)
+    {
+        ACOW_MATH_TIME(Vec2Encode, count);
+
+        auto values_count = count * 2;
+        auto blocks_count = (values_count + detail::kCodecBlockSize - 1) / detail::kCodecBlockSize;
+        auto is_keyframe  = !m_hasPrevious || m_previous.size() != values_count;
+
+        // Padded with zeros up to whole blocks.
+        m_cells .resize(values_count);
+        m_values.assign(blocks_count * detail::kCodecBlockSize, 0);
+        m_quantizer.Quantize(pPoints, count, m_cells.data());
+
+        auto p_cells  = m_cells.data();
+        auto p_values = m_values.data();
+        if(is_keyframe) {
+            for(size_t i = 0; i < values_count; ++i) {
+                p_values[i] = detail::ZigZag(p_cells[i]);
+            }
+        } else {
+            auto p_previous = m_previous.data();
+            for(size_t i = 0; i < values_count; ++i) {
+                p_values[i] = detail::ZigZag(p_cells[i] - p_previous[i]);
+            }
+        }
+
+        // Worst case: varint, flags and full blocks.
+        auto start = pOut_Bytes->size();
+        pOut_Bytes->resize(start + 10 + 1 + blocks_count * (1 + detail::kCodecBlockSize * 4));
+
+        auto p_out = pOut_Bytes->data() + start;
+        p_out = detail::WriteVarint(u64(count), p_out);
+        *p_out++ = is_keyframe ? u8(detail::kCodecFlagKeyframe) : u8(0);
+        for(size_t i = 0; i < blocks_count; ++i) {
+            p_out = detail::PackBlock(p_values + i * detail::kCodecBlockSize, p_out);
+        }
+
+        auto written = size_t(p_out - (pOut_Bytes->data() + start));
+        pOut_Bytes->resize(start + written);
+
+        m_previous.swap(m_cells);
+        m_hasPrevious = true;
+        return written;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Vec2Quantizer    m_quantizer;
+    bool             m_hasPrevious;
+    std::vector<u32> m_previous;
+    std::vector<u32> m_cells;
+    std::vector<u32> m_values;
+
+}; // class Vec2StreamEncoder
+
+
+//----------------------------------------------------------------------------//
+// Vec2StreamDecoder                                                          //
+//----------------------------------------------------------------------------//
+class Vec2StreamDecoder
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief quantizer must be the same of the encoder.
+    explicit
+    Vec2StreamDecoder(const Vec2Quantizer &quantizer) noexcept
+        : m_quantizer  (quantizer)
+        , m_hasPrevious(false)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline const Vec2Quantizer& GetQuantizer() const noexcept { return m_quantizer; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Drops the previous frame - Only keyframes decode until the next
+    ///   one (e.g. after a lost packet).
+    inline void Reset() noexcept { m_hasPrevious = false; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Decodes the frame at the start of pBytes.
+    /// @returns The bytes read - 0 if the frame is truncated, malformed or a
+    ///   delta frame that doesn't match the previous one. The decoder and
+    ///   pOut_Points are left untouched then.
+    inline size_t
+    DecodeFrame(const u8 *pBytes, size_t size, std::vector<Vec2> *pOut_Points)
+    {
+        ACOW_MATH_TIME(Vec2Decode, size);
+
+        auto p_end = pBytes + size;
+
+        u64  count   = 0;
+        auto p_bytes = detail::ReadVarint(pBytes, p_end, &count);
+        if(!p_bytes || p_bytes >= p_end) {
+            return 0;
+        }
+
+        auto flags       = *p_bytes++;
+        auto is_keyframe = (flags & detail::kCodecFlagKeyframe) != 0;
+
+        // Each block is at least 1 byte - Refuse counts the data can't
+        // have before allocating anything for them.
+        auto remaining = u64(p_end - p_bytes);
+        if(count > remaining * (detail::kCodecBlockSize / 2)) {
+            return 0;
+        }
+
+        auto values_count = size_t(count) * 2;
+        auto blocks_count = (values_count + detail::kCodecBlockSize - 1) / detail::kCodecBlockSize;
+        if(!is_keyframe && (!m_hasPrevious || m_previous.size() != values_count)) {
+            return 0;
+        }
+
+        m_values.resize(blocks_count * detail::kCodecBlockSize);
+        for(size_t i = 0; i < blocks_count; ++i) {
+            p_bytes = detail::UnpackBlock(p_bytes, p_end, m_values.data() + i * detail::kCodecBlockSize);
+            if(!p_bytes) {
+                return 0;
+            }
+        }
+
+        m_cells.resize(values_count);
+        auto p_cells  = m_cells.data();
+        auto p_values = m_values.data();
+        if(is_keyframe) {
+            for(size_t i = 0; i < values_count; ++i) {
+                p_cells[i] = detail::UnZigZag(p_values[i]);
+            }
+        } else {
+            auto p_previous = m_previous.data();
+            for(size_t i = 0; i < values_count; ++i) {
+                p_cells[i] = p_previous[i] + detail::UnZigZag(p_values[i]);
+            }
+        }
+
+        pOut_Points->resize(size_t(count));
+        m_quantizer.Dequantize(p_cells, size_t(count), pOut_Points->data());
+
+        m_previous.swap(m_cells);
+        m_hasPrevious = true;
+        return size_t(p_bytes - pBytes);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Vec2Quantizer    m_quantizer;
+    bool             m_hasPrevious;
+    std::vector<u32> m_previous;
+    std::vector<u32> m_cells;
+    std::vector<u32> m_values;
+
+}; // class Vec2StreamDecoder
+
+} // namespace math
+} // namespace acow
@@ -3,11 +3,41 @@
 //----------------------------------------------------------------------------//
 // Export Headers                                                             //
 //----------------------------------------------------------------------------//
+#include "include/BatchOperations.h"
+#include "include/Bits.h"
+#include "include/Bounds.h"
 #include "include/Constants.h"
+#include "include/Culling.h"
+#include "include/DeterministicMath.h"
+#include "include/DistanceField.h"
+#include "include/Easing.h"
+#include "include/Instrumentation.h"
 #include "include/LibrarySupport.h"
+#include "include/Noise.h"
 #include "include/Operations.h"
+#include "include/Overlap.h"
+#include "include/ParallelOperations.h"
+#include "include/Random.h"
+#include "include/SDLInterop.h"
+#include "include/SIMD.h"
 
+#include "include/Affine2.h"
+#include "include/ArrayFile.h"
+#include "include/Camera2D.h"
+#include "include/ChunkedGrid.h"
+#include "include/Circle.h"
+#include "include/ConvexPolygon.h"
 #include "include/Coord.h"
+#include "include/Fixed.h"
+#include "include/FixedRect.h"
+#include "include/FixedVec2.h"
+#include "include/OBB.h"
+#include "include/ParticleStore.h"
 #include "include/Rect.h"
 #include "include/Size.h"
-#include "include/Vec2.h"
\ No newline at end of file
+#include "include/Spline.h"
+#include "include/ThreadPool.h"
+#include "include/TileCollisionMap.h"
+#include "include/TransformHierarchy.h"
+#include "include/Vec2.h"
+#include "include/Vec2Codec.h"
\ No newline at end of file
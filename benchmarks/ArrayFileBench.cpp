@@ -0,0 +1,135 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ArrayFileBench.cpp                                            //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ArrayFile.h loading against the text parse it replaces.                 //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+// What the levels had - One "x y w h" line for each collider.
+inline std::string
+MakeRectsText(const std::vector<Rect> &rects)
+{
+    std::string text;
+    char line[128];
+    for(const auto &r : rects) {
+        std::snprintf(line, sizeof(line), "%.3f %.3f %.3f %.3f\n", r.x, r.y, r.w, r.h);
+        text += line;
+    }
+    return text;
+}
+
+inline std::vector<u8>
+MakeRectsFile(const std::vector<Rect> &rects, ArrayLayout layout)
+{
+    ArrayFileWriter writer;
+    writer.AddRects("colliders", rects.data(), rects.size(), layout);
+    return writer.Build();
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Loading                                                                    //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(ArrayFile_Rects_ParseText, 1 << 16, 1 << 20)
+{
+    auto text = MakeRectsText(MakeRandomRects(state.GetSize()));
+    while(state.KeepRunning()) {
+        std::vector<Rect> rects;
+        auto p_text = text.c_str();
+        while(*p_text) {
+            char *p_end = nullptr;
+            Rect r;
+            r.x = std::strtof(p_text, &p_end); p_text = p_end;
+            r.y = std::strtof(p_text, &p_end); p_text = p_end;
+            r.w = std::strtof(p_text, &p_end); p_text = p_end;
+            r.h = std::strtof(p_text, &p_end); p_text = p_end + 1;
+            rects.push_back(r);
+        }
+        DoNotOptimize(rects.data());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ArrayFile_Rects_OpenMemory, 1 << 16, 1 << 20)
+{
+    auto file = MakeRectsFile(MakeRandomRects(state.GetSize()), ArrayLayout::AoS);
+    while(state.KeepRunning()) {
+        ArrayFileReader reader;
+        reader.OpenMemory(file.data(), file.size(), false);
+        auto rects = reader.GetRects("colliders");
+        DoNotOptimize(rects.pData);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ArrayFile_Rects_OpenMemoryChecksum, 1 << 16, 1 << 20)
+{
+    auto file = MakeRectsFile(MakeRandomRects(state.GetSize()), ArrayLayout::AoS);
+    while(state.KeepRunning()) {
+        ArrayFileReader reader;
+        reader.OpenMemory(file.data(), file.size(), true);
+        auto rects = reader.GetRects("colliders");
+        DoNotOptimize(rects.pData);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+// Map, validate and touch every collider - The cost of the first real use.
+ACOW_MATH_BENCHMARK_SIZES(ArrayFile_Rects_MapAndRead, 1 << 16, 1 << 20)
+{
+    const char *path = "acow_math_bench_rects.bin";
+
+    ArrayFileWriter writer;
+    auto rects = MakeRandomRects(state.GetSize());
+    writer.AddRects("colliders", rects.data(), rects.size(), ArrayLayout::SoA);
+    writer.WriteToFile(path);
+
+    while(state.KeepRunning()) {
+        ArrayFileReader reader;
+        reader.Open(path, false);
+
+        RectSoA soa = {};
+        reader.GetRectSoA("colliders", &soa);
+
+        auto sum = 0.0f;
+        for(size_t i = 0; i < soa.count; ++i) {
+            sum += soa.pX[i] + soa.pY[i] + soa.pW[i] + soa.pH[i];
+        }
+        DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.GetSize());
+
+    std::remove(path);
+}
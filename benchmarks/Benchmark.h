@@ -0,0 +1,266 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Benchmark.h                                                   //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Tiny self-contained benchmark harness, so the benchmarks don't need     //
+//    any dependency besides the library itself.                              //
+//                                                                            //
+//    Usage:                                                                  //
+//      ACOW_MATH_BENCHMARK_SIZES(MyThing, 1024, 1 << 20)                     //
+//      {                                                                     //
+//          auto data = MakeRandomFloats(state.GetSize());                    //
+//          while(state.KeepRunning()) {                                      //
+//              ...                                                           //
+//          }                                                                 //
+//          state.SetItemsProcessed(state.GetSize());                         //
+//      }                                                                     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+// std
+#include <chrono>
+#include <initializer_list>
+#include <random>
+#include <string>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+
+namespace acow { namespace math { namespace bench {
+
+//----------------------------------------------------------------------------//
+// State                                                                      //
+//----------------------------------------------------------------------------//
+class State
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    State(size_t size, u64 iterations) noexcept
+        : m_size           (size)
+        , m_iterations     (iterations)
+        , m_remaining      (iterations)
+        , m_itemsProcessed (0)
+        , m_started        (false)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Drives the timed loop - The clock starts on the first call,
+    ///   so any setup done before the loop isn't measured.
+    inline bool
+    KeepRunning() noexcept
+    {
+        if(!m_started) {
+            m_started = true;
+            m_start   = Clock::now();
+        }
+
+        if(m_remaining == 0) {
+            m_end = Clock::now();
+            return false;
+        }
+
+        --m_remaining;
+        return true;
+    }
+
+    inline size_t GetSize      () const noexcept { return m_size;       }
+    inline u64    GetIterations() const noexcept { return m_iterations; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Items processed by each iteration - Used for the throughput.
+    inline void SetItemsProcessed(u64 items) noexcept { m_itemsProcessed = items; }
+    inline u64  GetItemsProcessed() const    noexcept { return m_itemsProcessed;  }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Free text shown next to the results - e.g. output sizes.
+    inline void               SetLabel(const std::string &label) { m_label = label; }
+    inline const std::string& GetLabel() const noexcept          { return m_label;  }
+
+    inline double
+    GetElapsedSeconds() const noexcept
+    {
+        return std::chrono::duration<double>(m_end - m_start).count();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    size_t m_size;
+    u64    m_iterations;
+    u64    m_remaining;
+    u64    m_itemsProcessed;
+    bool   m_started;
+
+    std::string m_label;
+
+    Clock::time_point m_start;
+    Clock::time_point m_end;
+
+}; // class State
+
+
+//----------------------------------------------------------------------------//
+// Registry                                                                   //
+//----------------------------------------------------------------------------//
+typedef void (*BenchmarkFunc)(State &state);
+
+struct BenchmarkInfo
+{
+    std::string         name;
+    BenchmarkFunc       func;
+    std::vector<size_t> sizes;
+};
+
+inline std::vector<BenchmarkInfo>&
+GetRegistry()
+{
+    static std::vector<BenchmarkInfo> s_registry;
+    return s_registry;
+}
+
+struct Registrar
+{
+    Registrar(const char *name, BenchmarkFunc func, std::initializer_list<size_t> sizes)
+    {
+        GetRegistry().push_back({name, func, sizes});
+    }
+};
+
+#define ACOW_MATH_BENCHMARK_SIZES(_name_, ...)                           \
+    static void _name_(acow::math::bench::State &state);                 \
+    static acow::math::bench::Registrar s_##_name_##_registrar(          \
+        #_name_, &_name_, { __VA_ARGS__ }                                \
+    );                                                                   \
+    static void _name_(acow::math::bench::State &state)
+
+// Single size benchmark - For the primitives that don't scale with input.
+#define ACOW_MATH_BENCHMARK(_name_) ACOW_MATH_BENCHMARK_SIZES(_name_, 1)
+
+
+//----------------------------------------------------------------------------//
+// Optimization Barriers                                                      //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Makes the compiler believe that value is used.
+template <typename T>
+inline void
+DoNotOptimize(const T &value) noexcept
+{
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+    #else
+        static volatile const void *s_sink;
+        s_sink = &value;
+    #endif // defined(__GNUC__) || defined(__clang__)
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Makes the compiler believe that all memory was read and written.
+inline void
+ClobberMemory() noexcept
+{
+    #if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : : "memory");
+    #endif // defined(__GNUC__) || defined(__clang__)
+}
+
+
+//----------------------------------------------------------------------------//
+// Data Helpers                                                               //
+//   Fixed seeds so every run (and every machine) measures the same data.     //
+//----------------------------------------------------------------------------//
+inline std::vector<float>
+MakeRandomFloats(size_t count, float lo = -1000.0f, float hi = 1000.0f, u32 seed = 42)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> dist(lo, hi);
+
+    std::vector<float> v(count);
+    for(auto &f : v) {
+        f = dist(rng);
+    }
+    return v;
+}
+
+inline std::vector<i32>
+MakeRandomInts(size_t count, i32 lo = -100000, i32 hi = 100000, u32 seed = 42)
+{
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<i32> dist(lo, hi);
+
+    std::vector<i32> v(count);
+    for(auto &i : v) {
+        i = dist(rng);
+    }
+    return v;
+}
+
+inline std::vector<Vec2>
+MakeRandomVec2s(size_t count, float lo = -1000.0f, float hi = 1000.0f, u32 seed = 42)
+{
+    auto f = MakeRandomFloats(count * 2, lo, hi, seed);
+
+    std::vector<Vec2> v(count);
+    for(size_t i = 0; i < count; ++i) {
+        v[i] = Vec2(f[i * 2], f[i * 2 + 1]);
+    }
+    return v;
+}
+
+inline std::vector<Coord>
+MakeRandomCoords(size_t count, i32 lo = -100000, i32 hi = 100000, u32 seed = 42)
+{
+    auto n = MakeRandomInts(count * 2, lo, hi, seed);
+
+    std::vector<Coord> v(count);
+    for(size_t i = 0; i < count; ++i) {
+        v[i] = Coord(n[i * 2], n[i * 2 + 1]);
+    }
+    return v;
+}
+
+inline std::vector<Rect>
+MakeRandomRects(size_t count, float extent = 1000.0f, float maxSize = 64.0f, u32 seed = 42)
+{
+    auto pos  = MakeRandomFloats(count * 2, -extent, extent,  seed);
+    auto size = MakeRandomFloats(count * 2, 1.0f,    maxSize, seed + 1);
+
+    std::vector<Rect> v(count);
+    for(size_t i = 0; i < count; ++i) {
+        v[i] = Rect(pos[i * 2], pos[i * 2 + 1], size[i * 2], size[i * 2 + 1]);
+    }
+    return v;
+}
+
+} // namespace bench
+} // namespace math
+} // namespace acow
@@ -0,0 +1,107 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BitsBench.cpp                                                 //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Bits.h against the old ClosestPOT shift cascade and the portable        //
+//    fallbacks.                                                              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+// ClosestPOT as it was before Bits.h.
+inline u32
+CascadePOT(u32 value) noexcept
+{
+    value--;
+    value |= value >> 1;
+    value |= value >> 2;
+    value |= value >> 4;
+    value |= value >> 8;
+    value |= value >> 16;
+    value++;
+
+    return value;
+}
+
+inline std::vector<u64>
+MakeRandomU64s(size_t count)
+{
+    auto hi = MakeRandomInts(count, 0, 0x7FFFFFFF, 1);
+    auto lo = MakeRandomInts(count, 0, 0x7FFFFFFF, 2);
+
+    std::vector<u64> v(count);
+    for(size_t i = 0; i < count; ++i) {
+        // Random widths, so the leading zeros vary too.
+        v[i] = ((u64(hi[i]) << 32) | u64(lo[i])) >> (lo[i] & 63);
+    }
+    return v;
+}
+
+} // anonymous namespace
+
+#define BITS_BENCHMARK(_name_, _type_, _make_, _expr_)     \
+    ACOW_MATH_BENCHMARK_SIZES(_name_, SIZES)               \
+    {                                                      \
+        auto in  = _make_;                                 \
+        auto out = std::vector<_type_>(in.size());         \
+        while(state.KeepRunning()) {                       \
+            for(size_t i = 0; i < in.size(); ++i) {        \
+                auto v = _type_(in[i]);                    \
+                out[i] = _type_(_expr_);                   \
+            }                                              \
+            DoNotOptimize(out.data());                     \
+            ClobberMemory();                               \
+        }                                                  \
+        state.SetItemsProcessed(state.GetSize());          \
+    }
+
+#define U32_INPUT MakeRandomInts(state.GetSize(), 1, 1 << 30)
+#define U64_INPUT MakeRandomU64s(state.GetSize())
+
+
+//----------------------------------------------------------------------------//
+// Power of Two                                                               //
+//----------------------------------------------------------------------------//
+BITS_BENCHMARK(NextPOT_u32_Cascade, u32, U32_INPUT, CascadePOT(v))
+BITS_BENCHMARK(NextPOT_u32,         u32, U32_INPUT, NextPOT(v))
+BITS_BENCHMARK(NextPOT_u64,         u64, U64_INPUT, NextPOT(v))
+BITS_BENCHMARK(PrevPOT_u64,         u64, U64_INPUT, PrevPOT(v))
+BITS_BENCHMARK(AlignUp_u64,         u64, U64_INPUT, AlignUp(v, u64(64)))
+
+
+//----------------------------------------------------------------------------//
+// Counting                                                                   //
+//----------------------------------------------------------------------------//
+BITS_BENCHMARK(PopCount_u64,         u64, U64_INPUT, PopCount(v))
+BITS_BENCHMARK(PopCount_u64_Soft,    u64, U64_INPUT, detail::SoftPopCount64(v))
+BITS_BENCHMARK(Clz_u64,              u64, U64_INPUT, CountLeadingZeros(v))
+BITS_BENCHMARK(Clz_u64_Soft,         u64, U64_INPUT, detail::SoftClz64(v))
+BITS_BENCHMARK(Ctz_u64,              u64, U64_INPUT, CountTrailingZeros(v))
+BITS_BENCHMARK(Ctz_u64_Soft,         u64, U64_INPUT, detail::SoftCtz64(v))
+BITS_BENCHMARK(Log2Ceil_u32,         u32, U32_INPUT, Log2Ceil(v))
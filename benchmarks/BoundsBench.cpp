@@ -0,0 +1,115 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BoundsBench.cpp                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Bounds.h against the naive loops they replace.                          //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 16, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Rect                                                                       //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Bounds_Rect_Naive, SIZES)
+{
+    auto points = MakeRandomVec2s(state.GetSize());
+    while(state.KeepRunning()) {
+        auto min = points[0];
+        auto max = points[0];
+        for(const auto &p : points) {
+            min = Vec2(std::min(min.x, p.x), std::min(min.y, p.y));
+            max = Vec2(std::max(max.x, p.x), std::max(max.y, p.y));
+        }
+        DoNotOptimize(min);
+        DoNotOptimize(max);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Bounds_Rect, SIZES)
+{
+    auto points = MakeRandomVec2s(state.GetSize());
+    while(state.KeepRunning()) {
+        DoNotOptimize(ComputeBounds(points.data(), points.size()));
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Convex Hull                                                                //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Bounds_Hull, SIZES)
+{
+    auto points = MakeRandomVec2s(state.GetSize());
+    auto hull   = std::vector<Vec2>();
+    while(state.KeepRunning()) {
+        ComputeConvexHull(points.data(), points.size(), &hull);
+        DoNotOptimize(hull.data());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Bounds_HullParallel, SIZES)
+{
+    auto points = MakeRandomVec2s(state.GetSize());
+    auto hull   = std::vector<Vec2>();
+    while(state.KeepRunning()) {
+        ComputeConvexHullParallel(points.data(), points.size(), &hull);
+        DoNotOptimize(hull.data());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+// Points on a circle - Every point is on the hull, nothing gets filtered.
+ACOW_MATH_BENCHMARK_SIZES(Bounds_HullWorstCase, 1024, 1 << 16)
+{
+    auto angles = MakeRandomFloats(state.GetSize(), 0.0f, 360.0f);
+    auto points = std::vector<Vec2>();
+    for(auto a : angles) {
+        points.push_back(Vec2(100.0f, 0.0f).Rotated(a));
+    }
+
+    auto hull = std::vector<Vec2>();
+    while(state.KeepRunning()) {
+        ComputeConvexHull(points.data(), points.size(), &hull);
+        DoNotOptimize(hull.data());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Circle                                                                     //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Bounds_Circle, SIZES)
+{
+    auto points = MakeRandomVec2s(state.GetSize());
+    while(state.KeepRunning()) {
+        DoNotOptimize(ComputeBoundingCircle(points.data(), points.size()));
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
@@ -0,0 +1,153 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ChunkedGridBench.cpp                                          //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ChunkedGrid.h against a hash map per cell.                              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <unordered_map>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 16, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+struct CoordHash
+{
+    size_t operator()(const Coord &c) const noexcept
+    {
+        return std::hash<u64>()((u64(u32(c.y)) << 32) | u32(c.x));
+    }
+};
+
+// Random walk - What gameplay code usually looks like.
+std::vector<Coord>
+MakeCoherentCoords(size_t count)
+{
+    auto steps  = MakeRandomInts(count, 0, 3);
+    auto result = std::vector<Coord>(count);
+    auto curr   = Coord();
+
+    const Coord dirs[] = { Coord::Up(), Coord::Down(), Coord::Left(), Coord::Right() };
+    for(size_t i = 0; i < count; ++i) {
+        curr += dirs[steps[i]];
+        result[i] = curr;
+    }
+    return result;
+}
+
+} // anonymous namespace
+
+
+//----------------------------------------------------------------------------//
+// Writes                                                                     //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(ChunkedGrid_SetRandom, SIZES)
+{
+    auto coords = MakeRandomCoords(state.GetSize(), -4096, 4096);
+
+    while(state.KeepRunning()) {
+        ChunkedGrid<i32> grid;
+        for(size_t i = 0; i < coords.size(); ++i) {
+            grid.Set(coords[i], i32(i));
+        }
+        DoNotOptimize(grid.GetChunkCount());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(HashMap_SetRandom, SIZES)
+{
+    auto coords = MakeRandomCoords(state.GetSize(), -4096, 4096);
+
+    while(state.KeepRunning()) {
+        std::unordered_map<Coord, i32, CoordHash> map;
+        for(size_t i = 0; i < coords.size(); ++i) {
+            map[coords[i]] = i32(i);
+        }
+        DoNotOptimize(map.size());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Reads                                                                      //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(ChunkedGrid_GetCoherent, SIZES)
+{
+    auto coords = MakeCoherentCoords(state.GetSize());
+
+    ChunkedGrid<i32> grid;
+    for(size_t i = 0; i < coords.size(); ++i) {
+        grid.Set(coords[i], i32(i));
+    }
+
+    while(state.KeepRunning()) {
+        i64 acc = 0;
+        for(const auto &c : coords) {
+            acc += grid.Get(c);
+        }
+        DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(HashMap_GetCoherent, SIZES)
+{
+    auto coords = MakeCoherentCoords(state.GetSize());
+
+    std::unordered_map<Coord, i32, CoordHash> map;
+    for(size_t i = 0; i < coords.size(); ++i) {
+        map[coords[i]] = i32(i);
+    }
+
+    while(state.KeepRunning()) {
+        i64 acc = 0;
+        for(const auto &c : coords) {
+            acc += map.find(c)->second;
+        }
+        DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ChunkedGrid_ForEachCell, SIZES)
+{
+    auto coords = MakeRandomCoords(state.GetSize(), -1024, 1024);
+
+    ChunkedGrid<i32> grid;
+    for(size_t i = 0; i < coords.size(); ++i) {
+        grid.Set(coords[i], 1);
+    }
+
+    while(state.KeepRunning()) {
+        i64 acc = 0;
+        grid.ForEachCell([&acc](const Coord &, i32 &v) { acc += v; });
+        DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(grid.GetChunkCount() * ChunkedGrid<i32>::kChunkArea);
+}
@@ -0,0 +1,127 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ConvexPolygonBench.cpp                                        //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    SAT tests, and the SoA batch against the same rects one by one.         //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 16
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+inline std::vector<ConvexPolygon>
+MakeRandomBoxes(size_t count, u32 seed)
+{
+    auto pos   = MakeRandomFloats(count * 2, -200.0f, 200.0f, seed);
+    auto sizes = MakeRandomFloats(count * 2,    1.0f,  16.0f, seed + 1);
+    auto angle = MakeRandomFloats(count,        0.0f, 360.0f, seed + 2);
+
+    std::vector<ConvexPolygon> v(count);
+    for(size_t i = 0; i < count; ++i) {
+        v[i] = ConvexPolygon::MakeBox(
+            Vec2(pos  [i * 2], pos  [i * 2 + 1]),
+            Vec2(sizes[i * 2], sizes[i * 2 + 1]),
+            angle[i]
+        );
+    }
+    return v;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Pairs                                                                      //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(ConvexPolygon_CollidePolygon, SIZES)
+{
+    auto a = MakeRandomBoxes(state.GetSize(), 1);
+    auto b = MakeRandomBoxes(state.GetSize(), 7);
+    while(state.KeepRunning()) {
+        size_t hits = 0;
+        for(size_t i = 0; i < a.size(); ++i) {
+            auto mtv = Vec2::Zero();
+            hits += Collide(a[i], b[i], &mtv);
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ConvexPolygon_CollideCircle, SIZES)
+{
+    auto a       = MakeRandomBoxes(state.GetSize(), 1);
+    auto centers = MakeRandomVec2s(state.GetSize(), -200.0f, 200.0f, 3);
+    while(state.KeepRunning()) {
+        size_t hits = 0;
+        for(size_t i = 0; i < a.size(); ++i) {
+            auto mtv = Vec2::Zero();
+            hits += Collide(a[i], centers[i], 8.0f, &mtv);
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// One Polygon vs Many Rects                                                  //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(ConvexPolygon_Rects_OneByOne, SIZES)
+{
+    auto poly  = ConvexPolygon::MakeBox(Vec2::Zero(), Vec2(80.0f, 20.0f), 30.0f);
+    auto rects = MakeRandomRects(state.GetSize(), 200.0f, 16.0f);
+    auto hits  = std::vector<u8>(rects.size());
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < rects.size(); ++i) {
+            hits[i] = u8(Collide(poly, rects[i]));
+        }
+        DoNotOptimize(hits.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ConvexPolygon_Rects_SoA, SIZES)
+{
+    auto poly  = ConvexPolygon::MakeBox(Vec2::Zero(), Vec2(80.0f, 20.0f), 30.0f);
+    auto rects = MakeRandomRects(state.GetSize(), 200.0f, 16.0f);
+    auto hits  = std::vector<u8>(rects.size());
+
+    std::vector<float> xs(rects.size()), ys(rects.size()), ws(rects.size()), hs(rects.size());
+    for(size_t i = 0; i < rects.size(); ++i) {
+        xs[i] = rects[i].x; ys[i] = rects[i].y;
+        ws[i] = rects[i].w; hs[i] = rects[i].h;
+    }
+    auto soa = RectSoA{xs.data(), ys.data(), ws.data(), hs.data(), rects.size()};
+
+    while(state.KeepRunning()) {
+        DoNotOptimize(Collide(poly, soa, hits.data()));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
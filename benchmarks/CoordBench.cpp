@@ -0,0 +1,128 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : CoordBench.cpp                                                //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Coord.h primitives.                                                     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+#define COORD_MAP_BENCHMARK(_name_, _expr_)                   \
+    ACOW_MATH_BENCHMARK_SIZES(_name_, SIZES)                  \
+    {                                                         \
+        auto in  = MakeRandomCoords(state.GetSize(), -100000, 100000, 1); \
+        auto out = std::vector<Coord>(in.size());             \
+        while(state.KeepRunning()) {                          \
+            for(size_t i = 0; i < in.size(); ++i) {           \
+                const auto &v = in[i];                        \
+                out[i] = (_expr_);                            \
+            }                                                 \
+            DoNotOptimize(out.data());                        \
+            ClobberMemory();                                  \
+        }                                                     \
+        state.SetItemsProcessed(state.GetSize());             \
+    }
+
+#define COORD_BINARY_BENCHMARK(_name_, _expr_)                \
+    ACOW_MATH_BENCHMARK_SIZES(_name_, SIZES)                  \
+    {                                                         \
+        auto a   = MakeRandomCoords(state.GetSize(), -100000, 100000, 1); \
+        auto b   = MakeRandomCoords(state.GetSize(), -100000, 100000, 2); \
+        auto out = std::vector<Coord>(a.size());              \
+        while(state.KeepRunning()) {                          \
+            for(size_t i = 0; i < a.size(); ++i) {            \
+                const auto &lhs = a[i];                       \
+                const auto &rhs = b[i];                       \
+                out[i] = (_expr_);                            \
+            }                                                 \
+            DoNotOptimize(out.data());                        \
+            ClobberMemory();                                  \
+        }                                                     \
+        state.SetItemsProcessed(state.GetSize());             \
+    }
+
+
+//----------------------------------------------------------------------------//
+// Operators                                                                  //
+//----------------------------------------------------------------------------//
+COORD_BINARY_BENCHMARK(Coord_OperatorAdd,    lhs + rhs)
+COORD_BINARY_BENCHMARK(Coord_OperatorSub,    lhs - rhs)
+COORD_MAP_BENCHMARK   (Coord_OperatorScalar, v * 3)
+
+ACOW_MATH_BENCHMARK_SIZES(Coord_OperatorEqual, SIZES)
+{
+    auto a = MakeRandomCoords(state.GetSize(), -4, 4, 1);
+    auto b = MakeRandomCoords(state.GetSize(), -4, 4, 2);
+
+    while(state.KeepRunning()) {
+        u32 count = 0;
+        for(size_t i = 0; i < a.size(); ++i) {
+            count += (a[i] == b[i]);
+        }
+        DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Neighbours                                                                 //
+//----------------------------------------------------------------------------//
+COORD_BINARY_BENCHMARK(Coord_GetMiddle, lhs.GetMiddle(rhs))
+COORD_BINARY_BENCHMARK(Coord_GetUnit,   (lhs - rhs).GetUnit())
+
+ACOW_MATH_BENCHMARK_SIZES(Coord_GetOrthogonal, SIZES)
+{
+    auto in = MakeRandomCoords(state.GetSize());
+
+    while(state.KeepRunning()) {
+        i32 acc = 0;
+        for(const auto &c : in) {
+            for(const auto &n : c.GetOrthogonal()) {
+                acc += n.x;
+            }
+        }
+        DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Coord_GetSurrounding, SIZES)
+{
+    auto in = MakeRandomCoords(state.GetSize());
+
+    while(state.KeepRunning()) {
+        i32 acc = 0;
+        for(const auto &c : in) {
+            for(const auto &n : c.GetSurrounding()) {
+                acc += n.x;
+            }
+        }
+        DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
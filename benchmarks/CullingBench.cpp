@@ -0,0 +1,124 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : CullingBench.cpp                                              //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Culling.h against testing every sprite Rect and converting it alone.    //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+// Same layout as SDL_Rect, without needing SDL.
+struct ScreenRect { i32 x, y, w, h; };
+
+// Sprites over a 20k x 20k world, the camera sees about 1% of them.
+struct Scene
+{
+    std::vector<float> x, y, w, h;
+    RectSoA            soa;
+    Camera2D           camera;
+
+    explicit
+    Scene(size_t count)
+        : x(MakeRandomFloats(count, -10000.0f, 10000.0f, 1))
+        , y(MakeRandomFloats(count, -10000.0f, 10000.0f, 2))
+        , w(MakeRandomFloats(count, 8.0f, 64.0f, 3))
+        , h(MakeRandomFloats(count, 8.0f, 64.0f, 4))
+        , soa{ x.data(), y.data(), w.data(), h.data(), count }
+        , camera(Rect(-1000.0f, -1000.0f, 1920.0f, 1080.0f), 1.0f)
+    {
+        // Empty...
+    }
+
+    Scene(const Scene &) = delete;
+};
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Cull                                                                       //
+//----------------------------------------------------------------------------//
+// What the renderer did - Rect by rect, then its own conversion.
+ACOW_MATH_BENCHMARK_SIZES(Culling_PerRect, 1 << 14, 1 << 18)
+{
+    Scene scene(state.GetSize());
+    auto  rects   = std::vector<Rect>(state.GetSize());
+    auto  visible = scene.camera.GetVisibleRect();
+    for(size_t i = 0; i < rects.size(); ++i) {
+        rects[i] = Rect(scene.x[i], scene.y[i], scene.w[i], scene.h[i]);
+    }
+
+    auto out = std::vector<ScreenRect>(rects.size());
+    while(state.KeepRunning()) {
+        size_t n = 0;
+        for(const auto &rect : rects) {
+            if(rect.Intersects(visible)) {
+                auto screen = scene.camera.WorldToScreen(rect);
+                out[n++] = ScreenRect{ i32(screen.x), i32(screen.y), i32(screen.w), i32(screen.h) };
+            }
+        }
+        DoNotOptimize(n);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Culling_SoA, 1 << 14, 1 << 18)
+{
+    Scene scene(state.GetSize());
+    auto  visible = scene.camera.GetVisibleRect();
+    auto  indices = std::vector<u32>(state.GetSize());
+    auto  out     = std::vector<ScreenRect>(state.GetSize());
+    while(state.KeepRunning()) {
+        auto n = Cull(visible, scene.soa, indices.data());
+        ToScreenRects(scene.camera, scene.soa, indices.data(), n, out.data());
+        DoNotOptimize(n);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Culling_StaticIndex, 1 << 14, 1 << 18)
+{
+    Scene scene(state.GetSize());
+    auto  visible = scene.camera.GetVisibleRect();
+    auto  indices = std::vector<u32>();
+    auto  out     = std::vector<ScreenRect>(state.GetSize());
+
+    StaticCullIndex index;
+    index.Build(scene.soa, 512.0f);
+    while(state.KeepRunning()) {
+        indices.clear();
+        auto n = index.Query(visible, &indices);
+        ToScreenRects(scene.camera, scene.soa, indices.data(), n, out.data());
+        DoNotOptimize(n);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
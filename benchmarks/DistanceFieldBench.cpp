@@ -0,0 +1,113 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : DistanceFieldBench.cpp                                        //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Distance fields of square grids - The size is the side, so 4096 is      //
+//    the 4k x 4k case.                                                       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+// About 1% of obstacle cells, scattered.
+inline std::vector<u8>
+MakeObstacles(size_t side)
+{
+    auto cells = MakeRandomInts(side * side, 0, 99, 7);
+
+    std::vector<u8> mask(side * side);
+    for(size_t i = 0; i < mask.size(); ++i) {
+        mask[i] = (cells[i] == 0) ? 1 : 0;
+    }
+    return mask;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Exact                                                                      //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(DistanceField_Exact_1Thread, 1024, 4096)
+{
+    auto side = state.GetSize();
+    auto mask = MakeObstacles(side);
+    auto out  = std::vector<float>(side * side);
+
+    ThreadPool pool(0);
+    while(state.KeepRunning()) {
+        ComputeDistanceField(mask.data(), i32(side), i32(side), out.data(), pool);
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(side * side);
+}
+
+ACOW_MATH_BENCHMARK_SIZES(DistanceField_Exact_Pool, 1024, 4096)
+{
+    auto side = state.GetSize();
+    auto mask = MakeObstacles(side);
+    auto out  = std::vector<float>(side * side);
+
+    while(state.KeepRunning()) {
+        ComputeDistanceField(mask.data(), i32(side), i32(side), out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(side * side);
+}
+
+ACOW_MATH_BENCHMARK_SIZES(DistanceField_Signed_Pool, 1024, 4096)
+{
+    auto side = state.GetSize();
+    auto mask = MakeObstacles(side);
+    auto out  = std::vector<float>(side * side);
+
+    while(state.KeepRunning()) {
+        ComputeSignedDistanceField(mask.data(), i32(side), i32(side), out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(side * side);
+}
+
+
+//----------------------------------------------------------------------------//
+// Chamfer                                                                    //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(DistanceField_Chamfer3_4, 1024, 4096)
+{
+    auto side = state.GetSize();
+    auto mask = MakeObstacles(side);
+    auto out  = std::vector<float>(side * side);
+
+    while(state.KeepRunning()) {
+        ComputeChamferDistanceField(mask.data(), i32(side), i32(side), ChamferMetric::Chamfer3_4, out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(side * side);
+}
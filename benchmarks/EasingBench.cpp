@@ -0,0 +1,99 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : EasingBench.cpp                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Easing.h exact evaluation vs baked tables.                              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 16
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+#define EASING_BENCHMARKS(_type_)                                          \
+    ACOW_MATH_BENCHMARK_SIZES(Easing_##_type_##_Exact, SIZES)              \
+    {                                                                      \
+        auto t   = MakeRandomFloats(state.GetSize(), 0.0f, 1.0f);          \
+        auto out = std::vector<float>(t.size());                           \
+        while(state.KeepRunning()) {                                       \
+            for(size_t i = 0; i < t.size(); ++i) {                         \
+                out[i] = Ease##_type_(t[i]);                               \
+            }                                                              \
+            DoNotOptimize(out.data());                                     \
+            ClobberMemory();                                               \
+        }                                                                  \
+        state.SetItemsProcessed(state.GetSize());                          \
+    }                                                                      \
+    ACOW_MATH_BENCHMARK_SIZES(Easing_##_type_##_Table, SIZES)              \
+    {                                                                      \
+        auto t     = MakeRandomFloats(state.GetSize(), 0.0f, 1.0f);        \
+        auto out   = std::vector<float>(t.size());                         \
+        auto table = EasingTable(EasingType::_type_);                      \
+        while(state.KeepRunning()) {                                       \
+            table.Evaluate(t.data(), t.size(), out.data());                \
+            DoNotOptimize(out.data());                                     \
+            ClobberMemory();                                               \
+        }                                                                  \
+        state.SetItemsProcessed(state.GetSize());                          \
+    }
+
+
+//----------------------------------------------------------------------------//
+// Curves                                                                     //
+//----------------------------------------------------------------------------//
+EASING_BENCHMARKS(QuadInOut)
+EASING_BENCHMARKS(CubicInOut)
+EASING_BENCHMARKS(ExpoInOut)
+EASING_BENCHMARKS(ElasticOut)
+EASING_BENCHMARKS(BounceOut)
+
+ACOW_MATH_BENCHMARK_SIZES(Easing_CubicBezier_Exact, SIZES)
+{
+    auto t     = MakeRandomFloats(state.GetSize(), 0.0f, 1.0f);
+    auto out   = std::vector<float>(t.size());
+    auto curve = CubicBezierEasing::EaseInOut();
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < t.size(); ++i) {
+            out[i] = curve(t[i]);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Easing_CubicBezier_Table, SIZES)
+{
+    auto t     = MakeRandomFloats(state.GetSize(), 0.0f, 1.0f);
+    auto out   = std::vector<float>(t.size());
+    auto table = EasingTable(CubicBezierEasing::EaseInOut());
+
+    while(state.KeepRunning()) {
+        table.Evaluate(t.data(), t.size(), out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
@@ -0,0 +1,112 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : FixedBench.cpp                                                //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Fixed point FixedVec2 against float Vec2.                               //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+template <typename TVec>
+std::vector<TVec>
+MakeFixedVec2s(size_t count, u32 seed = 42)
+{
+    auto src = MakeRandomVec2s(count, -100.0f, 100.0f, seed);
+
+    std::vector<TVec> v(count);
+    for(size_t i = 0; i < count; ++i) {
+        v[i] = TVec::FromVec2(src[i]);
+    }
+    return v;
+}
+
+} // anonymous namespace
+
+#define VEC_BENCHMARKS(_suffix_, _vec_, _make_, _angle_)                     \
+    ACOW_MATH_BENCHMARK_SIZES(Magnitude_##_suffix_, SIZES)                   \
+    {                                                                        \
+        auto in  = _make_;                                                   \
+        auto out = std::vector<decltype(in[0].Magnitude())>(in.size());      \
+        while(state.KeepRunning()) {                                         \
+            for(size_t i = 0; i < in.size(); ++i) {                          \
+                out[i] = in[i].Magnitude();                                  \
+            }                                                                \
+            DoNotOptimize(out.data());                                       \
+            ClobberMemory();                                                 \
+        }                                                                    \
+        state.SetItemsProcessed(state.GetSize());                            \
+    }                                                                        \
+    ACOW_MATH_BENCHMARK_SIZES(Normalized_##_suffix_, SIZES)                  \
+    {                                                                        \
+        auto in  = _make_;                                                   \
+        auto out = std::vector<_vec_>(in.size());                            \
+        while(state.KeepRunning()) {                                         \
+            for(size_t i = 0; i < in.size(); ++i) {                          \
+                out[i] = in[i].Normalized();                                 \
+            }                                                                \
+            DoNotOptimize(out.data());                                       \
+            ClobberMemory();                                                 \
+        }                                                                    \
+        state.SetItemsProcessed(state.GetSize());                            \
+    }                                                                        \
+    ACOW_MATH_BENCHMARK_SIZES(Rotated_##_suffix_, SIZES)                     \
+    {                                                                        \
+        auto in    = _make_;                                                 \
+        auto out   = std::vector<_vec_>(in.size());                          \
+        auto angle = _angle_;                                                \
+        while(state.KeepRunning()) {                                         \
+            for(size_t i = 0; i < in.size(); ++i) {                          \
+                out[i] = in[i].Rotated(angle);                               \
+            }                                                                \
+            DoNotOptimize(out.data());                                       \
+            ClobberMemory();                                                 \
+        }                                                                    \
+        state.SetItemsProcessed(state.GetSize());                            \
+    }                                                                        \
+    ACOW_MATH_BENCHMARK_SIZES(MulAdd_##_suffix_, SIZES)                      \
+    {                                                                        \
+        auto a = _make_;                                                     \
+        auto b = _make_;                                                     \
+        while(state.KeepRunning()) {                                         \
+            for(size_t i = 0; i < a.size(); ++i) {                           \
+                a[i] += b[i] * a[i].x;                                       \
+            }                                                                \
+            DoNotOptimize(a.data());                                         \
+            ClobberMemory();                                                 \
+        }                                                                    \
+        state.SetItemsProcessed(state.GetSize());                            \
+    }
+
+
+//----------------------------------------------------------------------------//
+// Benchmarks                                                                 //
+//----------------------------------------------------------------------------//
+VEC_BENCHMARKS(Vec2_Float,   Vec2,         MakeRandomVec2s(state.GetSize(), -100.0f, 100.0f), 33.3f)
+VEC_BENCHMARKS(FixedVec2,    FixedVec2,    MakeFixedVec2s<FixedVec2>   (state.GetSize()), Fixed16_16::FromFloat(33.3))
+VEC_BENCHMARKS(FixedVec2_64, FixedVec2_64, MakeFixedVec2s<FixedVec2_64>(state.GetSize()), Fixed32_32::FromFloat(33.3))
@@ -0,0 +1,151 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : NoiseBench.cpp                                                //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Noise2D tiles against a per cell scalar Perlin (the textbook 2D version //
+//    of Ken Perlin's improved noise, with the permutation table).            //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define TILE_SIZES 64, 256, 1024
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+class TablePerlin
+{
+public:
+    explicit TablePerlin(u32 seed)
+    {
+        auto rng = Pcg32(seed);
+        for(i32 i = 0; i < 256; ++i) {
+            m_perm[i] = u8(i);
+        }
+        for(i32 i = 255; i > 0; --i) {
+            auto j = rng.NextInRange(u32(i + 1));
+            auto t = m_perm[i]; m_perm[i] = m_perm[j]; m_perm[j] = t;
+        }
+        for(i32 i = 0; i < 256; ++i) {
+            m_perm[256 + i] = m_perm[i];
+        }
+    }
+
+    float
+    Sample(float x, float y) const
+    {
+        auto fx = std::floor(x);
+        auto fy = std::floor(y);
+        auto X  = i32(fx) & 255;
+        auto Y  = i32(fy) & 255;
+        x -= fx;
+        y -= fy;
+
+        auto u = Fade(x);
+        auto v = Fade(y);
+        auto a = m_perm[X    ] + Y;
+        auto b = m_perm[X + 1] + Y;
+
+        return Lerp(
+            Lerp(Grad(m_perm[a    ], x, y       ), Grad(m_perm[b    ], x - 1, y       ), u),
+            Lerp(Grad(m_perm[a + 1], x, y - 1.0f), Grad(m_perm[b + 1], x - 1, y - 1.0f), u),
+            v
+        );
+    }
+
+private:
+    static float Fade(float t) { return t * t * t * (t * (t * 6 - 15) + 10); }
+    static float Lerp(float a, float b, float t) { return a + t * (b - a); }
+
+    static float
+    Grad(i32 hash, float x, float y)
+    {
+        auto h = hash & 7;
+        auto u = (h < 4) ? x : y;
+        auto v = (h < 4) ? y : x;
+        return ((h & 1) ? -u : u) + ((h & 2) ? -2.0f * v : 2.0f * v);
+    }
+
+    u8 m_perm[512];
+};
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Tiles - Size is the side of the tile.                                      //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Noise_Tile_TablePerlin_PerCell, TILE_SIZES)
+{
+    auto side  = state.GetSize();
+    auto noise = TablePerlin(42);
+    auto out   = std::vector<float>(side * side);
+    while(state.KeepRunning()) {
+        for(size_t r = 0; r < side; ++r) {
+            for(size_t c = 0; c < side; ++c) {
+                out[r * side + c] = noise.Sample(float(c) * 0.05f, float(r) * 0.05f);
+            }
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(side * side);
+}
+
+#define NOISE_TILE_BENCHMARK(_name_, _type_, _octaves_)                             \
+    ACOW_MATH_BENCHMARK_SIZES(_name_, TILE_SIZES)                                   \
+    {                                                                               \
+        auto side  = state.GetSize();                                               \
+        auto noise = Noise2D(42, _type_);                                           \
+        auto out   = std::vector<float>(side * side);                               \
+        auto fbm   = FractalSettings{_octaves_, 2.0f, 0.5f};                        \
+        while(state.KeepRunning()) {                                                \
+            noise.SampleTile(Coord(0, 0), i32(side), i32(side), side, 0.05f, fbm, out.data()); \
+            DoNotOptimize(out.data());                                              \
+            ClobberMemory();                                                        \
+        }                                                                           \
+        state.SetItemsProcessed(side * side);                                       \
+    }
+
+NOISE_TILE_BENCHMARK(Noise_Tile_Value,      NoiseType::Value,   1)
+NOISE_TILE_BENCHMARK(Noise_Tile_Perlin,     NoiseType::Perlin,  1)
+NOISE_TILE_BENCHMARK(Noise_Tile_Simplex,    NoiseType::Simplex, 1)
+NOISE_TILE_BENCHMARK(Noise_Tile_SimplexFbm, NoiseType::Simplex, 5)
+
+
+//----------------------------------------------------------------------------//
+// Single Sample                                                              //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK(Noise_Single_Simplex)
+{
+    auto noise = Noise2D(42);
+    auto x     = 0.0f;
+    while(state.KeepRunning()) {
+        DoNotOptimize(noise.Sample(x, 0.5f));
+        x += 0.01f;
+    }
+    state.SetItemsProcessed(1);
+}
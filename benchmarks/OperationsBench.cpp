@@ -0,0 +1,457 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : OperationsBench.cpp                                           //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Operations.h and BatchOperations.h.                                     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+#include <cmath>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 16, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Clamp                                                                      //
+//   Branchy Clamp vs the std::min / std::max composition.                    //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Clamp_Float_Branchy, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = Clamp(in[i], -500.0f, 500.0f);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Clamp_Float_StdMinMax, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = std::min(std::max(in[i], -500.0f), 500.0f);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Clamp_Float_Batch, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        Clamp(in.data(), in.size(), -500.0f, 500.0f, out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Clamp_Int_Branchy, SIZES)
+{
+    auto in  = MakeRandomInts(state.GetSize());
+    auto out = std::vector<i32>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = Clamp(in[i], -50000, 50000);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Clamp_Int_StdMinMax, SIZES)
+{
+    auto in  = MakeRandomInts(state.GetSize());
+    auto out = std::vector<i32>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = std::min(std::max(in[i], -50000), 50000);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Clamp_Int_BithackMinMax, SIZES)
+{
+    auto in  = MakeRandomInts(state.GetSize());
+    auto out = std::vector<i32>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = Min(Max(int(in[i]), -50000), 50000);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Min / Max                                                                  //
+//   seander's bithacks vs std::min / std::max.                               //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(MinMax_Int_Bithack, SIZES)
+{
+    auto a   = MakeRandomInts(state.GetSize(), -100000, 100000, 1);
+    auto b   = MakeRandomInts(state.GetSize(), -100000, 100000, 2);
+    auto out = std::vector<i32>(a.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < a.size(); ++i) {
+            out[i] = Min(int(a[i]), int(b[i])) + Max(int(a[i]), int(b[i]));
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(MinMax_Int_Std, SIZES)
+{
+    auto a   = MakeRandomInts(state.GetSize(), -100000, 100000, 1);
+    auto b   = MakeRandomInts(state.GetSize(), -100000, 100000, 2);
+    auto out = std::vector<i32>(a.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < a.size(); ++i) {
+            out[i] = std::min(a[i], b[i]) + std::max(a[i], b[i]);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(MinMax_UInt_Bithack, SIZES)
+{
+    auto a   = MakeRandomInts(state.GetSize(), 0, 100000, 1);
+    auto b   = MakeRandomInts(state.GetSize(), 0, 100000, 2);
+    auto out = std::vector<u32>(a.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < a.size(); ++i) {
+            auto x = (unsigned int)a[i];
+            auto y = (unsigned int)b[i];
+            out[i] = Min(x, y) + Max(x, y);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(MinMax_UInt_Std, SIZES)
+{
+    auto a   = MakeRandomInts(state.GetSize(), 0, 100000, 1);
+    auto b   = MakeRandomInts(state.GetSize(), 0, 100000, 2);
+    auto out = std::vector<u32>(a.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < a.size(); ++i) {
+            auto x = (unsigned int)a[i];
+            auto y = (unsigned int)b[i];
+            out[i] = std::min(x, y) + std::max(x, y);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Lerp / InverseLerp / Remap                                                 //
+//   Scalar loop vs the batch kernels.                                        //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Lerp_Float_ScalarLoop, SIZES)
+{
+    auto s   = MakeRandomFloats(state.GetSize(), -1000.0f, 1000.0f, 1);
+    auto e   = MakeRandomFloats(state.GetSize(), -1000.0f, 1000.0f, 2);
+    auto t   = MakeRandomFloats(state.GetSize(),     0.0f,    1.0f, 3);
+    auto out = std::vector<float>(s.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < s.size(); ++i) {
+            out[i] = Lerp(s[i], e[i], t[i]);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Lerp_Float_Batch, SIZES)
+{
+    auto s   = MakeRandomFloats(state.GetSize(), -1000.0f, 1000.0f, 1);
+    auto e   = MakeRandomFloats(state.GetSize(), -1000.0f, 1000.0f, 2);
+    auto t   = MakeRandomFloats(state.GetSize(),     0.0f,    1.0f, 3);
+    auto out = std::vector<float>(s.size());
+
+    while(state.KeepRunning()) {
+        Lerp(s.data(), e.data(), t.data(), s.size(), out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Lerp_Vec2_ScalarLoop, SIZES)
+{
+    auto s   = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 1);
+    auto e   = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 2);
+    auto out = std::vector<Vec2>(s.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < s.size(); ++i) {
+            out[i] = Lerp(s[i], e[i], 0.25f);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Lerp_Vec2_Batch, SIZES)
+{
+    auto s   = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 1);
+    auto e   = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 2);
+    auto out = std::vector<Vec2>(s.size());
+
+    while(state.KeepRunning()) {
+        Lerp(s.data(), e.data(), s.size(), 0.25f, out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Lerp_Rect_ScalarLoop, SIZES)
+{
+    auto s   = MakeRandomRects(state.GetSize(), 1000.0f, 64.0f, 1);
+    auto e   = MakeRandomRects(state.GetSize(), 1000.0f, 64.0f, 2);
+    auto out = std::vector<Rect>(s.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < s.size(); ++i) {
+            out[i] = Lerp(s[i], e[i], 0.25f);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Lerp_Rect_Batch, SIZES)
+{
+    auto s   = MakeRandomRects(state.GetSize(), 1000.0f, 64.0f, 1);
+    auto e   = MakeRandomRects(state.GetSize(), 1000.0f, 64.0f, 2);
+    auto out = std::vector<Rect>(s.size());
+
+    while(state.KeepRunning()) {
+        Lerp(s.data(), e.data(), s.size(), 0.25f, out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(InverseLerp_ScalarLoop, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = InverseLerp(-1000.0f, 1000.0f, in[i]);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(InverseLerp_Batch, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        InverseLerp(in.data(), in.size(), -1000.0f, 1000.0f, out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Remap_ScalarLoop, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = Remap(in[i], -1000.0f, 1000.0f, 0.0f, 255.0f);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Remap_Batch, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        Remap(in.data(), in.size(), -1000.0f, 1000.0f, 0.0f, 255.0f, out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ClampToRect_Vec2_Batch, SIZES)
+{
+    auto in  = MakeRandomVec2s(state.GetSize());
+    auto out = std::vector<Vec2>(in.size());
+
+    while(state.KeepRunning()) {
+        Clamp(in.data(), in.size(), Rect(-500, -500, 1000, 1000), out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Angles                                                                     //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(WrapRadians_Fmod, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    // What the callers wrote before WrapRadians.
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            auto r = std::fmod(in[i] + kPI, k2PI);
+            out[i] = (r < 0.0f) ? r + kPI : r - kPI;
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(WrapRadians_ScalarLoop, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = WrapRadians(in[i]);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(WrapRadians_Batch, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        WrapRadians(in.data(), in.size(), out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ToRadians_Batch, SIZES)
+{
+    auto in  = MakeRandomFloats(state.GetSize());
+    auto out = std::vector<float>(in.size());
+
+    while(state.KeepRunning()) {
+        ToRadians(in.data(), in.size(), out.data());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+//----------------------------------------------------------------------------//
+// Power of Two                                                               //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(IsPOT, SIZES)
+{
+    auto in = MakeRandomInts(state.GetSize(), 1, 1 << 30);
+
+    while(state.KeepRunning()) {
+        u32 count = 0;
+        for(auto v : in) {
+            count += IsPOT((unsigned int)v);
+        }
+        DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(ClosestPOT, SIZES)
+{
+    auto in  = MakeRandomInts(state.GetSize(), 1, 1 << 30);
+    auto out = std::vector<u32>(in.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = ClosestPOT((unsigned int)in[i]);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
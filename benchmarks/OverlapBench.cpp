@@ -0,0 +1,171 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : OverlapBench.cpp                                              //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Overlap.h pair tests against the generic ConvexPolygon SAT, and the     //
+//    SoA batches against the same pairs one by one.                          //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 16
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+struct OBBArrays
+{
+    std::vector<float> x, y, halfX, halfY, cosA, sinA;
+    std::vector<OBB>   boxes;
+
+    OBBSoA GetSoA() const
+    {
+        return OBBSoA{
+            x.data(), y.data(), halfX.data(), halfY.data(), cosA.data(), sinA.data(), boxes.size()
+        };
+    }
+};
+
+inline OBBArrays
+MakeRandomOBBs(size_t count, u32 seed)
+{
+    auto pos   = MakeRandomFloats(count * 2, -200.0f, 200.0f, seed);
+    auto sizes = MakeRandomFloats(count * 2,    1.0f,  16.0f, seed + 1);
+    auto angle = MakeRandomFloats(count,        0.0f, 360.0f, seed + 2);
+
+    OBBArrays a;
+    for(size_t i = 0; i < count; ++i) {
+        auto box = OBB(
+            Vec2(pos  [i * 2], pos  [i * 2 + 1]),
+            Vec2(sizes[i * 2], sizes[i * 2 + 1]),
+            angle[i]
+        );
+        a.boxes.push_back(box);
+        a.x    .push_back(box.center.x);
+        a.y    .push_back(box.center.y);
+        a.halfX.push_back(box.halfExtents.x);
+        a.halfY.push_back(box.halfExtents.y);
+        a.cosA .push_back(box.GetCos());
+        a.sinA .push_back(box.GetSin());
+    }
+    return a;
+}
+
+inline ConvexPolygon
+ToPolygon(const OBB &b)
+{
+    auto u = b.GetAxisX() * b.halfExtents.x;
+    auto v = b.GetAxisY() * b.halfExtents.y;
+
+    const Vec2 vertices[4] = { b.center - u - v, b.center + u - v, b.center + u + v, b.center - u + v };
+    return ConvexPolygon(vertices, 4);
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// OBB vs OBB                                                                 //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Overlap_OBB_AsPolygons, SIZES)
+{
+    auto a     = MakeRandomOBBs(state.GetSize(), 1);
+    auto query = OBB(Vec2::Zero(), Vec2(60.0f, 20.0f), 30.0f);
+    auto poly  = ToPolygon(query);
+
+    std::vector<ConvexPolygon> polys;
+    for(const auto &b : a.boxes) {
+        polys.push_back(ToPolygon(b));
+    }
+
+    while(state.KeepRunning()) {
+        size_t hits = 0;
+        for(const auto &p : polys) {
+            hits += Collide(poly, p);
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Overlap_OBB_OneByOne, SIZES)
+{
+    auto a     = MakeRandomOBBs(state.GetSize(), 1);
+    auto query = OBB(Vec2::Zero(), Vec2(60.0f, 20.0f), 30.0f);
+    auto hits  = std::vector<u8>(state.GetSize());
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < hits.size(); ++i) {
+            hits[i] = u8(Overlaps(query, a.boxes[i]));
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Overlap_OBB_SoA, SIZES)
+{
+    auto a     = MakeRandomOBBs(state.GetSize(), 1);
+    auto soa   = a.GetSoA();
+    auto query = OBB(Vec2::Zero(), Vec2(60.0f, 20.0f), 30.0f);
+    auto hits  = std::vector<u8>(state.GetSize());
+    while(state.KeepRunning()) {
+        DoNotOptimize(Overlaps(query, soa, hits.data()));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Circle vs Circle                                                           //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Overlap_Circle_OneByOne, SIZES)
+{
+    auto pos   = MakeRandomVec2s(state.GetSize(), -200.0f, 200.0f, 1);
+    auto radii = MakeRandomFloats(state.GetSize(), 1.0f, 16.0f, 2);
+    auto query = Circle(Vec2::Zero(), 50.0f);
+    auto hits  = std::vector<u8>(state.GetSize());
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < hits.size(); ++i) {
+            hits[i] = u8(Overlaps(query, Circle(pos[i], radii[i])));
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Overlap_Circle_SoA, SIZES)
+{
+    auto xs    = MakeRandomFloats(state.GetSize(), -200.0f, 200.0f, 1);
+    auto ys    = MakeRandomFloats(state.GetSize(), -200.0f, 200.0f, 3);
+    auto radii = MakeRandomFloats(state.GetSize(), 1.0f, 16.0f, 2);
+    auto soa   = CircleSoA{xs.data(), ys.data(), radii.data(), xs.size()};
+    auto query = Circle(Vec2::Zero(), 50.0f);
+    auto hits  = std::vector<u8>(state.GetSize());
+    while(state.KeepRunning()) {
+        DoNotOptimize(Overlaps(query, soa, hits.data()));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
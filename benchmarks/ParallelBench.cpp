@@ -0,0 +1,102 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParallelBench.cpp                                             //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ThreadPool scaling - The size is the number of threads, the work is     //
+//    the same 4M elements for all of them.                                   //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define THREADS 1, 2, 4, 8, 16, 32
+
+constexpr static size_t kElementsCount = 4 * 1024 * 1024;
+
+
+//----------------------------------------------------------------------------//
+// Transforms                                                                 //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Parallel_Normalize, THREADS)
+{
+    ThreadPool pool(state.GetSize() - 1);
+    auto vectors = MakeRandomVec2s(kElementsCount);
+    auto out     = std::vector<Vec2>(kElementsCount);
+    while(state.KeepRunning()) {
+        parallel::Normalize(vectors.data(), vectors.size(), out.data(), parallel::kDefaultGrainSize, pool);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(kElementsCount);
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Parallel_ClampToRect, THREADS)
+{
+    ThreadPool pool(state.GetSize() - 1);
+    auto points = MakeRandomVec2s(kElementsCount);
+    auto out    = std::vector<Vec2>(kElementsCount);
+    auto bounds = Rect(-500.0f, -500.0f, 1000.0f, 1000.0f);
+    while(state.KeepRunning()) {
+        parallel::Clamp(points.data(), points.size(), bounds, out.data(), parallel::kDefaultGrainSize, pool);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(kElementsCount);
+}
+
+
+//----------------------------------------------------------------------------//
+// Reductions / Culling                                                       //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Parallel_ComputeBounds, THREADS)
+{
+    ThreadPool pool(state.GetSize() - 1);
+    auto points = MakeRandomVec2s(kElementsCount);
+    while(state.KeepRunning()) {
+        DoNotOptimize(parallel::ComputeBounds(points.data(), points.size(), parallel::kDefaultGrainSize, pool));
+    }
+    state.SetItemsProcessed(kElementsCount);
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Parallel_CullRects, THREADS)
+{
+    ThreadPool pool(state.GetSize() - 1);
+    auto xs    = MakeRandomFloats(kElementsCount, -1000.0f, 1000.0f, 1);
+    auto ys    = MakeRandomFloats(kElementsCount, -1000.0f, 1000.0f, 2);
+    auto sizes = MakeRandomFloats(kElementsCount,     1.0f,   64.0f, 3);
+    auto soa   = RectSoA{xs.data(), ys.data(), sizes.data(), sizes.data(), kElementsCount};
+    auto view  = Rect(-400.0f, -300.0f, 800.0f, 600.0f);
+    auto hits  = std::vector<u8>(kElementsCount);
+    while(state.KeepRunning()) {
+        DoNotOptimize(parallel::Overlaps(view, soa, hits.data(), parallel::kDefaultGrainSize, pool));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(kElementsCount);
+}
+
+// Per task overhead - Chunks of 1 element do nothing but go through the pool.
+ACOW_MATH_BENCHMARK_SIZES(Parallel_ForOverhead, THREADS)
+{
+    ThreadPool pool(state.GetSize() - 1);
+    std::atomic<size_t> sum(0);
+    while(state.KeepRunning()) {
+        ParallelFor(0, 1024, 1, [&](size_t b, size_t e) { sum += e - b; }, pool);
+    }
+    DoNotOptimize(sum.load());
+    state.SetItemsProcessed(1024);
+}
@@ -0,0 +1,147 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParticleStoreBench.cpp                                        //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ParticleStore against the AoS particles with Vec2 operators it replaces.//
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1 << 16, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+struct AoSParticle
+{
+    Vec2  position;
+    Vec2  velocity;
+    Vec2  acceleration;
+    float lifetime;
+};
+
+inline ParticleStore
+MakeStore(size_t count)
+{
+    auto positions  = MakeRandomVec2s(count, -1000.0f, 1000.0f, 1);
+    auto velocities = MakeRandomVec2s(count,  -100.0f,  100.0f, 2);
+    auto lifetimes  = MakeRandomFloats(count, 0.0f, 2.0f, 3);
+
+    ParticleStore store(count);
+    for(size_t i = 0; i < count; ++i) {
+        store.Emit(positions[i], velocities[i], Vec2(0.0f, 98.0f), lifetimes[i]);
+    }
+    return store;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Integration                                                                //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Particles_Integrate_AoS, SIZES)
+{
+    auto positions  = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 1);
+    auto velocities = MakeRandomVec2s(state.GetSize(),  -100.0f,  100.0f, 2);
+
+    std::vector<AoSParticle> particles;
+    for(size_t i = 0; i < state.GetSize(); ++i) {
+        particles.push_back({positions[i], velocities[i], Vec2(0.0f, 98.0f), 1.0f});
+    }
+
+    auto dt = 0.016f;
+    while(state.KeepRunning()) {
+        for(auto &p : particles) {
+            p.velocity += p.acceleration * dt;
+            p.position += p.velocity     * dt;
+            p.lifetime -= dt;
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Particles_Integrate_SoA, SIZES)
+{
+    auto store = MakeStore(state.GetSize());
+    while(state.KeepRunning()) {
+        store.Integrate(0.016f);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Particles_Integrate_SoAVerlet, SIZES)
+{
+    auto store = MakeStore(state.GetSize());
+    while(state.KeepRunning()) {
+        store.Integrate(0.016f, ParticleStore::Integrator::VelocityVerlet);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Particles_Integrate_Parallel, SIZES)
+{
+    auto store = MakeStore(state.GetSize());
+    while(state.KeepRunning()) {
+        store.IntegrateParallel(0.016f);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Compaction / Culling                                                       //
+//----------------------------------------------------------------------------//
+// Steady state - Every iteration ~1 / 125 of the particles die, get
+// removed and are emitted again.
+ACOW_MATH_BENCHMARK_SIZES(Particles_RemoveDeadAndEmit, SIZES)
+{
+    auto store = MakeStore(state.GetSize());
+    while(state.KeepRunning()) {
+        store.Integrate(0.016f);
+
+        auto removed = store.RemoveDead();
+        for(size_t i = 0; i < removed; ++i) {
+            store.Emit(Vec2::Zero(), Vec2(10.0f, -50.0f), Vec2(0.0f, 98.0f), 2.0f);
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Particles_GatherInside, SIZES)
+{
+    auto store   = MakeStore(state.GetSize());
+    auto indices = std::vector<u32>(state.GetSize());
+    auto view    = Rect(-400.0f, -300.0f, 800.0f, 600.0f);
+    while(state.KeepRunning()) {
+        DoNotOptimize(store.GatherInside(view, indices.data()));
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
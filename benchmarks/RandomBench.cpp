@@ -0,0 +1,146 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : RandomBench.cpp                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Random.h against rand() called per component, the way the emitters      //
+//    used to do it.                                                          //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdlib>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Floats                                                                     //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Random_Floats_Rand, SIZES)
+{
+    auto out = std::vector<float>(state.GetSize());
+    std::srand(42);
+    while(state.KeepRunning()) {
+        for(auto &f : out) {
+            f = float(std::rand()) / float(RAND_MAX);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Random_Floats_Pcg32, SIZES)
+{
+    auto out = std::vector<float>(state.GetSize());
+    auto rng = Pcg32(42);
+    while(state.KeepRunning()) {
+        for(auto &f : out) {
+            f = rng.NextFloat();
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Random_Floats_Xoshiro128, SIZES)
+{
+    auto out = std::vector<float>(state.GetSize());
+    auto rng = Xoshiro128(42);
+    while(state.KeepRunning()) {
+        for(auto &f : out) {
+            f = rng.NextFloat();
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Random_Floats_Stream, SIZES)
+{
+    auto out = std::vector<float>(state.GetSize());
+    auto rng = RandomStream(42);
+    while(state.KeepRunning()) {
+        rng.Fill(out.data(), out.size());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Samplers                                                                   //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Random_PointsInRect_Rand, SIZES)
+{
+    auto out  = std::vector<Vec2>(state.GetSize());
+    auto rect = Rect(-100.0f, -50.0f, 200.0f, 100.0f);
+    std::srand(42);
+    while(state.KeepRunning()) {
+        for(auto &p : out) {
+            p.x = rect.GetX() + rect.GetWidth () * (float(std::rand()) / float(RAND_MAX));
+            p.y = rect.GetY() + rect.GetHeight() * (float(std::rand()) / float(RAND_MAX));
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Random_PointsInRect_Stream, SIZES)
+{
+    auto out  = std::vector<Vec2>(state.GetSize());
+    auto rect = Rect(-100.0f, -50.0f, 200.0f, 100.0f);
+    auto rng  = RandomStream(42);
+    while(state.KeepRunning()) {
+        SamplePointsInRect(rng, rect, out.data(), out.size());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Random_Directions_Stream, SIZES)
+{
+    auto out = std::vector<Vec2>(state.GetSize());
+    auto rng = RandomStream(42);
+    while(state.KeepRunning()) {
+        SampleDirections(rng, out.data(), out.size());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Random_Coords_Stream, SIZES)
+{
+    auto out = std::vector<Coord>(state.GetSize());
+    auto rng = RandomStream(42);
+    while(state.KeepRunning()) {
+        SampleCoords(rng, 512, 512, out.data(), out.size());
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
@@ -0,0 +1,110 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : RectBench.cpp                                                 //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Rect.h primitives.                                                      //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Queries                                                                    //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Rect_Intersects, SIZES)
+{
+    auto in     = MakeRandomRects(state.GetSize());
+    auto camera = Rect(-200, -200, 400, 400);
+
+    while(state.KeepRunning()) {
+        u32 count = 0;
+        for(const auto &r : in) {
+            count += camera.Intersects(r);
+        }
+        DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Rect_ContainsPoint, SIZES)
+{
+    auto in     = MakeRandomVec2s(state.GetSize());
+    auto camera = Rect(-200, -200, 400, 400);
+
+    while(state.KeepRunning()) {
+        u32 count = 0;
+        for(const auto &p : in) {
+            count += camera.Contains(p);
+        }
+        DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Rect_GetCenter, SIZES)
+{
+    auto in = MakeRandomRects(state.GetSize());
+
+    while(state.KeepRunning()) {
+        float acc = 0.0f;
+        for(const auto &r : in) {
+            acc += r.GetCenter().x;
+        }
+        DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Movement                                                                   //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Rect_Translate, SIZES)
+{
+    auto in    = MakeRandomRects(state.GetSize());
+    auto delta = MakeRandomVec2s(state.GetSize(), -1.0f, 1.0f);
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            in[i].Translate(delta[i]);
+        }
+        DoNotOptimize(in.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Rect_SetCenter, SIZES)
+{
+    auto in     = MakeRandomRects(state.GetSize());
+    auto center = MakeRandomVec2s(state.GetSize());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            in[i].SetCenter(center[i]);
+        }
+        DoNotOptimize(in.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
@@ -0,0 +1,136 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SDLInteropBench.cpp                                           //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    SDLInterop.h bulk conversion against converting one Rect at a time.     //
+//    Uses stand-ins with the SDL layouts, so SDL isn't needed.               //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 16
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+struct StandInRect  { i32 x, y, w, h; };
+struct StandInPoint { i32 x, y;       };
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Rects                                                                      //
+//----------------------------------------------------------------------------//
+// What operator SDL_Rect does, one Rect at a time.
+ACOW_MATH_BENCHMARK_SIZES(SDLInterop_RectCasts, SIZES)
+{
+    auto in  = MakeRandomRects(state.GetSize());
+    auto out = std::vector<StandInRect>(in.size());
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = StandInRect{ i32(in[i].x), i32(in[i].y), i32(in[i].w), i32(in[i].h) };
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(SDLInterop_RectRoundPerElement, SIZES)
+{
+    auto in  = MakeRandomRects(state.GetSize());
+    auto out = std::vector<StandInRect>(in.size());
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < in.size(); ++i) {
+            out[i] = StandInRect{
+                i32(std::lround(in[i].x)), i32(std::lround(in[i].y)),
+                i32(std::lround(in[i].w)), i32(std::lround(in[i].h))
+            };
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(SDLInterop_ToIntRectsTruncate, SIZES)
+{
+    auto in  = MakeRandomRects(state.GetSize());
+    auto out = std::vector<StandInRect>(in.size());
+    while(state.KeepRunning()) {
+        ToIntRects(in.data(), in.size(), out.data(), Rounding::Truncate);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(SDLInterop_ToIntRectsFloor, SIZES)
+{
+    auto in  = MakeRandomRects(state.GetSize());
+    auto out = std::vector<StandInRect>(in.size());
+    while(state.KeepRunning()) {
+        ToIntRects(in.data(), in.size(), out.data(), Rounding::Floor);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(SDLInterop_ToIntRectsNearest, SIZES)
+{
+    auto in  = MakeRandomRects(state.GetSize());
+    auto out = std::vector<StandInRect>(in.size());
+    while(state.KeepRunning()) {
+        ToIntRects(in.data(), in.size(), out.data(), Rounding::Nearest);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Points                                                                     //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(SDLInterop_ToIntPointsNearest, SIZES)
+{
+    auto in  = MakeRandomVec2s(state.GetSize());
+    auto out = std::vector<StandInPoint>(in.size());
+    while(state.KeepRunning()) {
+        ToIntPoints(in.data(), in.size(), out.data(), Rounding::Nearest);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(SDLInterop_FromIntPoints, SIZES)
+{
+    auto in   = MakeRandomVec2s(state.GetSize());
+    auto ints = std::vector<StandInPoint>(in.size());
+    ToIntPoints(in.data(), in.size(), ints.data());
+    while(state.KeepRunning()) {
+        FromIntPoints(ints.data(), ints.size(), in.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
@@ -0,0 +1,156 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SplineBench.cpp                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Spline.h against the Lerp chains and per frame integration it replaces. //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+inline CubicBezier
+MakeCurve()
+{
+    return CubicBezier(Vec2(0.0f, 0.0f), Vec2(30.0f, 80.0f), Vec2(70.0f, -40.0f), Vec2(100.0f, 10.0f));
+}
+
+inline Spline
+MakeSpline(size_t pointsCount)
+{
+    auto points = MakeRandomVec2s(pointsCount, -500.0f, 500.0f);
+    return Spline::FromCatmullRom(points.data(), points.size());
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Evaluation                                                                 //
+//----------------------------------------------------------------------------//
+// What the callers did - De Casteljau with Lerps at every t.
+ACOW_MATH_BENCHMARK_SIZES(Spline_Bezier_Lerps, 64, 1024)
+{
+    auto curve  = MakeCurve();
+    auto points = std::vector<Vec2>(state.GetSize());
+    while(state.KeepRunning()) {
+        auto n = points.size();
+        for(size_t i = 0; i < n; ++i) {
+            auto t    = float(i) / float(n - 1);
+            auto p01  = Lerp(curve.p0, curve.p1, t);
+            auto p12  = Lerp(curve.p1, curve.p2, t);
+            auto p23  = Lerp(curve.p2, curve.p3, t);
+            points[i] = Lerp(Lerp(p01, p12, t), Lerp(p12, p23, t), t);
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Spline_Bezier_Polynomial, 64, 1024)
+{
+    auto curve  = MakeCurve();
+    auto points = std::vector<Vec2>(state.GetSize());
+    while(state.KeepRunning()) {
+        auto n = points.size();
+        for(size_t i = 0; i < n; ++i) {
+            points[i] = curve.Evaluate(float(i) / float(n - 1));
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Spline_Bezier_ForwardDifferencing, 64, 1024)
+{
+    auto curve  = MakeCurve();
+    auto points = std::vector<Vec2>(state.GetSize());
+    while(state.KeepRunning()) {
+        curve.Evaluate(points.size(), points.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK(Spline_Bezier_Flatten)
+{
+    auto curve  = MakeCurve();
+    auto points = std::vector<Vec2>();
+    while(state.KeepRunning()) {
+        curve.Flatten(0.25f, &points);
+        DoNotOptimize(points.data());
+    }
+    state.SetItemsProcessed(1);
+}
+
+
+//----------------------------------------------------------------------------//
+// Constant Speed                                                             //
+//----------------------------------------------------------------------------//
+// Re-integrating from the start to find each distance.
+ACOW_MATH_BENCHMARK_SIZES(Spline_AtDistance_Integrate, 16, 256)
+{
+    auto spline    = MakeSpline(state.GetSize());
+    auto distances = MakeRandomFloats(256, 0.0f, spline.GetLength());
+    auto steps     = state.GetSize() * 32;
+    while(state.KeepRunning()) {
+        for(auto target : distances) {
+            auto prev   = spline.Evaluate(0.0f);
+            auto length = 0.0f;
+            auto u      = 0.0f;
+            for(size_t i = 1; i <= steps && length < target; ++i) {
+                u = float(i) * float(state.GetSize() - 1) / float(steps);
+                auto p = spline.Evaluate(u);
+                length += p.Distance(prev);
+                prev    = p;
+            }
+            DoNotOptimize(spline.Evaluate(u));
+        }
+    }
+    state.SetItemsProcessed(distances.size());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Spline_AtDistance_Table, 16, 256)
+{
+    auto spline    = MakeSpline(state.GetSize());
+    auto distances = MakeRandomFloats(256, 0.0f, spline.GetLength());
+    while(state.KeepRunning()) {
+        for(auto d : distances) {
+            DoNotOptimize(spline.EvaluateAtDistance(d));
+        }
+    }
+    state.SetItemsProcessed(distances.size());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Spline_SampleEvenly, 16, 256)
+{
+    auto spline = MakeSpline(state.GetSize());
+    auto points = std::vector<Vec2>(256);
+    while(state.KeepRunning()) {
+        spline.SampleEvenly(points.size(), points.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(points.size());
+}
@@ -0,0 +1,169 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TileCollisionMapBench.cpp                                     //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    TileCollisionMap queries against testing the solid tiles as Rects.      //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+// 512 x 512 tiles of 16 units - By default about 20% solid, with boxes
+// of 1 to 3 tiles.
+struct Level
+{
+    TileCollisionMap  map;
+    std::vector<Rect> solidRects;
+    std::vector<Rect> boxes;
+    std::vector<Vec2> deltas;
+
+    explicit
+    Level(size_t count, i32 solidPercent = 20, float maxBoxSize = 48.0f)
+        : map(512, 512, 16.0f)
+    {
+        auto cells = MakeRandomInts(512 * 512, 0, 99, 1);
+        for(i32 y = 0; y < 512; ++y) {
+            for(i32 x = 0; x < 512; ++x) {
+                if(cells[size_t(y) * 512 + size_t(x)] < solidPercent) {
+                    map.SetSolid(Coord(y, x), true);
+                    solidRects.push_back(map.GetTileRect(Coord(y, x)));
+                }
+            }
+        }
+
+        auto pos  = MakeRandomVec2s(count, 0.0f, 8192.0f, 2);
+        auto size = MakeRandomVec2s(count, 8.0f, maxBoxSize, 3);
+        deltas    = MakeRandomVec2s(count, -24.0f, 24.0f, 4);
+        for(size_t i = 0; i < count; ++i) {
+            boxes.push_back(Rect(pos[i].x, pos[i].y, size[i].x, size[i].y));
+        }
+    }
+};
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Overlaps                                                                   //
+//----------------------------------------------------------------------------//
+// The float way - A byte per tile and a Rect test for each solid one.
+static void
+OverlapsPerTileRect(State &state, const Level &level)
+{
+    auto solid = std::vector<u8>(512 * 512, 0);
+    for(const auto &rect : level.solidRects) {
+        solid[size_t(rect.y / 16.0f) * 512 + size_t(rect.x / 16.0f)] = 1;
+    }
+
+    while(state.KeepRunning()) {
+        size_t hits = 0;
+        for(const auto &box : level.boxes) {
+            auto x0  = Max(i32(box.GetLeft  () / 16.0f), 0);
+            auto y0  = Max(i32(box.GetTop   () / 16.0f), 0);
+            auto x1  = Min(i32(box.GetRight () / 16.0f), 511);
+            auto y1  = Min(i32(box.GetBottom() / 16.0f), 511);
+            auto hit = false;
+            for(auto y = y0; y <= y1 && !hit; ++y) {
+                for(auto x = x0; x <= x1 && !hit; ++x) {
+                    hit = solid[size_t(y) * 512 + size_t(x)]
+                       && Rect(float(x) * 16.0f, float(y) * 16.0f, 16.0f, 16.0f).Intersects(box);
+                }
+            }
+            hits += hit ? 1 : 0;
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+static void
+OverlapsBitset(State &state, const Level &level)
+{
+    while(state.KeepRunning()) {
+        size_t hits = 0;
+        for(const auto &box : level.boxes) {
+            hits += level.map.Overlaps(box) ? 1 : 0;
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(TileMap_Overlaps_PerTileRect, 1024, 1 << 16)
+{
+    OverlapsPerTileRect(state, Level(state.GetSize()));
+}
+
+ACOW_MATH_BENCHMARK_SIZES(TileMap_Overlaps_Bitset, 1024, 1 << 16)
+{
+    OverlapsBitset(state, Level(state.GetSize()));
+}
+
+// Sensors / explosions over a sparse level - 4 to 32 tiles wide, 2% solid.
+ACOW_MATH_BENCHMARK_SIZES(TileMap_OverlapsWide_PerTileRect, 1024)
+{
+    OverlapsPerTileRect(state, Level(state.GetSize(), 2, 512.0f));
+}
+
+ACOW_MATH_BENCHMARK_SIZES(TileMap_OverlapsWide_Bitset, 1024)
+{
+    OverlapsBitset(state, Level(state.GetSize(), 2, 512.0f));
+}
+
+
+//----------------------------------------------------------------------------//
+// Raycast / Move and Slide                                                   //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(TileMap_Raycast, 1024, 1 << 16)
+{
+    Level level(state.GetSize());
+    auto  ends = MakeRandomVec2s(state.GetSize(), 0.0f, 8192.0f, 5);
+
+    while(state.KeepRunning()) {
+        size_t hits = 0;
+        TileCollisionMap::TileHit hit;
+        for(size_t i = 0; i < level.boxes.size(); ++i) {
+            hits += level.map.Raycast(level.boxes[i].GetTopLeft(), ends[i], &hit) ? 1 : 0;
+        }
+        DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(TileMap_MoveAndSlide, 1024, 1 << 16)
+{
+    Level level(state.GetSize());
+    auto  out = std::vector<Rect>(level.boxes.size());
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < level.boxes.size(); ++i) {
+            out[i] = level.map.MoveAndSlide(level.boxes[i], level.deltas[i]);
+        }
+        DoNotOptimize(out.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
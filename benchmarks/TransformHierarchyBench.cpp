@@ -0,0 +1,138 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TransformHierarchyBench.cpp                                   //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    TransformHierarchy.h against chaining Vec2 rotations every frame.       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+#include <cmath>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+// Shallow scene - Roots every 64 nodes, the others parented to a node
+// up to 8 before them.
+inline std::vector<u32>
+MakeParents(size_t count)
+{
+    auto offsets = MakeRandomInts(count, 1, 8);
+
+    std::vector<u32> parents(count);
+    for(size_t i = 0; i < count; ++i) {
+        parents[i] = (i % 64 == 0)
+            ? TransformHierarchy::kNoParent
+            : u32(i - std::min(size_t(offsets[i]), i % 64));
+    }
+    return parents;
+}
+
+inline TransformHierarchy
+MakeHierarchy(size_t count)
+{
+    auto parents   = MakeParents(count);
+    auto positions = MakeRandomVec2s(count, -50.0f, 50.0f);
+    auto rotations = MakeRandomFloats(count, -180.0f, 180.0f);
+
+    TransformHierarchy hierarchy;
+    hierarchy.Reserve(count);
+    for(size_t i = 0; i < count; ++i) {
+        hierarchy.AddNode(
+            parents[i], positions[i], rotations[i], Vec2(1.0f, 1.0f),
+            Rect(-8.0f, -8.0f, 16.0f, 16.0f)
+        );
+    }
+    hierarchy.Update();
+    return hierarchy;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Update                                                                     //
+//----------------------------------------------------------------------------//
+// What the scene graph did - Every node, every frame, sin / cos included.
+ACOW_MATH_BENCHMARK_SIZES(TransformHierarchy_ChainVec2, 1024, 1 << 16)
+{
+    auto count     = state.GetSize();
+    auto parents   = MakeParents(count);
+    auto positions = MakeRandomVec2s(count, -50.0f, 50.0f);
+    auto rotations = MakeRandomFloats(count, -180.0f, 180.0f);
+
+    std::vector<Vec2>  world_positions(count);
+    std::vector<float> world_rotations(count);
+    std::vector<Rect>  world_bounds   (count);
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < count; ++i) {
+            auto parent = parents[i];
+            if(parent == TransformHierarchy::kNoParent) {
+                world_positions[i] = positions[i];
+                world_rotations[i] = rotations[i];
+            } else {
+                world_positions[i] = world_positions[parent] + positions[i].Rotated(world_rotations[parent]);
+                world_rotations[i] = world_rotations[parent] + rotations[i];
+            }
+
+            // Bounds from the 4 rotated corners.
+            auto r      = world_rotations[i];
+            auto corner = Vec2(8.0f, 8.0f).Rotated(r);
+            auto other  = Vec2(8.0f, -8.0f).Rotated(r);
+            auto ex     = std::max(std::fabs(corner.x), std::fabs(other.x));
+            auto ey     = std::max(std::fabs(corner.y), std::fabs(other.y));
+            world_bounds[i] = Rect(world_positions[i].x - ex, world_positions[i].y - ey, ex * 2.0f, ey * 2.0f);
+        }
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(TransformHierarchy_UpdateAll, 1024, 1 << 16)
+{
+    auto hierarchy = MakeHierarchy(state.GetSize());
+    while(state.KeepRunning()) {
+        hierarchy.Translate(0, Vec2(0.0f, 0.0f));
+        for(u32 i = 64; i < hierarchy.GetNodesCount(); i += 64) {
+            hierarchy.Translate(i, Vec2(0.0f, 0.0f));
+        }
+        DoNotOptimize(hierarchy.Update());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+// The usual frame - A few roots moved, the rest of the scene still.
+ACOW_MATH_BENCHMARK_SIZES(TransformHierarchy_UpdateFewRoots, 1024, 1 << 16)
+{
+    auto hierarchy = MakeHierarchy(state.GetSize());
+    auto roots     = u32(hierarchy.GetNodesCount() / 64);
+    while(state.KeepRunning()) {
+        for(u32 i = 0; i < roots; i += 16) {
+            hierarchy.Translate(i * 64, Vec2(0.1f, 0.0f));
+        }
+        DoNotOptimize(hierarchy.Update());
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
@@ -0,0 +1,146 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Vec2Bench.cpp                                                 //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Vec2.h primitives.                                                      //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+#define SIZES 1024, 1 << 20
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//   Every primitive runs over an array, so the compiler can't fold it.       //
+//----------------------------------------------------------------------------//
+#define VEC2_UNARY_BENCHMARK(_name_, _expr_)                  \
+    ACOW_MATH_BENCHMARK_SIZES(_name_, SIZES)                  \
+    {                                                         \
+        auto in = MakeRandomVec2s(state.GetSize());           \
+        while(state.KeepRunning()) {                          \
+            float acc = 0.0f;                                 \
+            for(const auto &v : in) {                         \
+                acc += (_expr_);                              \
+            }                                                 \
+            DoNotOptimize(acc);                               \
+        }                                                     \
+        state.SetItemsProcessed(state.GetSize());             \
+    }
+
+#define VEC2_MAP_BENCHMARK(_name_, _expr_)                    \
+    ACOW_MATH_BENCHMARK_SIZES(_name_, SIZES)                  \
+    {                                                         \
+        auto in  = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 1); \
+        auto out = std::vector<Vec2>(in.size());              \
+        while(state.KeepRunning()) {                          \
+            for(size_t i = 0; i < in.size(); ++i) {           \
+                const auto &v = in[i];                        \
+                out[i] = (_expr_);                            \
+            }                                                 \
+            DoNotOptimize(out.data());                        \
+            ClobberMemory();                                  \
+        }                                                     \
+        state.SetItemsProcessed(state.GetSize());             \
+    }
+
+#define VEC2_BINARY_BENCHMARK(_name_, _expr_)                 \
+    ACOW_MATH_BENCHMARK_SIZES(_name_, SIZES)                  \
+    {                                                         \
+        auto a   = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 1); \
+        auto b   = MakeRandomVec2s(state.GetSize(),     1.0f, 1000.0f, 2); \
+        auto out = std::vector<Vec2>(a.size());               \
+        while(state.KeepRunning()) {                          \
+            for(size_t i = 0; i < a.size(); ++i) {            \
+                const auto &lhs = a[i];                       \
+                const auto &rhs = b[i];                       \
+                out[i] = (_expr_);                            \
+            }                                                 \
+            DoNotOptimize(out.data());                        \
+            ClobberMemory();                                  \
+        }                                                     \
+        state.SetItemsProcessed(state.GetSize());             \
+    }
+
+
+//----------------------------------------------------------------------------//
+// Magnitude / Distance                                                       //
+//----------------------------------------------------------------------------//
+VEC2_UNARY_BENCHMARK(Vec2_Magnitude,    v.Magnitude   ())
+VEC2_UNARY_BENCHMARK(Vec2_MagnitudeSqr, v.MagnitudeSqr())
+VEC2_UNARY_BENCHMARK(Vec2_Distance,     v.Distance   (Vec2::One()))
+VEC2_UNARY_BENCHMARK(Vec2_DistanceSqr,  v.DistanceSqr(Vec2::One()))
+
+
+//----------------------------------------------------------------------------//
+// Normalize / Rotate                                                         //
+//----------------------------------------------------------------------------//
+VEC2_MAP_BENCHMARK   (Vec2_Normalized, v.Normalized())
+VEC2_BINARY_BENCHMARK(Vec2_Rotated,    lhs.Rotated(rhs.x))
+
+
+//----------------------------------------------------------------------------//
+// Deterministic sin / cos                                                    //
+//   Cost of ACOW_MATH_DETERMINISTIC against the libm that it replaces.       //
+//----------------------------------------------------------------------------//
+VEC2_UNARY_BENCHMARK(Vec2_SinCosLibm, sinf(v.x) + cosf(v.x))
+
+ACOW_MATH_BENCHMARK_SIZES(Vec2_SinCosDeterministic, SIZES)
+{
+    auto in = MakeRandomVec2s(state.GetSize());
+    while(state.KeepRunning()) {
+        float acc = 0.0f;
+        for(const auto &v : in) {
+            auto s = 0.0f;
+            auto c = 0.0f;
+            DetSinCos(v.x, &s, &c);
+            acc += s + c;
+        }
+        DoNotOptimize(acc);
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Operators                                                                  //
+//----------------------------------------------------------------------------//
+VEC2_BINARY_BENCHMARK(Vec2_OperatorAdd,    lhs + rhs)
+VEC2_BINARY_BENCHMARK(Vec2_OperatorSub,    lhs - rhs)
+VEC2_BINARY_BENCHMARK(Vec2_OperatorMul,    lhs * rhs)
+VEC2_BINARY_BENCHMARK(Vec2_OperatorDiv,    lhs / rhs)
+VEC2_BINARY_BENCHMARK(Vec2_OperatorScalar, lhs * rhs.x)
+VEC2_BINARY_BENCHMARK(Vec2_Lerp,           Lerp(lhs, rhs, 0.25f))
+
+ACOW_MATH_BENCHMARK_SIZES(Vec2_OperatorAddAssign, SIZES)
+{
+    auto a = MakeRandomVec2s(state.GetSize(), -1000.0f, 1000.0f, 1);
+    auto b = MakeRandomVec2s(state.GetSize(), -1.0f,    1.0f,    2);
+
+    while(state.KeepRunning()) {
+        for(size_t i = 0; i < a.size(); ++i) {
+            a[i] += b[i];
+        }
+        DoNotOptimize(a.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
@@ -0,0 +1,171 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Vec2CodecBench.cpp                                            //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Vec2Codec.h throughput, and its frame sizes against raw floats.         //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math;
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Helpers                                                                    //
+//----------------------------------------------------------------------------//
+namespace {
+
+const Rect kWorld = Rect(-1000.0f, -1000.0f, 2000.0f, 2000.0f);
+
+inline Vec2Quantizer
+MakeQuantizer()
+{
+    // 1 cm on a 2 km world.
+    return Vec2Quantizer::FromPrecision(kWorld, 0.01f);
+}
+
+///-----------------------------------------------------------------------------
+/// @brief The positions one frame later - Everything moved up to speed.
+inline std::vector<Vec2>
+MakeNextFrame(const std::vector<Vec2> &frame, float speed)
+{
+    auto steps = MakeRandomVec2s(frame.size(), -speed, speed, 7);
+    auto next  = frame;
+    for(size_t i = 0; i < next.size(); ++i) {
+        next[i] += steps[i];
+    }
+    return next;
+}
+
+inline std::string
+MakeSizeLabel(size_t bytes, size_t pointsCount)
+{
+    char label[64];
+    std::snprintf(
+        label, sizeof(label), "%.2f bytes/point (raw 8)",
+        double(bytes) / double(pointsCount)
+    );
+    return label;
+}
+
+} // namespace
+
+
+//----------------------------------------------------------------------------//
+// Quantization                                                               //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Vec2Codec_Quantize, 1024, 1 << 20)
+{
+    auto quantizer = MakeQuantizer();
+    auto points    = MakeRandomVec2s(state.GetSize());
+    auto cells     = std::vector<u32>(points.size() * 2);
+    while(state.KeepRunning()) {
+        quantizer.Quantize(points.data(), points.size(), cells.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Vec2Codec_Dequantize, 1024, 1 << 20)
+{
+    auto quantizer = MakeQuantizer();
+    auto points    = MakeRandomVec2s(state.GetSize());
+    auto cells     = std::vector<u32>(points.size() * 2);
+    quantizer.Quantize(points.data(), points.size(), cells.data());
+    while(state.KeepRunning()) {
+        quantizer.Dequantize(cells.data(), points.size(), points.data());
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+}
+
+
+//----------------------------------------------------------------------------//
+// Frames                                                                     //
+//----------------------------------------------------------------------------//
+ACOW_MATH_BENCHMARK_SIZES(Vec2Codec_EncodeKeyframe, 1024, 1 << 20)
+{
+    Vec2StreamEncoder encoder(MakeQuantizer());
+    auto points = MakeRandomVec2s(state.GetSize());
+    auto bytes  = std::vector<u8>();
+    while(state.KeepRunning()) {
+        bytes.clear();
+        encoder.Reset();
+        encoder.EncodeFrame(points.data(), points.size(), &bytes);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+    state.SetLabel(MakeSizeLabel(bytes.size(), points.size()));
+}
+
+// Objects moving up to 0.5 units (50 cells) each frame.
+ACOW_MATH_BENCHMARK_SIZES(Vec2Codec_EncodeDelta, 1024, 1 << 20)
+{
+    Vec2StreamEncoder encoder(MakeQuantizer());
+    auto frame = MakeRandomVec2s(state.GetSize());
+    auto next  = MakeNextFrame(frame, 0.5f);
+    auto bytes = std::vector<u8>();
+    while(state.KeepRunning()) {
+        bytes.clear();
+        encoder.EncodeFrame(frame.data(), frame.size(), &bytes);
+        bytes.clear();
+        encoder.EncodeFrame(next .data(), next .size(), &bytes);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize() * 2);
+    state.SetLabel(MakeSizeLabel(bytes.size(), frame.size()));
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Vec2Codec_EncodeStill, 1024, 1 << 20)
+{
+    Vec2StreamEncoder encoder(MakeQuantizer());
+    auto frame = MakeRandomVec2s(state.GetSize());
+    auto bytes = std::vector<u8>();
+    encoder.EncodeFrame(frame.data(), frame.size(), &bytes);
+    while(state.KeepRunning()) {
+        bytes.clear();
+        encoder.EncodeFrame(frame.data(), frame.size(), &bytes);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize());
+    state.SetLabel(MakeSizeLabel(bytes.size(), frame.size()));
+}
+
+ACOW_MATH_BENCHMARK_SIZES(Vec2Codec_DecodeDelta, 1024, 1 << 20)
+{
+    auto quantizer = MakeQuantizer();
+    auto frame     = MakeRandomVec2s(state.GetSize());
+    auto next      = MakeNextFrame(frame, 0.5f);
+
+    std::vector<u8> keyframe, delta;
+    Vec2StreamEncoder encoder(quantizer);
+    encoder.EncodeFrame(frame.data(), frame.size(), &keyframe);
+    encoder.EncodeFrame(next .data(), next .size(), &delta);
+
+    Vec2StreamDecoder decoder(quantizer);
+    auto points = std::vector<Vec2>();
+    while(state.KeepRunning()) {
+        decoder.DecodeFrame(keyframe.data(), keyframe.size(), &points);
+        decoder.DecodeFrame(delta   .data(), delta   .size(), &points);
+        ClobberMemory();
+    }
+    state.SetItemsProcessed(state.GetSize() * 2);
+}
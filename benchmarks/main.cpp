@@ -0,0 +1,202 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    acow_math_benchmarks entry point.                                       //
+//                                                                            //
+//    acow_math_benchmarks [--filter <substr>] [--min-time <secs>]            //
+//                         [--json <path>]                                    //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+// acow_math_goodies
+#include "Benchmark.h"
+
+using namespace acow::math::bench;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+struct Result
+{
+    std::string name;
+    size_t      size;
+    u64         iterations;
+    double      nsPerIteration;
+    double      itemsPerSecond;
+    std::string label;
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static Result
+RunBenchmark(const BenchmarkInfo &info, size_t size, double minTime)
+{
+    // Grow the iterations until the run takes long enough to be trusted.
+    u64 iterations = 1;
+    while(true) {
+        State state(size, iterations);
+        info.func(state);
+
+        auto elapsed = state.GetElapsedSeconds();
+        if(elapsed >= minTime || iterations >= (u64(1) << 40)) {
+            Result r;
+            r.name           = info.name;
+            r.size           = size;
+            r.iterations     = iterations;
+            r.nsPerIteration = (elapsed * 1e9) / double(iterations);
+            r.itemsPerSecond = (state.GetItemsProcessed() == 0 || elapsed <= 0.0)
+                ? 0.0
+                : double(state.GetItemsProcessed()) * double(iterations) / elapsed;
+            r.label          = state.GetLabel();
+            return r;
+        }
+
+        auto multiplier = (elapsed <= 0.0) ? 10.0 : (minTime * 1.4) / elapsed;
+        multiplier = (multiplier > 10.0) ? 10.0 : multiplier;
+        multiplier = (multiplier <  1.2) ?  1.2 : multiplier;
+
+        iterations = u64(double(iterations) * multiplier) + 1;
+    }
+}
+
+static const char*
+GetSIMDName()
+{
+    #if (ACOW_MATH_HAS_AVX)
+        return "avx";
+    #elif (ACOW_MATH_HAS_SSE2)
+        return "sse2";
+    #else
+        return "scalar";
+    #endif // (ACOW_MATH_HAS_AVX)
+}
+
+static bool
+WriteJSON(const char *path, const std::vector<Result> &results)
+{
+    auto p_file = std::fopen(path, "w");
+    if(!p_file) {
+        return false;
+    }
+
+    char date[64] = {};
+    auto now = std::time(nullptr);
+    std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&now));
+
+    std::fprintf(p_file, "{\n");
+    std::fprintf(p_file, "  \"context\": {\n");
+    std::fprintf(p_file, "    \"date\": \"%s\",\n", date);
+    std::fprintf(p_file, "    \"simd\": \"%s\"\n",  GetSIMDName());
+    std::fprintf(p_file, "  },\n");
+    std::fprintf(p_file, "  \"benchmarks\": [\n");
+    for(size_t i = 0; i < results.size(); ++i) {
+        const auto &r = results[i];
+        std::fprintf(
+            p_file,
+            "    {\"name\": \"%s\", \"size\": %zu, \"iterations\": %llu, "
+            "\"ns_per_iteration\": %.4f, \"items_per_second\": %.1f, \"label\": \"%s\"}%s\n",
+            r.name.c_str(),
+            r.size,
+            (unsigned long long)r.iterations,
+            r.nsPerIteration,
+            r.itemsPerSecond,
+            r.label.c_str(),
+            (i + 1 < results.size()) ? "," : ""
+        );
+    }
+    std::fprintf(p_file, "  ]\n");
+    std::fprintf(p_file, "}\n");
+
+    std::fclose(p_file);
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main(int argc, char *argv[])
+{
+    const char *filter    = nullptr;
+    const char *json_path = nullptr;
+    double      min_time  = 0.1;
+
+    for(int i = 1; i < argc; ++i) {
+        if(std::strcmp(argv[i], "--filter") == 0 && i + 1 < argc) {
+            filter = argv[++i];
+        } else if(std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if(std::strcmp(argv[i], "--min-time") == 0 && i + 1 < argc) {
+            min_time = std::atof(argv[++i]);
+        } else {
+            std::fprintf(
+                stderr,
+                "Usage: %s [--filter <substr>] [--min-time <secs>] [--json <path>]\n",
+                argv[0]
+            );
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Results of a build that diverges can't be compared to the others.
+    auto deterministic_ok = acow::math::VerifyDeterministicMath();
+
+    std::printf("simd: %s\n", GetSIMDName());
+    std::printf("deterministic math: %s\n", deterministic_ok ? "ok" : "DIVERGES from the golden values");
+    std::printf("%-48s %10s %14s %16s\n", "benchmark", "size", "ns/iter", "items/s");
+
+    std::vector<Result> results;
+    for(const auto &info : GetRegistry()) {
+        if(filter && info.name.find(filter) == std::string::npos) {
+            continue;
+        }
+
+        for(auto size : info.sizes) {
+            auto r = RunBenchmark(info, size, min_time);
+            std::printf(
+                "%-48s %10zu %14.2f %16.4g  %s\n",
+                r.name.c_str(), r.size, r.nsPerIteration, r.itemsPerSecond, r.label.c_str()
+            );
+            std::fflush(stdout);
+
+            results.push_back(r);
+        }
+    }
+
+    #if (ACOW_MATH_INSTRUMENTATION)
+        // Counts of every run, the growing ones included.
+        std::printf("\n%s", acow::math::instrumentation::ToText(
+            acow::math::instrumentation::TakeSnapshot()
+        ).c_str());
+    #endif // (ACOW_MATH_INSTRUMENTATION)
+
+    if(json_path && !WriteJSON(json_path, results)) {
+        std::fprintf(stderr, "Failed to write: %s\n", json_path);
+        return EXIT_FAILURE;
+    }
+
+    return deterministic_ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
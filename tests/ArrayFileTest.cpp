@@ -0,0 +1,284 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ArrayFileTest.cpp                                             //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ArrayFileWriter::Build read back with ArrayFileReader - Every type in   //
+//    both layouts, and files that were cut, corrupted or that lie about      //
+//    where their sections are.                                               //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Not a multiple of the 64 bytes alignment in any of the types.
+constexpr size_t kItemsCount = 1003;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static std::vector<float>
+MakeFloats()
+{
+    std::vector<float> floats;
+    for(size_t i = 0; i < kItemsCount; ++i) {
+        floats.push_back(float(i) * 0.5f);
+    }
+    return floats;
+}
+
+static std::vector<Vec2>
+MakeVec2s()
+{
+    std::vector<Vec2> vec2s;
+    for(size_t i = 0; i < kItemsCount; ++i) {
+        vec2s.push_back(Vec2(float(i), -float(i)));
+    }
+    return vec2s;
+}
+
+static std::vector<Rect>
+MakeRects()
+{
+    std::vector<Rect> rects;
+    for(size_t i = 0; i < kItemsCount; ++i) {
+        rects.push_back(Rect(float(i), float(i) * 2.0f, float(i) * 3.0f, float(i) * 4.0f));
+    }
+    return rects;
+}
+
+static std::vector<Coord>
+MakeCoords()
+{
+    std::vector<Coord> coords;
+    for(size_t i = 0; i < kItemsCount; ++i) {
+        coords.push_back(Coord(i32(i), -i32(i) - 7));
+    }
+    return coords;
+}
+
+static void
+AddArray(ArrayFileWriter *pWriter, const char *name, const std::vector<float> &items, ArrayLayout)
+{
+    pWriter->AddFloats(name, items.data(), items.size());
+}
+
+static void
+AddArray(ArrayFileWriter *pWriter, const char *name, const std::vector<Vec2> &items, ArrayLayout layout)
+{
+    pWriter->AddVec2s(name, items.data(), items.size(), layout);
+}
+
+static void
+AddArray(ArrayFileWriter *pWriter, const char *name, const std::vector<Rect> &items, ArrayLayout layout)
+{
+    pWriter->AddRects(name, items.data(), items.size(), layout);
+}
+
+static void
+AddArray(ArrayFileWriter *pWriter, const char *name, const std::vector<Coord> &items, ArrayLayout layout)
+{
+    pWriter->AddCoords(name, items.data(), items.size(), layout);
+}
+
+static ArraySpan<float> GetArray(const ArrayFileReader &reader, const char *name, float) { return reader.GetFloats(name); }
+static ArraySpan<Vec2 > GetArray(const ArrayFileReader &reader, const char *name, Vec2 ) { return reader.GetVec2s (name); }
+static ArraySpan<Rect > GetArray(const ArrayFileReader &reader, const char *name, Rect ) { return reader.GetRects (name); }
+static ArraySpan<Coord> GetArray(const ArrayFileReader &reader, const char *name, Coord) { return reader.GetCoords(name); }
+
+///-----------------------------------------------------------------------------
+/// @brief Writes the items in both layouts and reads them back - SoA of
+///   a single lane type is stored as AoS.
+template <typename T>
+static bool
+CheckRoundTrip(const std::vector<T> &items)
+{
+    typedef detail::ArrayTraits<T>  Traits;
+    typedef typename Traits::Lane   Lane;
+
+    ArrayFileWriter writer;
+    AddArray(&writer, "aos", items, ArrayLayout::AoS);
+    AddArray(&writer, "soa", items, ArrayLayout::SoA);
+
+    auto file = writer.Build();
+
+    ArrayFileReader reader;
+    if(reader.OpenMemory(file.data(), file.size()) != ArrayFileError::None) {
+        return false;
+    }
+
+    auto aos = GetArray(reader, "aos", T());
+    if(aos.size() != items.size() || std::memcmp(aos.pData, items.data(), sizeof(T) * items.size()) != 0) {
+        return false;
+    }
+
+    if(Traits::kLanes == 1) {
+        return GetArray(reader, "soa", T()).size() == items.size();
+    }
+
+    // Stored as SoA, so there's no AoS view of it.
+    if(!GetArray(reader, "soa", T()).empty()) {
+        return false;
+    }
+
+    for(u32 lane = 0; lane < Traits::kLanes; ++lane) {
+        auto values = reader.GetLane<T>("soa", lane);
+        auto offset = size_t(reinterpret_cast<const u8*>(values.pData) - file.data());
+        if(values.size() != items.size() || offset % ArrayFileHeader::kAlignment != 0) {
+            return false;
+        }
+
+        for(size_t i = 0; i < items.size(); ++i) {
+            Lane expected;
+            std::memcpy(&expected, reinterpret_cast<const u8*>(&items[i]) + sizeof(Lane) * lane, sizeof(Lane));
+            if(values[i] != expected) {
+                return false;
+            }
+        }
+    }
+    return reader.GetLane<T>("soa", Traits::kLanes).empty();
+}
+
+static std::vector<u8>
+BuildFile()
+{
+    auto rects = MakeRects();
+    auto vec2s = MakeVec2s();
+
+    ArrayFileWriter writer;
+    writer.AddVec2s("vec2s", vec2s.data(), vec2s.size());
+    writer.AddRects("rects", rects.data(), rects.size(), ArrayLayout::SoA);
+    return writer.Build();
+}
+
+static ArrayFileSection*
+GetSections(std::vector<u8> *pFile)
+{
+    return reinterpret_cast<ArrayFileSection*>(pFile->data() + sizeof(ArrayFileHeader));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Opens the file without the checksum, so the checks behind it run.
+static ArrayFileError
+OpenUnverified(const std::vector<u8> &file)
+{
+    ArrayFileReader reader;
+    return reader.OpenMemory(file.data(), file.size(), false);
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("Float",  CheckRoundTrip(MakeFloats()));
+    passed &= Check("Vec2",   CheckRoundTrip(MakeVec2s ()));
+    passed &= Check("Rect",   CheckRoundTrip(MakeRects ()));
+    passed &= Check("Coord",  CheckRoundTrip(MakeCoords()));
+    passed &= Check("Empty",  CheckRoundTrip(std::vector<Vec2>()));
+
+    auto file = BuildFile();
+    ArrayFileReader reader;
+
+    RectSoA soa;
+    passed &= Check("RectSoA",
+        reader.OpenMemory(file.data(), file.size()) == ArrayFileError::None
+        && reader.GetRectSoA("rects", &soa)
+        && soa.count == kItemsCount
+        && soa.pH[10] == 40.0f
+        && !reader.GetRectSoA("vec2s", &soa)
+    );
+
+    // Cut at a section boundary and inside the header.
+    passed &= Check("Truncated",
+        reader.OpenMemory(file.data(), file.size() - 64) == ArrayFileError::BadSize
+        && reader.OpenMemory(file.data(), sizeof(ArrayFileHeader) - 1) == ArrayFileError::TooSmall
+        && !reader.IsOpen()
+    );
+
+    passed &= Check("Misaligned buffer",
+        reader.OpenMemory(file.data() + 1, file.size() - 1) == ArrayFileError::Misaligned
+    );
+
+    auto bad_section = true;
+    {
+        auto copy = file;
+        GetSections(&copy)[0].offset += 4;
+        bad_section &= OpenUnverified(copy) == ArrayFileError::BadSection;
+
+        copy = file;
+        GetSections(&copy)[0].offset = u64(copy.size()) + ArrayFileHeader::kAlignment;
+        bad_section &= OpenUnverified(copy) == ArrayFileError::BadSection;
+
+        copy = file;
+        GetSections(&copy)[0].count = ~u64(0);
+        bad_section &= OpenUnverified(copy) == ArrayFileError::BadSection;
+
+        copy = file;
+        GetSections(&copy)[1].count = GetSections(&copy)[1].laneStride / sizeof(float) + 1;
+        bad_section &= OpenUnverified(copy) == ArrayFileError::BadSection;
+
+        copy = file;
+        GetSections(&copy)[1].laneStride += 4;
+        bad_section &= OpenUnverified(copy) == ArrayFileError::BadSection;
+
+        copy = file;
+        GetSections(&copy)[1].laneStride = u64(1) << 62;
+        bad_section &= OpenUnverified(copy) == ArrayFileError::BadSection;
+
+        copy = file;
+        GetSections(&copy)[1].type = 0;
+        bad_section &= OpenUnverified(copy) == ArrayFileError::BadSection;
+    }
+    passed &= Check("Bad section", bad_section);
+
+    auto flipped = file;
+    flipped[flipped.size() / 2] ^= 0x10;
+    passed &= Check("Flipped byte",
+        reader.OpenMemory(flipped.data(), flipped.size()) == ArrayFileError::BadChecksum
+        && OpenUnverified(flipped) == ArrayFileError::None
+    );
+
+    auto swapped = file;
+    reinterpret_cast<ArrayFileHeader*>(swapped.data())->endianMarker = 0x04030201u;
+    passed &= Check("Endianness",
+        reader.OpenMemory(swapped.data(), swapped.size()) == ArrayFileError::BadEndianness
+    );
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,195 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BitsTest.cpp                                                  //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Bits.h against a loop that goes one bit at a time - Every 8 and 16      //
+//    bit value, and the values around each power of two of the 32 and 64     //
+//    bit types. Both the dispatched functions and the portable ones.         //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Reference                                                                  //
+//----------------------------------------------------------------------------//
+static i32
+RefPopCount(u64 x)
+{
+    auto count = 0;
+    for(; x != 0; x >>= 1) {
+        count += i32(x & 1u);
+    }
+    return count;
+}
+
+static i32
+RefLog2Floor(u64 x)
+{
+    auto log2 = -1;
+    for(; x != 0; x >>= 1) {
+        ++log2;
+    }
+    return log2;
+}
+
+static i32
+RefCountTrailingZeros(u64 x, i32 bits)
+{
+    auto count = 0;
+    while(count < bits && ((x >> count) & 1u) == 0) {
+        ++count;
+    }
+    return count;
+}
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+template <typename T>
+static bool
+CheckValue(T value)
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+
+    auto bits     = detail::BitsOf<T>::kBits;
+    auto u        = u64(U(value));
+    auto max      = u64(std::numeric_limits<T>::max());
+    auto negative = (u > max);
+
+    auto log2_floor = RefLog2Floor(u);
+    auto log2_ceil  = (u <= 1) ? log2_floor : RefLog2Floor(u - 1) + 1;
+
+    // 0 when it doesn't fit in T - The sign bit of a signed T included.
+    auto next_pot = (u <= 1) ? u64(1) : (log2_ceil >= 64) ? u64(0) : (u64(1) << log2_ceil);
+    if(next_pot > max) {
+        next_pot = 0;
+    }
+    auto prev_pot = (u == 0 || negative) ? u64(0) : (u64(1) << log2_floor);
+
+    auto passed = PopCount          (value)   == RefPopCount(u)
+               && CountLeadingZeros (value)   == (bits - 1) - log2_floor
+               && CountTrailingZeros(value)   == RefCountTrailingZeros(u, bits)
+               && Log2Floor         (value)   == log2_floor
+               && Log2Ceil          (value)   == log2_ceil
+               && u64(U(NextPOT     (value))) == next_pot
+               && u64(U(PrevPOT     (value))) == prev_pot
+               && IsPOT             (value)   == (!negative && RefPopCount(u) == 1);
+
+    if(!passed) {
+        std::printf("  wrong for 0x%llx (%d bits)\n", (unsigned long long)u, bits);
+    }
+    return passed;
+}
+
+static bool
+CheckPortable(u64 x)
+{
+    auto x32 = u32(x);
+    return detail::SoftPopCount32(x32) == RefPopCount(x32)
+        && detail::SoftPopCount64(x)   == RefPopCount(x)
+        && detail::SoftClz32     (x32) == 31 - RefLog2Floor(x32)
+        && detail::SoftClz64     (x)   == 63 - RefLog2Floor(x)
+        && detail::SoftCtz32     (x32) == RefCountTrailingZeros(x32, 32)
+        && detail::SoftCtz64     (x)   == RefCountTrailingZeros(x,   64);
+}
+
+template <typename T>
+static bool
+CheckAllValues()
+{
+    auto passed = true;
+    for(auto v = i64(std::numeric_limits<T>::min()); v <= i64(std::numeric_limits<T>::max()); ++v) {
+        passed &= CheckValue(T(v));
+        passed &= CheckPortable(u64(v));
+    }
+    return passed;
+}
+
+template <typename T>
+static bool
+CheckEdgeValues()
+{
+    typedef typename detail::BitsOf<T>::Unsigned U;
+
+    auto passed = true;
+    for(auto i = 0; i < detail::BitsOf<T>::kBits; ++i) {
+        auto pot = U(U(1) << i);
+        for(auto value : { U(pot - 1u), pot, U(pot + 1u) }) {
+            passed &= CheckValue(T(value));
+            passed &= CheckPortable(u64(value));
+        }
+    }
+
+    // Random values have their highest bit all over the place.
+    std::mt19937_64 rng(1);
+    for(auto i = 0; i < 100000; ++i) {
+        auto value = U(rng() >> (rng() % detail::BitsOf<T>::kBits));
+        passed &= CheckValue(T(value));
+        passed &= CheckPortable(u64(value));
+    }
+
+    return passed
+        && CheckValue(std::numeric_limits<T>::min())
+        && CheckValue(std::numeric_limits<T>::max());
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("u8  (all)",   CheckAllValues<u8 >());
+    passed &= Check("i8  (all)",   CheckAllValues<i8 >());
+    passed &= Check("u16 (all)",   CheckAllValues<u16>());
+    passed &= Check("i16 (all)",   CheckAllValues<i16>());
+    passed &= Check("u32 (edges)", CheckEdgeValues<u32>());
+    passed &= Check("i32 (edges)", CheckEdgeValues<i32>());
+    passed &= Check("u64 (edges)", CheckEdgeValues<u64>());
+    passed &= Check("i64 (edges)", CheckEdgeValues<i64>());
+
+    passed &= Check("AlignUp",
+        AlignUp(u32(0),  u32(16)) == 0  && AlignUp(u32(1),  u32(16)) == 16 &&
+        AlignUp(u32(16), u32(16)) == 16 && AlignUp(u32(17), u32(16)) == 32
+    );
+    passed &= Check("AlignDown",
+        AlignDown(u32(15), u32(16)) == 0 && AlignDown(u32(31), u32(16)) == 16 &&
+        AlignDown(i32(-1), i32(16)) == -16
+    );
+    passed &= Check("IsAligned", IsAligned(u64(64), u64(64)) && !IsAligned(u64(65), u64(64)));
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,302 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BoundsTest.cpp                                                //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ComputeBounds, ComputeConvexHull(Parallel) and ComputeBoundingCircle    //
+//    against brute force - Every pair of points tested as a hull edge and    //
+//    every circle through 2 or 3 points tested as the bounding one.          //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr i32 kTrialsCount = 200;
+
+// The brute force hull is O(n^3) and the circle O(n^4).
+constexpr size_t kMaxHullPoints   = 150;
+constexpr size_t kMaxCirclePoints = 30;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+typedef std::pair<std::pair<float, float>, std::pair<float, float>> Edge;
+
+static Edge
+MakeEdge(const Vec2 &a, const Vec2 &b)
+{
+    return Edge(std::make_pair(a.x, a.y), std::make_pair(b.x, b.y));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Integer coordinates in [-range, range], so the crosses are exact
+///   and there's plenty of repeated and collinear points.
+static std::vector<Vec2>
+MakeGridPoints(size_t count, i32 range, std::mt19937 *pRng)
+{
+    std::uniform_int_distribution<i32> coordinate(-range, range);
+
+    std::vector<Vec2> points(count);
+    for(auto &point : points) {
+        point = Vec2(float(coordinate(*pRng)), float(coordinate(*pRng)));
+    }
+    return points;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief a -> b is a hull edge when every point is on its left, or on the
+///   segment itself - Sorted, so the start vertex doesn't matter.
+static std::vector<Edge>
+GetBruteHullEdges(const std::vector<Vec2> &points)
+{
+    std::vector<Edge> edges;
+    for(const auto &a : points) {
+        for(const auto &b : points) {
+            if(a.x == b.x && a.y == b.y) {
+                continue;
+            }
+
+            auto is_edge = true;
+            for(const auto &p : points) {
+                auto side = Cross(b - a, p - a);
+                if(side < 0.0f || (side == 0.0f && Dot(p - a, b - a) < 0.0f)
+                || (side == 0.0f && Dot(p - b, a - b) < 0.0f))
+                {
+                    is_edge = false;
+                    break;
+                }
+            }
+            if(is_edge) {
+                edges.push_back(MakeEdge(a, b));
+            }
+        }
+    }
+
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+    return edges;
+}
+
+static std::vector<Edge>
+GetHullEdges(const std::vector<Vec2> &hull)
+{
+    std::vector<Edge> edges;
+    for(size_t i = 0; i < hull.size(); ++i) {
+        edges.push_back(MakeEdge(hull[i], hull[(i + 1) % hull.size()]));
+    }
+    std::sort(edges.begin(), edges.end());
+    return edges;
+}
+
+static bool
+CheckHulls()
+{
+    std::mt19937 rng(3);
+    for(i32 trial = 0; trial < kTrialsCount; ++trial) {
+        auto count  = size_t(1 + rng() % kMaxHullPoints);
+        auto range  = (trial % 3 == 0) ? 4 : 100;
+        auto points = MakeGridPoints(count, range, &rng);
+
+        std::vector<Vec2> hull;
+        std::vector<Vec2> parallel_hull;
+        ComputeConvexHull        (points.data(), count, &hull);
+        ComputeConvexHullParallel(points.data(), count, &parallel_hull, 16);
+
+        auto brute = GetBruteHullEdges(points);
+
+        // All on a line - The brute force has the segment both ways.
+        if(hull.size() < 3) {
+            if(brute.size() > 2 || parallel_hull.size() >= 3) {
+                std::printf("  trial %d: degenerate hull\n", trial);
+                return false;
+            }
+            continue;
+        }
+
+        if(GetHullEdges(hull) != brute || GetHullEdges(parallel_hull) != brute) {
+            std::printf("  trial %d: %zu points, %zu / %zu hull edges, %zu expected\n",
+                trial, count, hull.size(), parallel_hull.size(), brute.size());
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+CheckBounds()
+{
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+
+    for(i32 trial = 0; trial < kTrialsCount; ++trial) {
+        std::vector<Vec2> points(1 + rng() % 1000);
+        for(auto &point : points) {
+            point = Vec2(coordinate(rng), coordinate(rng));
+        }
+
+        auto left   = points[0].x; auto right  = points[0].x;
+        auto top    = points[0].y; auto bottom = points[0].y;
+        for(const auto &point : points) {
+            left   = std::min(left,   point.x); right  = std::max(right,  point.x);
+            top    = std::min(top,    point.y); bottom = std::max(bottom, point.y);
+        }
+
+        auto bounds = ComputeBounds(points.data(), points.size());
+        if(bounds.x != left || bounds.y != top
+        || std::fabs(bounds.GetRight () - right ) > 1e-4f
+        || std::fabs(bounds.GetBottom() - bottom) > 1e-4f)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+IsInside(const Vec2 &point, double x, double y, double radius)
+{
+    auto dx = double(point.x) - x;
+    auto dy = double(point.y) - y;
+    return std::sqrt(dx * dx + dy * dy) <= radius * (1.0 + 1e-9) + 1e-9;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Radius of the smallest circle through 2 or 3 of the points that
+///   holds them all - The smallest circle always is one of those.
+static double
+GetBruteCircleRadius(const std::vector<Vec2> &points)
+{
+    auto best      = std::numeric_limits<double>::infinity();
+    auto holds_all = [&points](double x, double y, double radius) {
+        for(const auto &point : points) {
+            if(!IsInside(point, x, y, radius)) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    auto count = points.size();
+    for(size_t i = 0; i < count; ++i) {
+        for(size_t j = i + 1; j < count; ++j) {
+            auto x = (double(points[i].x) + double(points[j].x)) * 0.5;
+            auto y = (double(points[i].y) + double(points[j].y)) * 0.5;
+            auto r = std::hypot(double(points[i].x) - x, double(points[i].y) - y);
+            if(r < best && holds_all(x, y, r)) {
+                best = r;
+            }
+
+            for(size_t k = j + 1; k < count; ++k) {
+                double ax = points[i].x, ay = points[i].y;
+                double bx = points[j].x, by = points[j].y;
+                double cx = points[k].x, cy = points[k].y;
+
+                auto d = 2.0 * (ax * (by - cy) + bx * (cy - ay) + cx * (ay - by));
+                if(d == 0.0) {
+                    continue;
+                }
+
+                auto a_sqr = ax * ax + ay * ay;
+                auto b_sqr = bx * bx + by * by;
+                auto c_sqr = cx * cx + cy * cy;
+                auto ux    = (a_sqr * (by - cy) + b_sqr * (cy - ay) + c_sqr * (ay - by)) / d;
+                auto uy    = (a_sqr * (cx - bx) + b_sqr * (ax - cx) + c_sqr * (bx - ax)) / d;
+                auto ur    = std::hypot(ax - ux, ay - uy);
+                if(ur < best && holds_all(ux, uy, ur)) {
+                    best = ur;
+                }
+            }
+        }
+    }
+    return (count <= 1) ? 0.0 : best;
+}
+
+static bool
+CheckCircles()
+{
+    std::mt19937 rng(5);
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+
+    for(i32 trial = 0; trial < kTrialsCount; ++trial) {
+        std::vector<Vec2> points(1 + rng() % kMaxCirclePoints);
+        for(auto &point : points) {
+            point = Vec2(coordinate(rng), coordinate(rng));
+        }
+
+        auto circle    = ComputeBoundingCircle(points.data(), points.size());
+        auto tolerance = 1e-4f * std::max(1.0f, circle.radius);
+
+        // Holds them all and touches at least two.
+        auto touching = 0;
+        for(const auto &point : points) {
+            auto distance = circle.center.Distance(point);
+            if(distance > circle.radius + tolerance) {
+                std::printf("  trial %d: point out by %g\n", trial, distance - circle.radius);
+                return false;
+            }
+            touching += (std::fabs(distance - circle.radius) <= tolerance) ? 1 : 0;
+        }
+        if(points.size() > 1 && touching < 2) {
+            std::printf("  trial %d: touches %d points\n", trial, touching);
+            return false;
+        }
+
+        auto brute = GetBruteCircleRadius(points);
+        if(std::fabs(double(circle.radius) - brute) > double(tolerance)) {
+            std::printf("  trial %d: radius %g, smallest %g\n", trial, circle.radius, brute);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("ComputeBounds",         CheckBounds ());
+    passed &= Check("ComputeConvexHull",     CheckHulls  ());
+    passed &= Check("ComputeBoundingCircle", CheckCircles());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,274 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ConvexPolygonTest.cpp                                         //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ConvexPolygon SAT Collide against testing every pair of edges - The     //
+//    MTV has to separate the shapes, and the RectSoA batch has to give the   //
+//    same hits as the scalar Collide.                                        //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr i32 kPairsCount = 20000;
+
+// Not a multiple of the SIMD width.
+constexpr size_t kRectsCount = 1003;
+
+// Pairs closer than this to touching can go either way.
+constexpr float kTouchTolerance = 1e-3f;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static bool
+SegmentsCross(const Vec2 &a, const Vec2 &b, const Vec2 &c, const Vec2 &d)
+{
+    auto side = [](const Vec2 &p, const Vec2 &q, const Vec2 &r) {
+        return Cross(q - p, r - p);
+    };
+
+    auto d1 = side(c, d, a);
+    auto d2 = side(c, d, b);
+    auto d3 = side(a, b, c);
+    auto d4 = side(a, b, d);
+    return ((d1 > 0.0f && d2 < 0.0f) || (d1 < 0.0f && d2 > 0.0f))
+        && ((d3 > 0.0f && d4 < 0.0f) || (d3 < 0.0f && d4 > 0.0f));
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Overlapping convex polygons have crossing edges, or one is
+///   inside of the other.
+static bool
+BruteCollide(const ConvexPolygon &a, const ConvexPolygon &b)
+{
+    auto a_count = a.GetVertexCount();
+    auto b_count = b.GetVertexCount();
+    for(i32 i = 0; i < a_count; ++i) {
+        for(i32 j = 0; j < b_count; ++j) {
+            if(SegmentsCross(a.GetVertex(i), a.GetVertex((i + 1) % a_count),
+                             b.GetVertex(j), b.GetVertex((j + 1) % b_count)))
+            {
+                return true;
+            }
+        }
+    }
+    return a.Contains(b.GetVertex(0)) || b.Contains(a.GetVertex(0));
+}
+
+static float
+GetDistance(const ConvexPolygon &poly, const Vec2 &point)
+{
+    auto best = std::numeric_limits<float>::max();
+    for(i32 i = 0; i < poly.GetVertexCount(); ++i) {
+        auto p    = poly.GetVertex(i);
+        auto edge = poly.GetVertex((i + 1) % poly.GetVertexCount()) - p;
+        auto t    = Clamp(Dot(point - p, edge) / Dot(edge, edge), 0.0f, 1.0f);
+        best = std::fmin(best, (p + edge * t).Distance(point));
+    }
+    return best;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Moved by a bit more than the MTV they don't collide, by a bit
+///   less they still do.
+template <typename CollideFunc>
+static bool
+IsMinimalMTV(const ConvexPolygon &poly, const Vec2 &mtv, CollideFunc collide)
+{
+    auto length = mtv.Magnitude();
+    if(length < kTouchTolerance) {
+        return true;
+    }
+
+    auto direction = mtv * (1.0f / length);
+
+    auto past = poly;
+    past.Translate(mtv + direction * kTouchTolerance);
+
+    auto short_of = poly;
+    short_of.Translate(mtv - direction * kTouchTolerance);
+
+    return !collide(past) && collide(short_of);
+}
+
+static bool
+CheckPolygons()
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> size    (0.5f, 4.0f);
+    std::uniform_real_distribution<float> degrees (0.0f, 360.0f);
+
+    for(i32 i = 0; i < kPairsCount; ++i) {
+        auto a = ConvexPolygon::MakeRegular(Vec2(position(rng), position(rng)), size(rng), 3 + i % 6, degrees(rng));
+        auto b = ConvexPolygon::MakeBox    (Vec2(position(rng), position(rng)), Vec2(size(rng), size(rng)), degrees(rng));
+
+        auto mtv = Vec2::Zero();
+        auto hit = Collide(a, b, &mtv);
+        if(hit != BruteCollide(a, b)) {
+            std::printf("  pair %d: Collide %d\n", i, hit);
+            return false;
+        }
+
+        auto collide = [&b](const ConvexPolygon &poly) { return Collide(poly, b); };
+        if(hit && !IsMinimalMTV(a, mtv, collide)) {
+            std::printf("  pair %d: MTV (%g, %g)\n", i, mtv.x, mtv.y);
+            return false;
+        }
+    }
+    return true;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief The Rect overload is the polygon one with FromRect.
+static bool
+CheckRects()
+{
+    std::mt19937 rng(2);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> size    (0.5f, 8.0f);
+    std::uniform_real_distribution<float> degrees (0.0f, 360.0f);
+
+    for(i32 i = 0; i < kPairsCount; ++i) {
+        auto poly = ConvexPolygon::MakeRegular(Vec2(position(rng), position(rng)), size(rng), 3 + i % 6, degrees(rng));
+        auto rect = Rect(position(rng), position(rng), size(rng), size(rng));
+
+        auto rect_mtv = Vec2::Zero();
+        auto poly_mtv = Vec2::Zero();
+        auto rect_hit = Collide(poly, rect, &rect_mtv);
+        auto poly_hit = Collide(poly, ConvexPolygon::FromRect(rect), &poly_mtv);
+        if(rect_hit != poly_hit || (rect_hit && (rect_mtv - poly_mtv).Magnitude() > kTouchTolerance)) {
+            std::printf("  pair %d: Rect %d, polygon %d\n", i, rect_hit, poly_hit);
+            return false;
+        }
+
+        auto collide = [&rect](const ConvexPolygon &moved) { return Collide(moved, rect); };
+        if(rect_hit && !IsMinimalMTV(poly, rect_mtv, collide)) {
+            std::printf("  pair %d: MTV (%g, %g)\n", i, rect_mtv.x, rect_mtv.y);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+CheckCircles()
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> size    (0.5f, 4.0f);
+    std::uniform_real_distribution<float> degrees (0.0f, 360.0f);
+
+    for(i32 i = 0; i < kPairsCount; ++i) {
+        auto poly   = ConvexPolygon::MakeRegular(Vec2(position(rng), position(rng)), size(rng), 3 + i % 6, degrees(rng));
+        auto center = Vec2(position(rng), position(rng));
+        auto radius = size(rng);
+
+        auto mtv      = Vec2::Zero();
+        auto hit      = Collide(poly, center, radius, &mtv);
+        auto distance = GetDistance(poly, center);
+        if(hit != (poly.Contains(center) || distance < radius) && std::fabs(distance - radius) > kTouchTolerance) {
+            std::printf("  pair %d: Collide %d\n", i, hit);
+            return false;
+        }
+
+        auto collide = [&center, radius](const ConvexPolygon &moved) { return Collide(moved, center, radius); };
+        if(hit && !IsMinimalMTV(poly, mtv, collide)) {
+            std::printf("  pair %d: MTV (%g, %g)\n", i, mtv.x, mtv.y);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+CheckBatch()
+{
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> size    (0.5f, 4.0f);
+
+    std::vector<float> x(kRectsCount), y(kRectsCount), w(kRectsCount), h(kRectsCount);
+    for(size_t i = 0; i < kRectsCount; ++i) {
+        x[i] = position(rng);
+        y[i] = position(rng);
+        w[i] = size(rng);
+        h[i] = size(rng);
+    }
+
+    for(auto degrees : { 0.0f, 33.0f, 45.0f }) {
+        auto poly = ConvexPolygon::MakeBox(Vec2(1.0f, 2.0f), Vec2(3.0f, 1.5f), degrees);
+
+        // Every count up to a few SIMD widths, then all of them.
+        for(auto count : { size_t(1), size_t(simd::kWidth - 1), size_t(simd::kWidth + 1), kRectsCount }) {
+            std::vector<u8> hits(count, 2);
+            auto hits_count = Collide(poly, RectSoA{ x.data(), y.data(), w.data(), h.data(), count }, hits.data());
+
+            size_t scalar_count = 0;
+            for(size_t i = 0; i < count; ++i) {
+                auto hit = Collide(poly, Rect(x[i], y[i], w[i], h[i]));
+                scalar_count += hit ? 1 : 0;
+                if(hits[i] != (hit ? 1 : 0)) {
+                    std::printf("  rect %zu of %zu\n", i, count);
+                    return false;
+                }
+            }
+            if(hits_count != scalar_count) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("Polygon x Polygon", CheckPolygons());
+    passed &= Check("Polygon x Rect",    CheckRects   ());
+    passed &= Check("Polygon x Circle",  CheckCircles ());
+    passed &= Check("Polygon x RectSoA", CheckBatch   ());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,36 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Cxx11HeadersTest.cpp                                          //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Built as C++11 (see CMakeLists.txt) - Every header has to compile      //
+//    there, where ACOW_CONSTEXPR_LOOSE is empty. Building is the test.       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdlib>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,69 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : DeterministicMathTest.cpp                                     //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    The runtime side of the deterministic functions against the golden      //
+//    values - The static_assert in DeterministicMath.h only sees the         //
+//    compiler's constant evaluation, this sees the flags of the build.       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-32s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+static bool
+IsNaNSinCos(float radians)
+{
+    auto s = 0.0f;
+    auto c = 0.0f;
+    DetSinCos(radians, &s, &c);
+    return (s != s) && (c != c);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto inf = std::numeric_limits<float>::infinity();
+
+    auto passed = true;
+    passed &= Check("Golden values",          VerifyDeterministicMath());
+    passed &= Check("DetSinCos(NaN) is NaN",  IsNaNSinCos(std::numeric_limits<float>::quiet_NaN()));
+    passed &= Check("DetSinCos(inf) is NaN",  IsNaNSinCos(inf) && IsNaNSinCos(-inf));
+    passed &= Check("DetSinCos(1e30) is NaN", IsNaNSinCos(1e30f));
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
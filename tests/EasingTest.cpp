@@ -0,0 +1,157 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : EasingTest.cpp                                                //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    EasingTable against the exact curves - The max error of the default     //
+//    tables has to stay in the bounds that Easing.h documents.               //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Probes per table - Many between each pair of samples.
+constexpr i32 kProbesCount = 1 << 18;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Max |table - exact| over [0, 1], single and bulk Evaluate.
+///   The bulk probes go past [0, 1] on both sides to test the clamping.
+template <typename Func>
+static double
+GetMaxError(const EasingTable &table, Func func)
+{
+    auto max_error = 0.0;
+    for(i32 i = 0; i <= kProbesCount; ++i) {
+        auto t = float(i) / float(kProbesCount);
+        max_error = std::fmax(max_error, std::fabs(double(table(t)) - double(func(t))));
+    }
+
+    auto t      = std::vector<float>(kProbesCount);
+    auto values = std::vector<float>(kProbesCount);
+    for(i32 i = 0; i < kProbesCount; ++i) {
+        t[i] = -0.1f + 1.2f * (float(i) / float(kProbesCount - 1));
+    }
+    table.Evaluate(t.data(), t.size(), values.data());
+
+    for(i32 i = 0; i < kProbesCount; ++i) {
+        auto exact = func(Clamp(t[i], 0.0f, 1.0f));
+        max_error  = std::fmax(max_error, std::fabs(double(values[i]) - double(exact)));
+    }
+    return max_error;
+}
+
+template <typename Func>
+static bool
+Check(const char *name, const EasingTable &table, Func func, double bound)
+{
+    auto max_error = GetMaxError(table, func);
+    auto passed    = (max_error <= bound);
+
+    std::printf("%-24s max error %.3e (bound %.0e) %s\n", name, max_error, bound, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    struct Curve
+    {
+        const char *name;
+        EasingType  type;
+        double      bound;
+    };
+
+    // The bounds of the Easing Table section of Easing.h.
+    const Curve curves[] = {
+        {"Linear",       EasingType::Linear,       EasingTable::kPolynomialMaxError},
+        {"QuadIn",       EasingType::QuadIn,       EasingTable::kPolynomialMaxError},
+        {"QuadOut",      EasingType::QuadOut,      EasingTable::kPolynomialMaxError},
+        {"QuadInOut",    EasingType::QuadInOut,    EasingTable::kPolynomialMaxError},
+        {"CubicIn",      EasingType::CubicIn,      EasingTable::kPolynomialMaxError},
+        {"CubicOut",     EasingType::CubicOut,     EasingTable::kPolynomialMaxError},
+        {"CubicInOut",   EasingType::CubicInOut,   EasingTable::kPolynomialMaxError},
+        {"ExpoIn",       EasingType::ExpoIn,       EasingTable::kExponentialMaxError},
+        {"ExpoOut",      EasingType::ExpoOut,      EasingTable::kExponentialMaxError},
+        {"ExpoInOut",    EasingType::ExpoInOut,    EasingTable::kExponentialMaxError},
+        {"ElasticIn",    EasingType::ElasticIn,    EasingTable::kExponentialMaxError},
+        {"ElasticOut",   EasingType::ElasticOut,   EasingTable::kExponentialMaxError},
+        {"ElasticInOut", EasingType::ElasticInOut, EasingTable::kExponentialMaxError},
+        {"BounceIn",     EasingType::BounceIn,     EasingTable::kBounceMaxError    },
+        {"BounceOut",    EasingType::BounceOut,    EasingTable::kBounceMaxError    },
+        {"BounceInOut",  EasingType::BounceInOut,  EasingTable::kBounceMaxError    },
+    };
+
+    auto passed = true;
+    for(const auto &curve : curves) {
+        passed &= Check(curve.name, EasingTable(curve.type), GetEasingFunc(curve.type), curve.bound);
+    }
+
+    // CSS curves are cubics as well.
+    const auto beziers = {
+        CubicBezierEasing::Ease     (),
+        CubicBezierEasing::EaseIn   (),
+        CubicBezierEasing::EaseOut  (),
+        CubicBezierEasing::EaseInOut(),
+    };
+    for(const auto &bezier : beziers) {
+        passed &= Check("CubicBezier", EasingTable(bezier), bezier, EasingTable::kPolynomialMaxError);
+    }
+
+    // Error of the polynomials goes down with the square of the samples.
+    passed &= Check(
+        "CubicInOut (4x samples)",
+        EasingTable(EasingType::CubicInOut, 4 * EasingTable::kDefaultSamplesCount),
+        &EaseCubicInOut,
+        EasingTable::kPolynomialMaxError / 16.0
+    );
+
+    // NaN clamps to 0 in both overloads.
+    const auto table = EasingTable(EasingType::QuadOut);
+    const auto nan   = std::numeric_limits<float>::quiet_NaN();
+    float      t[]   = { nan, -nan, 0.5f };
+    float      values[3];
+    table.Evaluate(t, 3, values);
+
+    auto nan_passed = table(nan) == table(0.0f)
+                   && values[0]  == table(0.0f)
+                   && values[1]  == table(0.0f)
+                   && values[2]  == table(0.5f);
+
+    std::printf("%-24s %s\n", "NaN t", nan_passed ? "ok" : "FAILED");
+    passed &= nan_passed;
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
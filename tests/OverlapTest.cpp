@@ -0,0 +1,191 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : OverlapTest.cpp                                               //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Overlaps of Rect, Circle and OBB against the ConvexPolygon SAT, and     //
+//    the RectSoA / CircleSoA / OBBSoA batches against the scalar pairs.      //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr i32 kPairsCount = 50000;
+
+// Not a multiple of the SIMD width.
+constexpr size_t kShapesCount = 1003;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static ConvexPolygon
+ToPolygon(const OBB &box)
+{
+    auto u = box.GetAxisX() * box.halfExtents.x;
+    auto v = box.GetAxisY() * box.halfExtents.y;
+
+    const Vec2 vertices[4] = {
+        box.center - u - v,
+        box.center + u - v,
+        box.center + u + v,
+        box.center - u + v,
+    };
+    return ConvexPolygon(vertices, 4);
+}
+
+static bool
+CheckPairs()
+{
+    std::mt19937 rng(3);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> size    (0.3f, 4.0f);
+    std::uniform_real_distribution<float> degrees (0.0f, 360.0f);
+
+    for(i32 i = 0; i < kPairsCount; ++i) {
+        auto a      = OBB(Vec2(position(rng), position(rng)), Vec2(size(rng), size(rng)), degrees(rng));
+        auto b      = OBB(Vec2(position(rng), position(rng)), Vec2(size(rng), size(rng)), degrees(rng));
+        auto rect   = Rect(position(rng), position(rng), size(rng) * 2.0f, size(rng) * 2.0f);
+        auto circle = Circle(position(rng), position(rng), size(rng));
+
+        auto a_poly    = ToPolygon(a);
+        auto rect_poly = ConvexPolygon::FromRect(rect);
+        if(Overlaps(a,    b     ) != Collide(a_poly,    ToPolygon(b))
+        || Overlaps(a,    rect  ) != Collide(a_poly,    rect        )
+        || Overlaps(a,    circle) != Collide(a_poly,    circle      )
+        || Overlaps(rect, circle) != Collide(rect_poly, circle      ))
+        {
+            std::printf("  pair %d\n", i);
+            return false;
+        }
+
+        // Both orders.
+        if(Overlaps(a, b) != Overlaps(b, a) || Overlaps(a, rect) != Overlaps(rect, a)
+        || Overlaps(a, circle) != Overlaps(circle, a) || Overlaps(rect, circle) != Overlaps(circle, rect))
+        {
+            std::printf("  pair %d swapped\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+struct Shapes
+{
+    std::vector<float> x, y, w, h, radius, cos_a, sin_a;
+
+    RectSoA   GetRects  (size_t count) const { return RectSoA  { x.data(), y.data(), w.data(), h.data(), count }; }
+    CircleSoA GetCircles(size_t count) const { return CircleSoA{ x.data(), y.data(), radius.data(), count }; }
+    OBBSoA    GetOBBs   (size_t count) const { return OBBSoA   { x.data(), y.data(), w.data(), h.data(), cos_a.data(), sin_a.data(), count }; }
+}; // struct Shapes
+
+static Shapes
+MakeShapes()
+{
+    std::mt19937 rng(4);
+    std::uniform_real_distribution<float> position(-10.0f, 10.0f);
+    std::uniform_real_distribution<float> size    (0.3f, 4.0f);
+    std::uniform_real_distribution<float> degrees (0.0f, 360.0f);
+
+    Shapes shapes;
+    for(size_t i = 0; i < kShapesCount; ++i) {
+        auto s = 0.0f;
+        auto c = 0.0f;
+        SinCos(ToRadians(degrees(rng)), &s, &c);
+
+        shapes.x     .push_back(position(rng));
+        shapes.y     .push_back(position(rng));
+        shapes.w     .push_back(size(rng));
+        shapes.h     .push_back(size(rng));
+        shapes.radius.push_back(size(rng));
+        shapes.cos_a .push_back(c);
+        shapes.sin_a .push_back(s);
+    }
+    return shapes;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief The batch against Overlaps with each element of the SoA.
+template <typename TShape, typename TSoA>
+static bool
+CheckBatch(const TShape &shape, const TSoA &soa)
+{
+    std::vector<u8> hits(soa.count, 2);
+    auto hits_count = Overlaps(shape, soa, hits.data());
+
+    size_t scalar_count = 0;
+    for(size_t i = 0; i < soa.count; ++i) {
+        auto hit = Overlaps(shape, detail::GetElement(soa, i));
+        scalar_count += hit ? 1 : 0;
+        if(hits[i] != (hit ? 1 : 0)) {
+            std::printf("  element %zu of %zu\n", i, soa.count);
+            return false;
+        }
+    }
+    return hits_count == scalar_count;
+}
+
+template <typename TShape>
+static bool
+CheckBatches(const TShape &shape)
+{
+    static const auto shapes = MakeShapes();
+
+    auto passed = true;
+    for(auto count : { size_t(0), size_t(1), size_t(simd::kWidth - 1), size_t(simd::kWidth + 1), kShapesCount }) {
+        passed &= CheckBatch(shape, shapes.GetRects  (count));
+        passed &= CheckBatch(shape, shapes.GetCircles(count));
+        passed &= CheckBatch(shape, shapes.GetOBBs   (count));
+    }
+    return passed;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("Pairs",          CheckPairs());
+    passed &= Check("Rect batches",   CheckBatches(Rect(-2.0f, -3.0f, 6.0f, 5.0f)));
+    passed &= Check("Circle batches", CheckBatches(Circle(1.0f, 1.0f, 3.0f)));
+    passed &= Check("OBB batches",    CheckBatches(OBB(Vec2(0.0f, 1.0f), Vec2(4.0f, 2.0f), 25.0f)));
+
+    // Axis aligned OBB - Its axes are the same as the ones of the Rects.
+    passed &= Check("OBB batches (0 deg)", CheckBatches(OBB(Vec2(0.0f, 1.0f), Vec2(4.0f, 2.0f), 0.0f)));
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
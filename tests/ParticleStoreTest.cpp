@@ -0,0 +1,246 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ParticleStoreTest.cpp                                         //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    ParticleStore against a plain AoS of particles - Integrate with both    //
+//    integrators, IntegrateParallel, KillOutside, GatherInside and the       //
+//    swap with the last of RemoveDead.                                       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Not a multiple of the SIMD width nor of the grain.
+constexpr size_t kParticlesCount = 30011;
+constexpr size_t kGrainSize      = 1000;
+
+constexpr i32   kStepsCount = 10;
+constexpr float kDeltaTime  = 0.016f;
+
+// The SIMD lanes can fuse the multiply adds, the reference can't.
+constexpr float kPositionError = 1e-3f;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+struct Particle
+{
+    Vec2  position;
+    Vec2  velocity;
+    Vec2  acceleration;
+    float lifetime;
+}; // struct Particle
+
+static std::vector<Particle>
+MakeParticles(std::mt19937 *pRng)
+{
+    std::uniform_real_distribution<float> value   (-100.0f, 100.0f);
+    std::uniform_real_distribution<float> lifetime(-0.05f,  0.5f);
+
+    std::vector<Particle> particles(kParticlesCount);
+    for(auto &particle : particles) {
+        particle.position     = Vec2(value(*pRng), value(*pRng));
+        particle.velocity     = Vec2(value(*pRng), value(*pRng));
+        particle.acceleration = Vec2(value(*pRng) * 0.1f, value(*pRng) * 0.1f);
+        particle.lifetime     = lifetime(*pRng);
+    }
+    return particles;
+}
+
+static void
+Emit(const std::vector<Particle> &particles, ParticleStore *pStore)
+{
+    for(const auto &particle : particles) {
+        pStore->Emit(particle.position, particle.velocity, particle.acceleration, particle.lifetime);
+    }
+}
+
+static void
+Integrate(std::vector<Particle> *pParticles, float dt, ParticleStore::Integrator integrator)
+{
+    auto half_dt = (integrator == ParticleStore::Integrator::VelocityVerlet) ? dt * 0.5f : dt;
+    for(auto &particle : *pParticles) {
+        particle.position += (particle.velocity + particle.acceleration * half_dt) * dt;
+        particle.velocity += particle.acceleration * dt;
+        particle.lifetime -= dt;
+    }
+}
+
+static bool
+IsSame(const ParticleStore &store, size_t index, const Particle &particle, float error)
+{
+    return store.GetPosition    (index).Distance(particle.position)     <= error
+        && store.GetVelocity    (index).Distance(particle.velocity)     <= error
+        && store.GetAcceleration(index).Distance(particle.acceleration) == 0.0f
+        && std::fabs(store.GetLifetime(index) - particle.lifetime)      <= 1e-5f;
+}
+
+static bool
+CheckIntegrate(ParticleStore::Integrator integrator)
+{
+    std::mt19937 rng(1);
+    auto particles = MakeParticles(&rng);
+
+    ParticleStore store;
+    ParticleStore parallel_store;
+    Emit(particles, &store);
+    Emit(particles, &parallel_store);
+
+    for(i32 step = 0; step < kStepsCount; ++step) {
+        store         .Integrate        (kDeltaTime, integrator);
+        parallel_store.IntegrateParallel(kDeltaTime, integrator, kGrainSize);
+        Integrate(&particles, kDeltaTime, integrator);
+    }
+
+    for(size_t i = 0; i < kParticlesCount; ++i) {
+        if(!IsSame(store, i, particles[i], kPositionError)) {
+            std::printf("  particle %zu\n", i);
+            return false;
+        }
+
+        // Same lanes in the same chunks - Bit for bit.
+        if(!IsSame(parallel_store, i, Particle{
+            store.GetPosition(i), store.GetVelocity(i), store.GetAcceleration(i), store.GetLifetime(i)
+        }, 0.0f))
+        {
+            std::printf("  particle %zu (parallel)\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Verlet is exact for a constant acceleration.
+static bool
+CheckProjectile()
+{
+    ParticleStore store;
+    store.Emit(Vec2(0.0f, 0.0f), Vec2(1.0f, 2.0f), Vec2(0.0f, -9.8f), 10.0f);
+    for(i32 step = 0; step < 100; ++step) {
+        store.Integrate(0.01f, ParticleStore::Integrator::VelocityVerlet);
+    }
+
+    auto exact = Vec2(1.0f, 2.0f - 0.5f * 9.8f);
+    return store.GetPosition(0).Distance(exact) < 1e-4f;
+}
+
+static bool
+CheckCulling()
+{
+    std::mt19937 rng(2);
+    auto particles = MakeParticles(&rng);
+    auto bounds    = Rect(-50.0f, -40.0f, 100.0f, 70.0f);
+
+    ParticleStore store;
+    Emit(particles, &store);
+
+    // The fields start on a cache line.
+    for(size_t f = 0; f < ParticleStore::kFieldsCount; ++f) {
+        if(reinterpret_cast<uintptr_t>(store.GetField(ParticleStore::Field(f))) % 64 != 0) {
+            return false;
+        }
+    }
+
+    std::vector<u32> indices(kParticlesCount);
+    auto inside_count = store.GatherInside(bounds, indices.data());
+
+    size_t expected_count = 0;
+    for(size_t i = 0; i < kParticlesCount; ++i) {
+        if(!bounds.Contains(particles[i].position)) {
+            particles[i].lifetime = 0.0f;
+            continue;
+        }
+        if(expected_count >= inside_count || indices[expected_count] != u32(i)) {
+            std::printf("  GatherInside %zu\n", i);
+            return false;
+        }
+        ++expected_count;
+    }
+    if(inside_count != expected_count) {
+        return false;
+    }
+
+    store.KillOutside(bounds);
+    for(size_t i = 0; i < kParticlesCount; ++i) {
+        if(store.GetLifetime(i) != particles[i].lifetime) {
+            std::printf("  KillOutside %zu\n", i);
+            return false;
+        }
+    }
+
+    // The last one takes the place of each dead one.
+    size_t count = particles.size();
+    for(size_t i = 0; i < count;) {
+        if(particles[i].lifetime > 0.0f) {
+            ++i;
+            continue;
+        }
+        particles[i] = particles[--count];
+    }
+    particles.resize(count);
+
+    auto removed = store.RemoveDead();
+    if(removed != kParticlesCount - count || store.GetCount() != count) {
+        std::printf("  RemoveDead %zu, %zu expected\n", removed, kParticlesCount - count);
+        return false;
+    }
+    for(size_t i = 0; i < count; ++i) {
+        if(!IsSame(store, i, particles[i], 0.0f)) {
+            std::printf("  RemoveDead %zu\n", i);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("Euler",      CheckIntegrate(ParticleStore::Integrator::SemiImplicitEuler));
+    passed &= Check("Verlet",     CheckIntegrate(ParticleStore::Integrator::VelocityVerlet));
+    passed &= Check("Projectile", CheckProjectile());
+    passed &= Check("Culling",    CheckCulling());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,238 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SDLInteropTest.cpp                                            //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    The SDL conversions of Rect and SDLInterop.h against the scalar casts,  //
+//    std::floor and std::nearbyint - Built with ACOW_MATH_HAS_SDL_SUPPORT    //
+//    and the structs of tests/sdl_stand_in/SDL.h.                            //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static i32
+RoundScalar(float value, Rounding rounding)
+{
+    switch(rounding) {
+        case Rounding::Truncate: return i32(value);
+        case Rounding::Floor:    return i32(std::floor(value));
+        case Rounding::Nearest:  return i32(std::nearbyint(value));
+    }
+    return 0;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Halves first (negative ones included), then random values - So
+///   every count gets some of both.
+static std::vector<float>
+MakeValues(size_t count, std::mt19937 *pRng)
+{
+    std::uniform_real_distribution<float> value(-1000.0f, 1000.0f);
+
+    std::vector<float> values(count);
+    for(size_t i = 0; i < count; ++i) {
+        values[i] = (i % 2 == 0) ? float(i32(i % 16) - 8) + 0.5f : value(*pRng);
+    }
+    return values;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Counts around the SIMD width, so the tails are tested too.
+static std::vector<size_t>
+GetCounts()
+{
+    std::vector<size_t> counts = { 0, 1, 2, 3, 101 };
+    for(size_t width : { simd::kWidth, 2 * simd::kWidth, 3 * simd::kWidth }) {
+        counts.push_back(width - 1);
+        counts.push_back(width);
+        counts.push_back(width + 1);
+    }
+    return counts;
+}
+
+static bool
+CheckRects(Rounding rounding)
+{
+    std::mt19937 rng(9);
+    for(auto count : GetCounts()) {
+        auto values = MakeValues(count * 4, &rng);
+        auto rects  = std::vector<Rect>(count);
+        for(size_t i = 0; i < count; ++i) {
+            rects[i] = Rect(values[i * 4], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3]);
+        }
+
+        std::vector<SDL_Rect> sdl_rects(count);
+        ToIntRects(rects.data(), count, sdl_rects.data(), rounding);
+        for(size_t i = 0; i < count; ++i) {
+            const auto &sdl_rect = sdl_rects[i];
+            if(sdl_rect.x != RoundScalar(rects[i].x, rounding)
+            || sdl_rect.y != RoundScalar(rects[i].y, rounding)
+            || sdl_rect.w != RoundScalar(rects[i].w, rounding)
+            || sdl_rect.h != RoundScalar(rects[i].h, rounding))
+            {
+                std::printf("  rect %zu of %zu\n", i, count);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool
+CheckPoints(Rounding rounding)
+{
+    std::mt19937 rng(10);
+    for(auto count : GetCounts()) {
+        auto values = MakeValues(count * 2, &rng);
+        auto points = std::vector<Vec2>(count);
+        for(size_t i = 0; i < count; ++i) {
+            points[i] = Vec2(values[i * 2], values[i * 2 + 1]);
+        }
+
+        std::vector<SDL_Point> sdl_points(count);
+        ToIntPoints(points.data(), count, sdl_points.data(), rounding);
+        for(size_t i = 0; i < count; ++i) {
+            if(sdl_points[i].x != RoundScalar(points[i].x, rounding)
+            || sdl_points[i].y != RoundScalar(points[i].y, rounding))
+            {
+                std::printf("  point %zu of %zu\n", i, count);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief The float types and the way back are plain copies.
+static bool
+CheckRoundTrips(size_t count, std::mt19937 *pRng)
+{
+    auto values = MakeValues(count * 4, pRng);
+    auto rects  = std::vector<Rect>(count);
+    auto points = std::vector<Vec2>(count);
+    for(size_t i = 0; i < count; ++i) {
+        rects [i] = Rect(values[i * 4], values[i * 4 + 1], values[i * 4 + 2], values[i * 4 + 3]);
+        points[i] = Vec2(values[i * 4], values[i * 4 + 1]);
+    }
+
+    std::vector<SDL_FRect>  float_rects (count);
+    std::vector<SDL_FPoint> float_points(count);
+    std::vector<SDL_Rect>   int_rects   (count);
+    std::vector<SDL_Point>  int_points  (count);
+    std::vector<Rect>       rects_back  (count);
+    std::vector<Vec2>       points_back (count);
+
+    auto passed = true;
+
+    ToFloatRects  (rects.data(),       count, float_rects.data());
+    FromFloatRects(float_rects.data(), count, rects_back.data());
+    for(size_t i = 0; i < count; ++i) {
+        passed &= rects_back[i].x == rects[i].x && rects_back[i].y == rects[i].y
+               && rects_back[i].w == rects[i].w && rects_back[i].h == rects[i].h;
+    }
+
+    ToFloatPoints  (points.data(),       count, float_points.data());
+    FromFloatPoints(float_points.data(), count, points_back.data());
+    for(size_t i = 0; i < count; ++i) {
+        passed &= points_back[i].x == points[i].x && points_back[i].y == points[i].y;
+    }
+
+    ToIntRects  (rects.data(),     count, int_rects.data());
+    FromIntRects(int_rects.data(), count, rects_back.data());
+    for(size_t i = 0; i < count; ++i) {
+        passed &= rects_back[i].x == float(int_rects[i].x) && rects_back[i].y == float(int_rects[i].y)
+               && rects_back[i].w == float(int_rects[i].w) && rects_back[i].h == float(int_rects[i].h);
+    }
+
+    ToIntPoints  (points.data(),     count, int_points.data());
+    FromIntPoints(int_points.data(), count, points_back.data());
+    for(size_t i = 0; i < count; ++i) {
+        passed &= points_back[i].x == float(int_points[i].x) && points_back[i].y == float(int_points[i].y);
+    }
+
+    return passed;
+}
+
+static bool
+CheckRoundTrips()
+{
+    std::mt19937 rng(11);
+
+    auto passed = true;
+    for(auto count : GetCounts()) {
+        passed &= CheckRoundTrips(count, &rng);
+    }
+    return passed;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+
+    auto sdl_rect = SDL_Rect{ 1, -2, 3, 4 };
+    auto rect     = Rect(sdl_rect);
+    passed &= Check("Rect(SDL_Rect)",
+        rect.x == 1.0f && rect.y == -2.0f && rect.w == 3.0f && rect.h == 4.0f
+    );
+
+    auto back = SDL_Rect(rect);
+    passed &= Check("operator SDL_Rect",
+        back.x == sdl_rect.x && back.y == sdl_rect.y && back.w == sdl_rect.w && back.h == sdl_rect.h
+    );
+
+    // Truncates, same as ToIntRects by default.
+    auto halves    = Rect(-2.5f, 2.5f, -0.5f, 7.75f);
+    auto truncated = SDL_Rect(halves);
+    passed &= Check("operator SDL_Rect (cut)",
+        truncated.x == -2 && truncated.y == 2 && truncated.w == 0 && truncated.h == 7
+    );
+
+    passed &= Check("ToIntRects Truncate",  CheckRects (Rounding::Truncate));
+    passed &= Check("ToIntRects Floor",     CheckRects (Rounding::Floor   ));
+    passed &= Check("ToIntRects Nearest",   CheckRects (Rounding::Nearest ));
+    passed &= Check("ToIntPoints Truncate", CheckPoints(Rounding::Truncate));
+    passed &= Check("ToIntPoints Floor",    CheckPoints(Rounding::Floor   ));
+    passed &= Check("ToIntPoints Nearest",  CheckPoints(Rounding::Nearest ));
+    passed &= Check("Round trips",          CheckRoundTrips());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
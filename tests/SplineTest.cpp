@@ -0,0 +1,207 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SplineTest.cpp                                                //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    The forward differenced CubicBezier::Evaluate(count) against            //
+//    Evaluate(t) - In the error bound that Spline.h documents. Plus Split,   //
+//    Flatten and the arc length sampling of Spline.                          //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr i32 kCurvesCount = 200;
+
+// The low thousands of Evaluate(count).
+constexpr size_t kMaxCount = 2000;
+
+// Of the curve size.
+constexpr float kForwardDifferenceError = 1e-5f;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+static CubicBezier
+MakeCurve(std::mt19937 *pRng)
+{
+    std::uniform_real_distribution<float> coordinate(-100.0f, 100.0f);
+
+    auto point = [&]() { return Vec2(coordinate(*pRng), coordinate(*pRng)); };
+    return CubicBezier(point(), point(), point(), point());
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Largest side of the bounds of the control points.
+static float
+GetSize(const CubicBezier &curve)
+{
+    const Vec2 points[4] = { curve.p0, curve.p1, curve.p2, curve.p3 };
+    auto bounds = ComputeBounds(points, 4);
+    return std::max(bounds.w, bounds.h);
+}
+
+static float
+GetDistanceToPolyline(const Vec2 &point, const std::vector<Vec2> &polyline)
+{
+    auto best = point.Distance(polyline[0]);
+    for(size_t i = 0; i + 1 < polyline.size(); ++i) {
+        auto ab = polyline[i + 1] - polyline[i];
+        auto t  = Clamp(Dot(point - polyline[i], ab) / std::max(Dot(ab, ab), 1e-12f), 0.0f, 1.0f);
+        best = std::min(best, point.Distance(polyline[i] + ab * t));
+    }
+    return best;
+}
+
+static bool
+CheckForwardDifferences()
+{
+    std::mt19937 rng(1);
+
+    // Every small count, then random ones up to kMaxCount.
+    std::vector<size_t> counts;
+    for(size_t count = 0; count <= 40; ++count) {
+        counts.push_back(count);
+    }
+    for(i32 i = 0; i < kCurvesCount; ++i) {
+        counts.push_back(2 + rng() % (kMaxCount - 1));
+    }
+    counts.push_back(kMaxCount);
+
+    for(auto count : counts) {
+        auto curve     = MakeCurve(&rng);
+        auto tolerance = kForwardDifferenceError * GetSize(curve);
+
+        // One past the end, that has to be left alone.
+        std::vector<Vec2> points(count + 1, Vec2(1e30f, 1e30f));
+        curve.Evaluate(count, points.data());
+
+        for(size_t i = 0; i < count; ++i) {
+            auto t     = (count > 1) ? float(i) / float(count - 1) : 0.0f;
+            auto error = curve.Evaluate(t).Distance(points[i]);
+            if(error > tolerance) {
+                std::printf("  point %zu of %zu off by %g (bound %g)\n", i, count, error, tolerance);
+                return false;
+            }
+        }
+        if(points[count].x != 1e30f) {
+            std::printf("  wrote past %zu points\n", count);
+            return false;
+        }
+
+        // The ends are exact.
+        if(count >= 1 && (points[0].x != curve.p0.x || points[0].y != curve.p0.y)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+CheckSplitAndFlatten()
+{
+    std::mt19937 rng(2);
+    for(i32 i = 0; i < kCurvesCount; ++i) {
+        auto curve = MakeCurve(&rng);
+        auto size  = GetSize(curve);
+
+        // Both halves trace the curve.
+        CubicBezier left, right;
+        curve.Split(0.3f, &left, &right);
+        if(left .Evaluate(0.5f).Distance(curve.Evaluate(0.15f)) > 1e-5f * size
+        || right.Evaluate(0.5f).Distance(curve.Evaluate(0.65f)) > 1e-5f * size)
+        {
+            return false;
+        }
+
+        auto tolerance = 0.1f;
+        std::vector<Vec2> polyline;
+        curve.Flatten(tolerance, &polyline);
+        for(i32 s = 0; s <= 1000; ++s) {
+            auto point = curve.Evaluate(float(s) / 1000.0f);
+            if(GetDistanceToPolyline(point, polyline) > tolerance + 1e-3f) {
+                std::printf("  curve %d: Flatten off by more than %g\n", i, tolerance);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool
+CheckSpline()
+{
+    const Vec2 points[] = {
+        Vec2( 0.0f, 0.0f), Vec2(10.0f,  0.0f), Vec2(10.0f, 10.0f),
+        Vec2(20.0f, 10.0f), Vec2(30.0f, -5.0f), Vec2(40.0f,  0.0f),
+    };
+    auto spline = Spline::FromCatmullRom(points, 6, 64);
+
+    // Through the points.
+    for(i32 i = 0; i < 6; ++i) {
+        if(spline.Evaluate(float(i)).Distance(points[i]) > 1e-4f) {
+            return false;
+        }
+    }
+
+    // Evenly spaced is the same as by distance, and clamped on the ends.
+    std::vector<Vec2> samples(101);
+    spline.SampleEvenly(samples.size(), samples.data());
+    for(size_t i = 0; i < samples.size(); ++i) {
+        auto distance = spline.GetLength() * float(i) / 100.0f;
+        if(samples[i].Distance(spline.EvaluateAtDistance(distance)) > 1e-3f) {
+            return false;
+        }
+    }
+    return spline.EvaluateAtDistance(-5.0f).Distance(points[0]) < 1e-5f
+        && spline.EvaluateAtDistance(1e9f ).Distance(points[5]) < 1e-4f;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("Evaluate(count)",  CheckForwardDifferences());
+    passed &= Check("Split / Flatten",  CheckSplitAndFlatten   ());
+    passed &= Check("Spline",           CheckSpline            ());
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,318 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TileCollisionMapTest.cpp                                      //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    TileCollisionMap::MoveAndSlide against walls on every side, and the     //
+//    Raycast DDA against testing the segment with every solid tile - On a    //
+//    power of two tileSize and on one that isn't, away from the origin.      //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <limits>
+#include <random>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr i32 kRoomWidth  = 20;
+constexpr i32 kRoomHeight = 14;
+
+// Column of the wall in the middle of the room.
+constexpr i32 kWallColumn = 12;
+
+constexpr i32 kRaysCount = 20000;
+
+// In fractions of the segment - Rays that pass this close to a tile
+// corner can go through either of the tiles around it.
+constexpr double kRayTolerance = 1e-4;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+///-----------------------------------------------------------------------------
+/// @brief Solid border around the room, plus the wall at kWallColumn.
+static TileCollisionMap
+MakeRoom(float tileSize, const Vec2 &origin, bool withWall)
+{
+    TileCollisionMap map(kRoomWidth, kRoomHeight, tileSize, origin);
+    map.Fill(Coord(0,               0),              Coord(0,               kRoomWidth - 1), true);
+    map.Fill(Coord(kRoomHeight - 1, 0),              Coord(kRoomHeight - 1, kRoomWidth - 1), true);
+    map.Fill(Coord(0,               0),              Coord(kRoomHeight - 1, 0),              true);
+    map.Fill(Coord(0,               kRoomWidth - 1), Coord(kRoomHeight - 1, kRoomWidth - 1), true);
+    if(withWall) {
+        map.Fill(Coord(0, kWallColumn), Coord(kRoomHeight - 1, kWallColumn), true);
+    }
+    return map;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief value is at most a few ulps before edge.
+static bool
+IsFlush(float value, float edge)
+{
+    auto ulp = std::nextafter(std::fabs(edge) + 1.0f, std::numeric_limits<float>::infinity())
+             - (std::fabs(edge) + 1.0f);
+    return value <= edge && edge - value <= 8.0f * ulp;
+}
+
+static bool
+CheckWalls(float tileSize, const Vec2 &origin)
+{
+    auto map   = MakeRoom(tileSize, origin, false);
+    auto far   = 1000.0f * tileSize;
+    auto box   = Rect(origin.x + 5.3f * tileSize, origin.y + 4.6f * tileSize, 1.5f * tileSize, 2.5f * tileSize);
+    // The inside of the room, from the first tile to the far walls - With
+    // a tileSize that isn't exact, the right of a tile isn't always the
+    // left of the next one.
+    auto first = map.GetTileRect(Coord(1, 1));
+    auto wall  = map.GetTileRect(Coord(kRoomHeight - 1, kRoomWidth - 1));
+
+    auto passed   = true;
+    auto contacts = u32(0);
+
+    auto moved = map.MoveAndSlide(box, Vec2(far, 0.0f), &contacts);
+    passed &= IsFlush(moved.GetRight(), wall.GetLeft()) && moved.y == box.y;
+    passed &= contacts == TileCollisionMap::kContactRight;
+
+    moved   = map.MoveAndSlide(box, Vec2(-far, 0.0f), &contacts);
+    passed &= IsFlush(-moved.GetLeft(), -first.GetLeft()) && moved.y == box.y;
+    passed &= contacts == TileCollisionMap::kContactLeft;
+
+    moved   = map.MoveAndSlide(box, Vec2(0.0f, far), &contacts);
+    passed &= IsFlush(moved.GetBottom(), wall.GetTop()) && moved.x == box.x;
+    passed &= contacts == TileCollisionMap::kContactBottom;
+
+    moved   = map.MoveAndSlide(box, Vec2(0.0f, -far), &contacts);
+    passed &= IsFlush(-moved.GetTop(), -first.GetTop()) && moved.x == box.x;
+    passed &= contacts == TileCollisionMap::kContactTop;
+
+    // Into a corner, sliding along the first wall.
+    moved   = map.MoveAndSlide(box, Vec2(far, -far), &contacts);
+    passed &= IsFlush(moved.GetRight(), wall.GetLeft()) && IsFlush(-moved.GetTop(), -first.GetTop());
+    passed &= contacts == (TileCollisionMap::kContactRight | TileCollisionMap::kContactTop);
+    passed &= !map.Overlaps(moved);
+
+    // Free moves are exact.
+    auto delta = Vec2(0.75f * tileSize, -1.25f * tileSize);
+    moved   = map.MoveAndSlide(box, delta, &contacts);
+    passed &= moved.x == box.x + delta.x && moved.y == box.y + delta.y;
+    passed &= contacts == TileCollisionMap::kContactNone;
+
+    return passed;
+}
+
+static bool
+CheckTunneling(float tileSize, const Vec2 &origin)
+{
+    auto map  = MakeRoom(tileSize, origin, true);
+    auto wall = map.GetTileRect(Coord(1, kWallColumn));
+    auto box  = Rect(origin.x + 2.5f * tileSize, origin.y + 3.5f * tileSize, 0.5f * tileSize, 0.5f * tileSize);
+
+    auto passed   = true;
+    auto contacts = u32(0);
+
+    // Way past the wall and the room in a single step.
+    auto moved = map.MoveAndSlide(box, Vec2(1e5f * tileSize, 0.0f), &contacts);
+    passed &= IsFlush(moved.GetRight(), wall.GetLeft());
+    passed &= contacts == TileCollisionMap::kContactRight;
+
+    moved   = map.MoveAndSlide(box, Vec2(1e5f * tileSize, 1e5f * tileSize), &contacts);
+    passed &= IsFlush(moved.GetRight(), wall.GetLeft()) && !map.Overlaps(moved);
+    passed &= contacts == (TileCollisionMap::kContactRight | TileCollisionMap::kContactBottom);
+
+    return passed;
+}
+
+static bool
+CheckStartInside(float tileSize, const Vec2 &origin)
+{
+    auto map  = MakeRoom(tileSize, origin, true);
+    auto wall = map.GetTileRect(Coord(1, kWallColumn));
+    auto box  = Rect(wall.x + 0.25f * tileSize, wall.y + 3.0f * tileSize, 1.5f * tileSize, 1.0f * tileSize);
+
+    auto passed   = map.Overlaps(box);
+    auto contacts = u32(0);
+
+    // Out of the wall on both sides - Only the tiles entered are tested.
+    for(auto dx : { -2.0f * tileSize, 2.0f * tileSize }) {
+        auto moved = map.MoveAndSlide(box, Vec2(dx, 0.0f), &contacts);
+        passed &= moved.x == box.x + dx && !map.Overlaps(moved);
+        passed &= contacts == TileCollisionMap::kContactNone;
+    }
+
+    return passed;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief Where the segment enters the tile, in fractions of it.
+/// @returns false if it doesn't go through the tile.
+static bool
+GetTileEntry(const TileCollisionMap &map, const Vec2 &start, const Vec2 &end, const Coord &tile, double *pOut_T, Vec2 *pOut_Normal)
+{
+    auto rect    = map.GetTileRect(tile);
+    double p [2] = { start.x,          start.y          };
+    double d [2] = { end.x - start.x,  end.y - start.y  };
+    double lo[2] = { rect.x,           rect.y           };
+    double hi[2] = { rect.x + rect.w,  rect.y + rect.h  };
+
+    auto   inf      = std::numeric_limits<double>::infinity();
+    double enter[2] = { -inf, -inf };
+    double t_exit   = 1.0;
+    for(auto axis = 0; axis < 2; ++axis) {
+        if(d[axis] == 0.0) {
+            if(p[axis] < lo[axis] || p[axis] >= hi[axis]) {
+                return false;
+            }
+            continue;
+        }
+
+        auto t_lo = (lo[axis] - p[axis]) / d[axis];
+        auto t_hi = (hi[axis] - p[axis]) / d[axis];
+        enter[axis] = std::fmin(t_lo, t_hi);
+        t_exit      = std::fmin(t_exit, std::fmax(t_lo, t_hi));
+    }
+
+    auto t_enter = std::fmax(0.0, std::fmax(enter[0], enter[1]));
+    if(t_enter >= t_exit) {
+        return false;
+    }
+
+    *pOut_T      = t_enter;
+    *pOut_Normal = Vec2::Zero();
+    if(t_enter > 0.0) {
+        if(enter[0] > enter[1]) {
+            *pOut_Normal = Vec2((d[0] > 0.0) ? -1.0f : 1.0f, 0.0f);
+        } else {
+            *pOut_Normal = Vec2(0.0f, (d[1] > 0.0) ? -1.0f : 1.0f);
+        }
+    }
+
+    // Grazing a corner counts as a tie on the normal.
+    if(std::fabs(enter[0] - enter[1]) < kRayTolerance) {
+        *pOut_Normal = Vec2(NAN, NAN);
+    }
+    return true;
+}
+
+static bool
+CheckRaycast(float tileSize, const Vec2 &origin)
+{
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> position(-0.3f, 1.3f);
+
+    TileCollisionMap map(40, 30, tileSize, origin);
+    std::uniform_int_distribution<i32> percent(0, 99);
+    for(i32 y = 0; y < map.GetHeight(); ++y) {
+        for(i32 x = 0; x < map.GetWidth(); ++x) {
+            map.SetSolid(Coord(y, x), percent(rng) < 8);
+        }
+    }
+
+    auto world = Vec2(float(map.GetWidth()) * tileSize, float(map.GetHeight()) * tileSize);
+    for(i32 i = 0; i < kRaysCount; ++i) {
+        auto start = origin + Vec2(position(rng) * world.x, position(rng) * world.y);
+        auto end   = origin + Vec2(position(rng) * world.x, position(rng) * world.y);
+        if(i % 8 == 0) {
+            end.y = start.y; // Along the rows.
+        }
+
+        // Every solid tile, the first one it enters.
+        auto   best_t = std::numeric_limits<double>::infinity();
+        Coord  best_tile;
+        Vec2   best_normal;
+        for(i32 y = 0; y < map.GetHeight(); ++y) {
+            for(i32 x = 0; x < map.GetWidth(); ++x) {
+                double t;
+                Vec2   normal;
+                if(map.IsSolid(Coord(y, x)) && GetTileEntry(map, start, end, Coord(y, x), &t, &normal) && t < best_t) {
+                    best_t      = t;
+                    best_tile   = Coord(y, x);
+                    best_normal = normal;
+                }
+            }
+        }
+
+        TileCollisionMap::TileHit hit;
+        if(!map.Raycast(start, end, &hit)) {
+            if(best_t != std::numeric_limits<double>::infinity()) {
+                std::printf("  missed tile (%d, %d) at t %g\n", best_tile.y, best_tile.x, best_t);
+                return false;
+            }
+            continue;
+        }
+
+        double hit_t;
+        Vec2   hit_normal;
+        if(!GetTileEntry(map, start, end, hit.tile, &hit_t, &hit_normal)
+        || std::fabs(double(hit.t) - best_t) > kRayTolerance
+        || std::fabs(hit_t         - best_t) > kRayTolerance)
+        {
+            std::printf("  hit tile (%d, %d) at t %g, first is (%d, %d) at t %g\n",
+                hit.tile.y, hit.tile.x, double(hit.t), best_tile.y, best_tile.x, best_t);
+            return false;
+        }
+
+        // Normals of ties (corners) can be either one.
+        auto is_tie = std::isnan(best_normal.x) || std::isnan(hit_normal.x) || !(hit.tile == best_tile);
+        if(!is_tie && (hit.normal.x != best_normal.x || hit.normal.y != best_normal.y)) {
+            std::printf("  tile (%d, %d) normal (%g, %g), expected (%g, %g)\n",
+                hit.tile.y, hit.tile.x, hit.normal.x, hit.normal.y, best_normal.x, best_normal.y);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto passed = true;
+    passed &= Check("Walls",                CheckWalls      (1.0f, Vec2::Zero()));
+    passed &= Check("Tunneling",            CheckTunneling  (1.0f, Vec2::Zero()));
+    passed &= Check("Start inside",         CheckStartInside(1.0f, Vec2::Zero()));
+    passed &= Check("Raycast",              CheckRaycast    (1.0f, Vec2::Zero()));
+
+    // Neither the tiles nor the origin are exact in binary.
+    auto tile_size = 0.7f;
+    auto origin    = Vec2(-13.3f, 7.1f);
+    passed &= Check("Walls (0.7)",          CheckWalls      (tile_size, origin));
+    passed &= Check("Tunneling (0.7)",      CheckTunneling  (tile_size, origin));
+    passed &= Check("Start inside (0.7)",   CheckStartInside(tile_size, origin));
+    passed &= Check("Raycast (0.7)",        CheckRaycast    (tile_size, origin));
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
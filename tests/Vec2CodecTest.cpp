@@ -0,0 +1,271 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Vec2CodecTest.cpp                                             //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Vec2StreamEncoder to Vec2StreamDecoder round trips - The decoded        //
+//    points stay inside of half a cell, keyframes are sent when they have    //
+//    to be, and bad frames are refused without touching the decoder.         //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+// acow_math_goodies
+#include "acow/math_goodies.h"
+
+using namespace acow::math;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr i32 kFramesCount = 20;
+
+// Not a multiple of the 16 values blocks (2 values per point).
+constexpr size_t kPointsCount = 1001;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+struct Stream
+{
+    std::vector<u8>                bytes;
+    std::vector<size_t>            offsets;
+    std::vector<std::vector<Vec2>> frames;
+}; // struct Stream
+
+///-----------------------------------------------------------------------------
+/// @brief Random walk of the points - The count changes at frame 10 and
+///   the encoder is Reset at frame 15, so both have to be keyframes.
+static Stream
+EncodeStream(const Vec2Quantizer &quantizer)
+{
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> position(-1000.0f, 1000.0f);
+    std::uniform_real_distribution<float> step    (-0.5f, 0.5f);
+
+    std::vector<Vec2> points(kPointsCount);
+    for(auto &point : points) {
+        point = Vec2(position(rng), position(rng) * 0.5f);
+    }
+
+    Stream stream;
+    Vec2StreamEncoder encoder(quantizer);
+    for(i32 frame = 0; frame < kFramesCount; ++frame) {
+        for(auto &point : points) {
+            point.x += step(rng);
+            point.y += step(rng);
+        }
+        if(frame == 10) {
+            points.resize(kPointsCount / 2);
+        }
+        if(frame == 15) {
+            encoder.Reset();
+        }
+
+        stream.offsets.push_back(stream.bytes.size());
+        stream.frames .push_back(points);
+        encoder.EncodeFrame(points.data(), points.size(), &stream.bytes);
+    }
+    stream.offsets.push_back(stream.bytes.size());
+
+    return stream;
+}
+
+///-----------------------------------------------------------------------------
+/// @brief The flags byte, right after the count varint.
+static bool
+IsKeyframe(const Stream &stream, i32 frame)
+{
+    auto p_begin = stream.bytes.data() + stream.offsets[frame];
+    auto p_end   = stream.bytes.data() + stream.offsets[frame + 1];
+
+    u64  count   = 0;
+    auto p_flags = detail::ReadVarint(p_begin, p_end, &count);
+    return p_flags && (*p_flags & detail::kCodecFlagKeyframe) != 0;
+}
+
+static bool
+IsInsideHalfCell(const Vec2Quantizer &quantizer, const std::vector<Vec2> &points, const std::vector<Vec2> &decoded)
+{
+    if(points.size() != decoded.size()) {
+        return false;
+    }
+
+    // A bit over half a cell for the rounding of the dequantization.
+    const auto &bounds = quantizer.GetBounds();
+    auto half_cell     = quantizer.GetCellSize() * 0.5f;
+    auto tolerance     = 1e-3f;
+
+    for(size_t i = 0; i < points.size(); ++i) {
+        auto x = Clamp(points[i].x, bounds.x, bounds.x + bounds.w);
+        auto y = Clamp(points[i].y, bounds.y, bounds.y + bounds.h);
+        if(std::fabs(decoded[i].x - x) > half_cell.x + tolerance
+        || std::fabs(decoded[i].y - y) > half_cell.y + tolerance) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+CheckBlock(const u32 (&values)[detail::kCodecBlockSize], u32 expectedBits)
+{
+    u8  bytes[1 + detail::kCodecBlockSize * 4];
+    u32 unpacked[detail::kCodecBlockSize];
+
+    auto p_end   = detail::PackBlock(values, bytes);
+    auto written = size_t(p_end - bytes);
+    if(bytes[0] != expectedBits || written != 1 + 2 * expectedBits) {
+        return false;
+    }
+
+    // One byte short has to be refused.
+    if(written > 1 && detail::UnpackBlock(bytes, p_end - 1, unpacked) != nullptr) {
+        return false;
+    }
+    if(detail::UnpackBlock(bytes, p_end, unpacked) != p_end) {
+        return false;
+    }
+    for(size_t i = 0; i < detail::kCodecBlockSize; ++i) {
+        if(unpacked[i] != values[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+Check(const char *name, bool passed)
+{
+    std::printf("%-24s %s\n", name, passed ? "ok" : "FAILED");
+    return passed;
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    // The random walk goes a bit out of the bounds, to get clamped.
+    auto quantizer = Vec2Quantizer::FromPrecision(Rect(-1000.0f, -500.0f, 2000.0f, 1000.0f), 0.01f);
+    auto stream    = EncodeStream(quantizer);
+
+    auto passed = true;
+    passed &= Check("Cell size", quantizer.GetCellSize().x <= 0.01f && quantizer.GetCellSize().y <= 0.01f);
+
+    auto round_trip = true;
+    {
+        Vec2StreamDecoder decoder(quantizer);
+        std::vector<Vec2> decoded;
+        for(i32 frame = 0; frame < kFramesCount; ++frame) {
+            auto offset = stream.offsets[frame];
+            auto size   = stream.offsets[frame + 1] - offset;
+
+            round_trip &= decoder.DecodeFrame(stream.bytes.data() + offset, stream.bytes.size() - offset, &decoded) == size;
+            round_trip &= IsInsideHalfCell(quantizer, stream.frames[frame], decoded);
+        }
+    }
+    passed &= Check("Round trip", round_trip);
+
+    auto keyframes = true;
+    for(i32 frame = 0; frame < kFramesCount; ++frame) {
+        keyframes &= IsKeyframe(stream, frame) == (frame == 0 || frame == 10 || frame == 15);
+    }
+    passed &= Check("Keyframes", keyframes);
+
+    // Delta frames are much smaller than the keyframes.
+    passed &= Check("Delta size",
+        (stream.offsets[2] - stream.offsets[1]) * 2 < (stream.offsets[1] - stream.offsets[0])
+    );
+
+    // Nothing moved, so the deltas are all 0 bits blocks.
+    {
+        Vec2StreamEncoder encoder(quantizer);
+        std::vector<u8>   bytes;
+        const auto &points = stream.frames.back();
+        encoder.EncodeFrame(points.data(), points.size(), &bytes);
+
+        auto blocks_count = (points.size() * 2 + detail::kCodecBlockSize - 1) / detail::kCodecBlockSize;
+        auto size         = encoder.EncodeFrame(points.data(), points.size(), &bytes);
+        passed &= Check("Still frame", size == 2 + 1 + blocks_count);
+    }
+
+    u32 zeros[detail::kCodecBlockSize] = {};
+    u32 full [detail::kCodecBlockSize] = {};
+    u32 mixed[detail::kCodecBlockSize] = {};
+    for(size_t i = 0; i < detail::kCodecBlockSize; ++i) {
+        full [i] = 0xFFFFFFFFu - u32(i);
+        mixed[i] = u32(i * 0x9E3779B9u) >> (i % 8);
+    }
+    mixed[5] |= 0x80000000u;
+    passed &= Check("0 bits block",  CheckBlock(zeros, 0));
+    passed &= Check("32 bits block", CheckBlock(full,  32) && CheckBlock(mixed, 32));
+
+    // After frame 0 the decoder has to refuse these and still decode frame 1.
+    auto refused = true;
+    {
+        Vec2StreamDecoder decoder(quantizer);
+        std::vector<Vec2> decoded;
+        decoder.DecodeFrame(stream.bytes.data(), stream.bytes.size(), &decoded);
+        auto frame_0 = decoded;
+
+        auto p_frame_1 = stream.bytes.data() + stream.offsets[1];
+        auto size_1    = stream.offsets[2] - stream.offsets[1];
+        for(size_t cut = 0; cut < size_1; ++cut) {
+            refused &= decoder.DecodeFrame(p_frame_1, cut, &decoded) == 0;
+        }
+
+        // Bits count bigger than 32.
+        auto garbage = std::vector<u8>(p_frame_1, p_frame_1 + size_1);
+        garbage[3] = 33;
+        refused &= decoder.DecodeFrame(garbage.data(), garbage.size(), &decoded) == 0;
+
+        // Delta frame of other count than the previous.
+        auto p_frame_11 = stream.bytes.data() + stream.offsets[11];
+        refused &= decoder.DecodeFrame(p_frame_11, stream.bytes.size() - stream.offsets[11], &decoded) == 0;
+
+        // More points than the bytes can have.
+        const u8 huge[] = { 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, detail::kCodecFlagKeyframe, 0 };
+        refused &= decoder.DecodeFrame(huge, sizeof(huge), &decoded) == 0;
+
+        refused &= decoded.size() == frame_0.size()
+                && std::memcmp(decoded.data(), frame_0.data(), sizeof(Vec2) * frame_0.size()) == 0;
+        refused &= decoder.DecodeFrame(p_frame_1, size_1, &decoded) == size_1;
+        refused &= IsInsideHalfCell(quantizer, stream.frames[1], decoded);
+    }
+    passed &= Check("Bad frames", refused);
+
+    // A delta frame can't be the first one.
+    {
+        Vec2StreamDecoder decoder(quantizer);
+        std::vector<Vec2> decoded;
+        passed &= Check("Delta without keyframe",
+            decoder.DecodeFrame(stream.bytes.data() + stream.offsets[1], stream.bytes.size() - stream.offsets[1], &decoded) == 0
+            && decoded.empty()
+        );
+    }
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
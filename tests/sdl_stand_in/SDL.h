@@ -0,0 +1,51 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SDL.h                                                         //
+//  Project   : acow_math_goodies                                             //
+//  Date      : Oct 19, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Stand-in for SDL.h with only the structs that the library uses, laid    //
+//    out as in SDL_rect.h - So the SDL code builds under ctest without SDL.  //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+
+typedef struct SDL_Point
+{
+    int x;
+    int y;
+} SDL_Point;
+
+typedef struct SDL_FPoint
+{
+    float x;
+    float y;
+} SDL_FPoint;
+
+typedef struct SDL_Rect
+{
+    int x;
+    int y;
+    int w;
+    int h;
+} SDL_Rect;
+
+typedef struct SDL_FRect
+{
+    float x;
+    float y;
+    float w;
+    float h;
+} SDL_FRect;